@@ -0,0 +1,48 @@
+#include "AuthBench.hpp"
+#include "BenchHarness.hpp"
+
+#include "auth/AuthInterceptor.hpp"
+#include "app/JwksStandIn.hpp"
+#include "app/TestKeys.hpp"
+#include "app/TestRequest.hpp"
+
+void runAuthBench() {
+  TestKeys keys;
+  JwksStandIn idp(keys.jwks()); // Port vom Kernel
+  auto cfg = TestKeys::config(idp.url());
+  const auto token = keys.sign(*cfg, "bench-user");
+  volatile std::int64_t sink = 0;
+
+  bench::printHeader("JwtVerifier::verify");
+
+  // kalt: leerer JWKS- und TokenCache → HTTP-Fetch vom Stand-in, Schlüsselaufbau, Signaturprüfung
+  bench::run("verify, cold (new verifier + JWKS fetch)", [&] {
+    JwtVerifier cold(cfg);
+    sink = cold.verify(token)->expiresAt;
+  }, 1, 3);
+
+  auto noCache = std::make_shared<AuthConfig>(*cfg);
+  noCache->tokenCacheSize = 0;
+  JwtVerifier missVerifier(noCache);
+  bench::run("verify, token cache miss (JWKS warm)", [&] {
+    sink = missVerifier.verify(token)->expiresAt;
+  }, 8);
+
+  auto verifier = std::make_shared<JwtVerifier>(cfg);
+  bench::run("verify, token cache hit", [&] {
+    sink = verifier->verify(token)->expiresAt;
+  });
+
+  bench::printHeader("AuthInterceptor::intercept");
+
+  AuthInterceptor interceptor(verifier);
+  const auto publicReq = makeRequest("GET", "/api/public/ping");
+  const auto secureReq = makeRequest("GET", "/api/secure/ping", {{"Authorization", oatpp::String("Bearer " + token)}});
+  const auto anonymousReq = makeRequest("GET", "/api/secure/ping");
+
+  bench::run("intercept, public path", [&] { sink = interceptor.intercept(publicReq) != nullptr; });
+  bench::run("intercept, secure path, valid token", [&] { sink = interceptor.intercept(secureReq) != nullptr; });
+  bench::run("intercept, secure path, no token (401)", [&] { sink = interceptor.intercept(anonymousReq) != nullptr; });
+
+  (void) sink;
+}
@@ -0,0 +1,11 @@
+#ifndef AuthBench_hpp
+#define AuthBench_hpp
+
+/**
+ * Auth-Hot-Path (ein Thread, BenchHarness), offline gegen einen lokalen JWKS-Server (JwksStandIn).
+ * - JwtVerifier::verify: kalt (neuer Verifier, JWKS-Fetch + Signatur), TokenCache-Miss, TokenCache-Treffer
+ * - AuthInterceptor::intercept: öffentlicher Pfad, geschützter Pfad mit/ohne Token
+ */
+void runAuthBench();
+
+#endif // AuthBench_hpp
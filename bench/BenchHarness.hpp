@@ -0,0 +1,86 @@
+#ifndef BenchHarness_hpp
+#define BenchHarness_hpp
+
+#include "app/AllocationCounter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/**
+ * Gemeinsamer Messrahmen der Micro-Benchmarks (ein Thread).
+ * - op() läuft in Runden zu `batch` Aufrufen, bis kDuration oder kMaxSamples erreicht sind
+ * - ns/op: Mittelwert über alle Aufrufe; p50/p90/p99: Perzentile der Runden (ns pro Aufruf)
+ * - alloc/op: C++-Heap-Allokationen pro Aufruf (AllocationCounter; malloc in OpenSSL/curl zählt nicht)
+ */
+namespace bench {
+
+struct Result {
+  double nsPerOp = 0;
+  double allocsPerOp = 0;
+  double p50 = 0;
+  double p90 = 0;
+  double p99 = 0;
+  std::uint64_t ops = 0;
+};
+
+constexpr auto kDuration = std::chrono::milliseconds(500);
+constexpr std::size_t kMaxSamples = 200000;
+
+template<typename Op>
+Result measure(Op&& op, std::size_t batch = 64, std::size_t warmup = 100) {
+  for (std::size_t i = 0; i < warmup; ++i) op(); // thread-lokale Puffer, Caches, Lazy-Init
+
+  std::vector<double> samples;
+  samples.reserve(4096);
+  std::uint64_t ops = 0;
+  std::uint64_t allocations = 0;
+  double totalNs = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  while (samples.size() < kMaxSamples && std::chrono::steady_clock::now() - start < kDuration) {
+    const auto a0 = AllocationCounter::threadAllocations();
+    const auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < batch; ++i) op();
+    const auto t1 = std::chrono::steady_clock::now();
+    allocations += AllocationCounter::threadAllocations() - a0;
+
+    const auto ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+    totalNs += ns;
+    ops += batch;
+    samples.push_back(ns / (double) batch);
+  }
+
+  Result r;
+  r.ops = ops;
+  r.nsPerOp = totalNs / (double) ops;
+  r.allocsPerOp = (double) allocations / (double) ops;
+  std::sort(samples.begin(), samples.end());
+  auto pct = [&](double p) { return samples[std::min(samples.size() - 1, (std::size_t) (p * (double) samples.size()))]; };
+  r.p50 = pct(0.50);
+  r.p90 = pct(0.90);
+  r.p99 = pct(0.99);
+  return r;
+}
+
+inline void printHeader(const char* title) {
+  std::printf("\n%s\n", title);
+  std::printf("%-44s %12s %10s %12s %12s %12s\n", "benchmark", "ns/op", "alloc/op", "p50", "p90", "p99");
+}
+
+inline void printRow(const char* name, const Result& r) {
+  std::printf("%-44s %12.1f %10.2f %12.1f %12.1f %12.1f\n", name, r.nsPerOp, r.allocsPerOp, r.p50, r.p90, r.p99);
+}
+
+template<typename Op>
+Result run(const char* name, Op&& op, std::size_t batch = 64, std::size_t warmup = 100) {
+  const auto r = measure(op, batch, warmup);
+  printRow(name, r);
+  return r;
+}
+
+}
+
+#endif // BenchHarness_hpp
@@ -0,0 +1,221 @@
+#include "CompactStudentBench.hpp"
+#include "BenchHarness.hpp"
+
+#include "model/CompactStudent.hpp"
+#include "model/Student.hpp"
+#include "model/StudentRepository.hpp"
+#include "util/ScratchArena.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace {
+
+constexpr std::size_t kRecords = 1'000'000;
+
+struct Input {
+  std::int32_t id;
+  std::int32_t age;
+  double gpa;
+  std::string firstName;
+  std::string lastName;
+  model::SymbolId university;
+  model::SymbolId courses[2];
+};
+
+/**
+ * Jeder vierte Nachname ist länger als der SSO-Puffer von std::string (15 Zeichen).
+ */
+std::vector<Input> makeInputs() {
+  static const char* universities[] = {"TU Berlin", "LMU", "RWTH Aachen"};
+  static const char* courses[] = {"Analysis", "Lineare Algebra", "Programmierung", "Datenbanken", "Statistik"};
+  auto& symbols = model::SymbolTable::global();
+  std::vector<Input> inputs(kRecords);
+  for (std::size_t i = 0; i < kRecords; ++i) {
+    auto& in = inputs[i];
+    in.id = (std::int32_t) i + 1;
+    in.age = 18 + (int) (i % 15);
+    in.gpa = 1.0 + (double) (i % 300) / 100.0;
+    in.firstName = "Vorname" + std::to_string(i % 5000);
+    in.lastName = "Nachname" + std::to_string(i % 20000) + (i % 4 == 0 ? "-Schmidt" : "");
+    in.university = symbols.intern(universities[i % 3]);
+    in.courses[0] = symbols.intern(courses[i % 5]);
+    in.courses[1] = symbols.intern(courses[(i / 5) % 5]);
+  }
+  return inputs;
+}
+
+/**
+ * Belegter Heap laut glibc (inkl. malloc-Verwaltung und per mmap geholter Blöcke); anderswo 0 → "n/a".
+ */
+std::size_t heapInUse() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+  const auto info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+#else
+  return 0;
+#endif
+}
+
+template<typename F>
+double ms(F&& f) {
+  const auto t0 = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+template<typename F>
+double bestMs(F&& f, int runs = 5) {
+  double best = 1e300;
+  for (int i = 0; i < runs; ++i) best = std::min(best, ms(f));
+  return best;
+}
+
+void loadRow(const char* name, double loadMs, std::size_t heapBefore, std::size_t heapAfter) {
+  if (heapAfter == 0) {
+    std::printf("%-44s %12.1f %16s\n", name, loadMs, "n/a");
+  } else {
+    std::printf("%-44s %12.1f %16.1f\n", name, loadMs, (double) (heapAfter - heapBefore) / kRecords);
+  }
+}
+
+void scanRow(const char* name, double scanMs) {
+  std::printf("%-44s %12.2f %16.1f\n", name, scanMs, kRecords / scanMs / 1e3);
+}
+
+}
+
+void runCompactStudentBench() {
+  const auto inputs = makeInputs();
+  const auto university = inputs[1].university;
+  const auto course = inputs[3].courses[0];
+
+  std::printf("\nsizeof: Student = %zu, StudentRecord = %zu, CompactStudent = %zu bytes\n",
+              sizeof(model::Student), sizeof(model::StudentRecord), sizeof(model::CompactStudent));
+  std::printf("\nBulk load (%zu records, 2 courses, every 4th last name > 15 chars)\n", kRecords);
+  std::printf("%-44s %12s %16s\n", "variant", "ms", "heap bytes/rec");
+
+  std::vector<model::StudentRecord> records;
+  auto heap0 = heapInUse();
+  const auto recordsMs = ms([&] {
+    records.reserve(kRecords);
+    for (const auto& in : inputs) {
+      model::StudentRecord r;
+      r.id = in.id;
+      r.age = in.age;
+      r.gpa = in.gpa;
+      r.firstName = in.firstName;
+      r.lastName = in.lastName;
+      r.university = in.university;
+      r.courses.add(in.courses[0]);
+      r.courses.add(in.courses[1]);
+      records.push_back(std::move(r));
+    }
+  });
+  loadRow("std::vector<StudentRecord>", recordsMs, heap0, heapInUse());
+
+  {
+    std::pmr::vector<model::CompactStudent> heapStudents(std::pmr::new_delete_resource());
+    heap0 = heapInUse();
+    const auto heapMs = ms([&] {
+      heapStudents.reserve(kRecords);
+      for (const auto& in : inputs) {
+        auto& s = heapStudents.emplace_back(in.id, in.firstName, in.lastName, in.age, in.gpa);
+        s.setUniversity(in.university);
+        s.addCourse(in.courses[0]);
+        s.addCourse(in.courses[1]);
+      }
+    });
+    loadRow("pmr::vector<CompactStudent>, new/delete", heapMs, heap0, heapInUse());
+  }
+
+  model::StudentArena arena(1u << 20);
+  heap0 = heapInUse();
+  const auto arenaMs = ms([&] {
+    arena.reserve(kRecords);
+    for (const auto& in : inputs) {
+      auto& s = arena.add(in.id, in.firstName, in.lastName, in.age, in.gpa);
+      s.setUniversity(in.university);
+      s.addCourse(in.courses[0]);
+      s.addCourse(in.courses[1]);
+    }
+  });
+  loadRow("StudentArena (monotonic + pool)", arenaMs, heap0, heapInUse());
+
+  std::printf("\nScan (%zu records, best of 5)\n", kRecords);
+  std::printf("%-44s %12s %16s\n", "variant", "ms", "M records/s");
+  volatile double sink = 0;
+
+  // nur heiße Felder: Durchschnitts-GPA einer Universität ab 25 Jahren
+  scanRow("hot fields, StudentRecord", bestMs([&] {
+    double sum = 0;
+    std::size_t n = 0;
+    for (const auto& r : records) {
+      if (r.university == university && r.age >= 25) { sum += r.gpa; ++n; }
+    }
+    sink = n ? sum / (double) n : 0;
+  }));
+  scanRow("hot fields, CompactStudent", bestMs([&] {
+    double sum = 0;
+    std::size_t n = 0;
+    for (const auto& s : arena) {
+      if (s.getUniversityId() == university && s.getAge() >= 25) { sum += s.getGpa(); ++n; }
+    }
+    sink = n ? sum / (double) n : 0;
+  }));
+
+  // Kursmitgliedschaft: StudentRecord folgt einem Zeiger, CompactStudent liest inline
+  scanRow("course member, StudentRecord", bestMs([&] {
+    std::size_t n = 0;
+    for (const auto& r : records) n += r.courses.contains(course);
+    sink = (double) n;
+  }));
+  scanRow("course member, CompactStudent", bestMs([&] {
+    std::size_t n = 0;
+    for (const auto& s : arena) n += s.hasCourse(course);
+    sink = (double) n;
+  }));
+
+  // Namenspräfix: SSO im Datensatz bzw. eigener Block gegen gemeinsamen Namensblock
+  scanRow("last name prefix, StudentRecord", bestMs([&] {
+    std::size_t n = 0;
+    for (const auto& r : records) n += r.lastName.compare(0, 9, "Nachname1") == 0;
+    sink = (double) n;
+  }));
+  scanRow("last name prefix, CompactStudent", bestMs([&] {
+    std::size_t n = 0;
+    for (const auto& s : arena) n += s.getLastName().substr(0, 9) == "Nachname1";
+    sink = (double) n;
+  }));
+
+  // Zwischenergebnis pro Request: IDs einer Seite mit 1000 Datensätzen, die einen Kurs belegen
+  constexpr std::size_t kPage = 1000;
+  std::size_t offset = 0;
+  bench::printHeader("Per-request scratch (ids with course in a 1000-record page)");
+  bench::run("std::vector<int32_t>", [&] {
+    std::vector<std::int32_t> ids;
+    for (std::size_t i = offset; i < offset + kPage; ++i) {
+      if (arena[i].hasCourse(course)) ids.push_back(arena[i].getId());
+    }
+    sink = (double) ids.size();
+    offset = (offset + kPage) % (kRecords - kPage);
+  }, 16);
+  bench::run("std::pmr::vector<int32_t> on ScratchArena<8K>", [&] {
+    ScratchArena<8192> scratch;
+    std::pmr::vector<std::int32_t> ids(&scratch);
+    for (std::size_t i = offset; i < offset + kPage; ++i) {
+      if (arena[i].hasCourse(course)) ids.push_back(arena[i].getId());
+    }
+    sink = (double) ids.size();
+    offset = (offset + kPage) % (kRecords - kPage);
+  }, 16);
+  (void) sink;
+}
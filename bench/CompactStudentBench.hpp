@@ -0,0 +1,12 @@
+#ifndef CompactStudentBench_hpp
+#define CompactStudentBench_hpp
+
+/**
+ * Speicherlayout der Studentendaten.
+ * - Import und Bytes pro Datensatz: std::vector<StudentRecord> gegen CompactStudent (Heap-Resource und StudentArena)
+ * - Scans über 1M Datensätze: nur heiße Felder, Kursmitgliedschaft, Namenspräfix
+ * - Zwischenergebnis pro Request: std::vector gegen std::pmr::vector auf einer ScratchArena
+ */
+void runCompactStudentBench();
+
+#endif // CompactStudentBench_hpp
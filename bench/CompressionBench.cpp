@@ -0,0 +1,104 @@
+#include "CompressionBench.hpp"
+#include "BenchHarness.hpp"
+
+#include "server/CompressionInterceptor.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string studentsJson(int count) {
+  std::string json = "[";
+  for (int i = 0; i < count; ++i) {
+    json += "{\"id\":" + std::to_string(100000 + i)
+          + ",\"name\":\"Student " + std::to_string(i * 7919 % 100000)
+          + "\",\"university\":\"" + (i % 3 == 0 ? "TU Berlin" : i % 3 == 1 ? "LMU" : "RWTH Aachen")
+          + "\",\"courses\":[\"Analysis\",\"Lineare Algebra\",\"Informatik " + std::to_string(i % 4) + "\"]},";
+  }
+  json.back() = ']';
+  return json;
+}
+
+std::string metricsText() {
+  std::string text;
+  for (int i = 0; i < 40; ++i) {
+    text += "http_request_duration_seconds_bucket{method=\"GET\",endpoint=\"/api/e" + std::to_string(i % 8)
+          + "\",le=\"0." + std::to_string(i) + "\"} " + std::to_string(i * 1234) + "\n";
+  }
+  return text;
+}
+
+struct Variant {
+  const char* label;
+  compression::Encoding encoding;
+  int level;
+};
+
+}
+
+void runCompressionBench() {
+  using compression::Encoding;
+
+  const std::vector<std::pair<const char*, std::string>> payloads = {
+    {"students x10", studentsJson(10)},
+    {"students x200", studentsJson(200)},
+    {"students x5000", studentsJson(5000)},
+    {"metrics text", metricsText()},
+  };
+  std::vector<Variant> variants = {
+    {"gzip -1", Encoding::Gzip, 1},
+    {"gzip -6", Encoding::Gzip, 6},
+    {"gzip -9", Encoding::Gzip, 9},
+    {"deflate -6", Encoding::Deflate, 6},
+  };
+#ifdef MY_PROJECT_BROTLI
+  variants.push_back({"br q1", Encoding::Brotli, 1});
+  variants.push_back({"br q4", Encoding::Brotli, 4});
+  variants.push_back({"br q9", Encoding::Brotli, 9});
+#endif
+
+  std::vector<char> out(16 * 1024);
+  volatile std::size_t sink = 0;
+
+  std::printf("\nResponse compression (CompressedBody, 16 KiB send buffer)\n");
+  std::printf("%-16s %-11s %10s %10s %8s %12s %10s %14s\n",
+              "payload", "encoding", "bytes in", "bytes out", "saved", "us/response", "MB/s in", "us/100KiB saved");
+
+  for (const auto& [name, text] : payloads) {
+    const oatpp::String body(text);
+    for (const auto& v : variants) {
+      compression::Options options;
+      options.level = v.level;
+      options.brotliQuality = v.level;
+
+      std::size_t compressedSize = 0;
+      auto once = [&] {
+        CompressedBody compressed(
+          oatpp::web::protocol::http::outgoing::BufferBody::createShared(body, "application/json"),
+          compression::makeEncoder(v.encoding, options));
+        oatpp::async::Action action;
+        std::size_t total = 0;
+        for (;;) {
+          const auto n = compressed.read(out.data(), (v_buff_size) out.size(), action);
+          if (n <= 0) break;
+          total += (std::size_t) n;
+        }
+        compressedSize = total;
+        sink = total;
+      };
+
+      const auto r = bench::measure(once, text.size() > 100000 ? 1 : 16, 4);
+      const double in = (double) text.size();
+      const double saved = in - (double) compressedSize;
+      std::printf("%-16s %-11s %10zu %10zu %7.1f%% %12.1f %10.1f %14.1f\n",
+                  name, v.label, text.size(), compressedSize, 100.0 * saved / in, r.nsPerOp / 1e3,
+                  in / r.nsPerOp * 1e3, saved > 0 ? r.nsPerOp / 1e3 / (saved / (100.0 * 1024)) : 0.0);
+    }
+  }
+
+  (void) sink;
+}
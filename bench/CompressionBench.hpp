@@ -0,0 +1,11 @@
+#ifndef CompressionBench_hpp
+#define CompressionBench_hpp
+
+/**
+ * Response-Kompression über CompressedBody (wie beim Senden, 16-KiB-Stücke), ein Thread, BenchHarness.
+ * - JSON-Listen verschiedener Größe und Prometheus-Text, je Encoding/Level
+ * - CPU-Kosten (µs/Response, MB/s Eingabe) gegen eingesparte Bytes (Ratio, µs pro eingesparte 100 KiB)
+ */
+void runCompressionBench();
+
+#endif // CompressionBench_hpp
@@ -0,0 +1,134 @@
+#ifndef HdrHistogram_hpp
+#define HdrHistogram_hpp
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/**
+ * Kompaktes HDR-Histogramm (Layout wie HdrHistogram, 3 signifikante Stellen).
+ * - record() ist O(1) ohne Allokation; ein Histogramm pro Thread, am Ende per add() zusammenführen
+ * - Werte in Nanosekunden bis maxValue, größere werden auf maxValue gekappt
+ * - printPercentiles() schreibt das .hgrm-Textformat (vergleichbar über Commits, plotbar mit HdrHistogram-Tools)
+ */
+class HdrHistogram {
+  static constexpr int kSubBucketHalfCountMagnitude = 10;                  // 3 signifikante Stellen
+  static constexpr std::int64_t kSubBucketHalfCount = 1 << kSubBucketHalfCountMagnitude;
+  static constexpr std::int64_t kSubBucketCount = kSubBucketHalfCount * 2;
+  static constexpr std::int64_t kSubBucketMask = kSubBucketCount - 1;
+
+  std::int64_t maxValue_;
+  std::vector<std::uint64_t> counts_;
+  std::uint64_t total_ = 0;
+  std::int64_t min_ = INT64_MAX;
+  std::int64_t max_ = 0;
+
+  static int bucketIndex(std::int64_t v) {
+    return (63 - __builtin_clzll((unsigned long long) (v | kSubBucketMask))) - kSubBucketHalfCountMagnitude;
+  }
+  static std::size_t countsIndex(std::int64_t v) {
+    const int b = bucketIndex(v);
+    const std::int64_t sub = v >> b;
+    return (std::size_t) (((std::int64_t) (b + 1) << kSubBucketHalfCountMagnitude) + (sub - kSubBucketHalfCount));
+  }
+  static std::int64_t valueAt(std::size_t index) {
+    std::int64_t b = ((std::int64_t) index >> kSubBucketHalfCountMagnitude) - 1;
+    std::int64_t sub = ((std::int64_t) index & (kSubBucketHalfCount - 1)) + kSubBucketHalfCount;
+    if (b < 0) { sub -= kSubBucketHalfCount; b = 0; }
+    return sub << b;
+  }
+  static std::int64_t highestEquivalent(std::int64_t v) {
+    return v + (std::int64_t(1) << bucketIndex(v)) - 1;
+  }
+
+public:
+  explicit HdrHistogram(std::int64_t maxValue = 60LL * 1000 * 1000 * 1000) // 60 s in ns
+    : maxValue_(maxValue)
+    , counts_(countsIndex(maxValue) + 1, 0)
+  {}
+
+  void record(std::int64_t v) {
+    v = std::clamp<std::int64_t>(v, 0, maxValue_);
+    ++counts_[countsIndex(v)];
+    ++total_;
+    min_ = std::min(min_, v);
+    max_ = std::max(max_, v);
+  }
+
+  void add(const HdrHistogram& other) {
+    for (std::size_t i = 0; i < std::min(counts_.size(), other.counts_.size()); ++i) counts_[i] += other.counts_[i];
+    total_ += other.total_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+  }
+
+  std::uint64_t count() const noexcept { return total_; }
+  std::int64_t min() const noexcept { return total_ ? min_ : 0; }
+  std::int64_t max() const noexcept { return max_; }
+
+  double mean() const {
+    if (!total_) return 0;
+    long double sum = 0;
+    for (std::size_t i = 0; i < counts_.size(); ++i) {
+      if (counts_[i]) sum += (long double) counts_[i] * (long double) valueAt(i);
+    }
+    return (double) (sum / total_);
+  }
+
+  double stdDeviation() const {
+    if (!total_) return 0;
+    const long double m = mean();
+    long double sum = 0;
+    for (std::size_t i = 0; i < counts_.size(); ++i) {
+      if (!counts_[i]) continue;
+      const long double d = (long double) valueAt(i) - m;
+      sum += (long double) counts_[i] * d * d;
+    }
+    return (double) std::sqrt(sum / total_);
+  }
+
+  /**
+   * Wert, unter dem `percentile` Prozent der Messungen liegen (höchster äquivalenter Wert).
+   */
+  std::int64_t valueAtPercentile(double percentile) const {
+    if (!total_) return 0;
+    const auto target = std::max<std::uint64_t>(1, (std::uint64_t) std::ceil(percentile / 100.0 * (double) total_));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < counts_.size(); ++i) {
+      seen += counts_[i];
+      if (seen >= target) return std::min(highestEquivalent(valueAt(i)), max_);
+    }
+    return max_;
+  }
+
+  /**
+   * Perzentil-Verteilung im .hgrm-Format; Werte geteilt durch `scale` (z.B. 1000 → µs).
+   */
+  void printPercentiles(std::FILE* out, double scale = 1000.0, int ticksPerHalfDistance = 5) const {
+    std::fprintf(out, "%12s %14s %10s %14s\n\n", "Value", "Percentile", "TotalCount", "1/(1-Percentile)");
+    if (!total_) return;
+    double percentile = 0;
+    for (;;) {
+      const auto v = valueAtPercentile(percentile);
+      std::uint64_t below = 0;
+      for (std::size_t i = 0; i < counts_.size() && valueAt(i) <= v; ++i) below += counts_[i];
+      const double p = (double) below / (double) total_;
+      if (p >= 1.0) {
+        std::fprintf(out, "%12.3f %14.12f %10llu\n", (double) v / scale, 1.0, (unsigned long long) total_);
+        break;
+      }
+      std::fprintf(out, "%12.3f %14.12f %10llu %14.2f\n", (double) v / scale, p, (unsigned long long) below, 1.0 / (1.0 - p));
+      // wie HdrHistogram: Schrittweite halbiert sich mit jeder Halbierung des Rests
+      const double remaining = 100.0 - percentile;
+      const double halvings = std::floor(std::log2(100.0 / remaining)) + 1;
+      percentile += 100.0 / (std::pow(2.0, halvings) * ticksPerHalfDistance);
+      if (percentile >= 100.0) percentile = 100.0;
+    }
+    std::fprintf(out, "#[Mean    = %12.3f, StdDeviation   = %12.3f]\n", mean() / scale, stdDeviation() / scale);
+    std::fprintf(out, "#[Max     = %12.3f, Total count    = %12llu]\n", (double) max_ / scale, (unsigned long long) total_);
+  }
+};
+
+#endif // HdrHistogram_hpp
@@ -0,0 +1,87 @@
+#include "JwksContentionBench.hpp"
+
+#include "auth/JwtVerifier.hpp"
+#include "app/TestKeys.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr auto kDuration = std::chrono::milliseconds(1000);
+
+/**
+ * op() so oft wie möglich auf `threads` Threads für kDuration ausführen, Ops/s zurückgeben.
+ */
+double opsPerSecond(unsigned threads, const std::function<void()>& op) {
+  std::atomic<bool> go{false};
+  std::atomic<bool> stop{false};
+  std::vector<std::uint64_t> counts(threads, 0);
+  std::vector<std::thread> workers;
+  for (unsigned t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+      std::uint64_t n = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        op();
+        ++n;
+      }
+      counts[t] = n;
+    });
+  }
+  const auto start = std::chrono::steady_clock::now();
+  go.store(true, std::memory_order_release);
+  std::this_thread::sleep_for(kDuration);
+  stop.store(true);
+  for (auto& w : workers) w.join();
+  const auto secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::uint64_t total = 0;
+  for (auto c : counts) total += c;
+  return (double) total / secs;
+}
+
+std::vector<unsigned> threadCounts() {
+  const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<unsigned> out;
+  for (unsigned t = 1; t < cores; t *= 2) out.push_back(t);
+  out.push_back(cores);
+  return out;
+}
+
+void report(const char* name, const std::function<void()>& op) {
+  std::printf("\n%s\n", name);
+  std::printf("%8s %16s %10s\n", "threads", "ops/s", "scaling");
+  double base = 0;
+  for (auto t : threadCounts()) {
+    const auto ops = opsPerSecond(t, op);
+    if (base == 0) base = ops;
+    std::printf("%8u %16.0f %9.2fx\n", t, ops, ops / base);
+  }
+}
+
+}
+
+void runJwksContentionBench() {
+  TestKeys keys;
+  auto cfg = TestKeys::config();
+  cfg->tokenCacheSize = 0; // jede Verifikation prüft die Signatur
+
+  JwtVerifier verifier(cfg);
+  verifier.jwks().load(keys.jwks(), 60);
+  const auto token = keys.sign(*cfg, "bench-user");
+  const auto& kid = keys.kid();
+
+  report("JwksCache::getKey", [&] {
+    auto key = verifier.jwks().getKey(kid, cfg->jwksCacheMinutes);
+    (void) key;
+  });
+
+  report("JwtVerifier::verify (secure endpoint auth, no token cache)", [&] {
+    auto claims = verifier.verify(token);
+    (void) claims;
+  });
+}
@@ -0,0 +1,12 @@
+#ifndef JwksContentionBench_hpp
+#define JwksContentionBench_hpp
+
+/**
+ * Contention-Benchmark für den Auth-Pfad geschützter Endpoints (/api/secure/).
+ * - JwksCache::getKey mit 1..N Threads (lock-freier Snapshot-Lesepfad)
+ * - JwtVerifier::verify ohne TokenCache (volle Signaturprüfung pro Request)
+ * Ausgabe: Ops/s gesamt und Skalierung relativ zu einem Thread.
+ */
+void runJwksContentionBench();
+
+#endif // JwksContentionBench_hpp
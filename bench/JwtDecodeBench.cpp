@@ -0,0 +1,47 @@
+#include "JwtDecodeBench.hpp"
+#include "BenchHarness.hpp"
+
+#include "auth/JwtVerifier.hpp"
+#include "app/TestKeys.hpp"
+
+#include <vector>
+
+void runJwtDecodeBench() {
+  TestKeys keys;
+  auto cfg = TestKeys::config();
+  cfg->tokenCacheSize = 0;
+
+  JwtVerifier verifier(cfg);
+  verifier.jwks().load(keys.jwks(), 60);
+  const auto token = keys.sign(*cfg, "bench-user");
+  const std::string_view payload = std::string_view(token).substr(token.find('.') + 1,
+    token.rfind('.') - token.find('.') - 1);
+
+  std::vector<std::uint8_t> buf(base64url::decodedSize(payload.size()));
+  std::size_t written = 0;
+  volatile std::size_t sink = 0;
+
+  bench::printHeader("JWT decode paths (jwt-cpp vs. JwtFastDecoder)");
+
+  bench::run("base64url payload, scalar", [&] { base64url::decodeScalar(payload, buf.data(), written); sink = written; });
+  bench::run("base64url payload, SIMD", [&] { base64url::decode(payload, buf.data(), written); sink = written; });
+
+  bench::run("decode only, jwt::decode", [&] {
+    auto decoded = jwt::decode<jwt::traits::kazuho_picojson>(token);
+    sink = decoded.get_key_id().size();
+  });
+  bench::run("decode only, JwtFastDecoder", [&] {
+    FastJwt jwt;
+    JwtFastDecoder::decode(token, jwt);
+    sink = jwt.kid.size();
+  });
+
+  bench::run("verify (no token cache), JwtCpp", [&] {
+    sink = verifier.verifyUncached(token, JwtVerifier::DecodePath::JwtCpp)->expiresAt;
+  }, 8);
+  bench::run("verify (no token cache), Fast", [&] {
+    sink = verifier.verifyUncached(token, JwtVerifier::DecodePath::Fast)->expiresAt;
+  }, 8);
+
+  (void) sink;
+}
@@ -0,0 +1,12 @@
+#ifndef JwtDecodeBench_hpp
+#define JwtDecodeBench_hpp
+
+/**
+ * Vergleich der beiden Decode-Pfade von JwtVerifier (ein Thread, BenchHarness).
+ * - base64url: skalar vs. SIMD
+ * - nur Decode: jwt::decode (picojson-DOM) vs. JwtFastDecoder (lazy Claims)
+ * - volle Prüfung ohne TokenCache: verifyUncached(JwtCpp) vs. verifyUncached(Fast)
+ */
+void runJwtDecodeBench();
+
+#endif // JwtDecodeBench_hpp
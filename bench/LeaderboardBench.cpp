@@ -0,0 +1,124 @@
+#include "LeaderboardBench.hpp"
+#include "BenchHarness.hpp"
+
+#include "model/Leaderboard.hpp"
+#include "model/Student.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kStudents = 1'000'000;
+
+struct Row {
+  std::int32_t id;
+  double gpa;
+  std::string firstName;
+  std::string lastName;
+};
+
+std::vector<Row> makeRows(std::size_t n) {
+  std::mt19937 rng(5);
+  std::vector<Row> rows(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    rows[i] = {(std::int32_t) i + 1, 1.0 + (double) (rng() % 301) / 100.0,
+               "Vorname" + std::to_string(rng() % 5000), "Nachname" + std::to_string(rng() % 20000)};
+  }
+  return rows;
+}
+
+template<typename F>
+double ms(F&& f) {
+  const auto t0 = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+}
+
+void runLeaderboardBench() {
+  const auto rows = makeRows(kStudents);
+  const auto threads = std::max(1u, std::thread::hardware_concurrency());
+
+  std::printf("\nFull ranking (%zu students, GPA desc, name asc)\n", kStudents);
+  std::printf("%-44s %12s\n", "variant", "ms");
+
+  {
+    auto copy = rows;
+    std::printf("%-44s %12.1f\n", "std::sort, concatenated names (old)", ms([&] {
+      std::sort(copy.begin(), copy.end(), [](const Row& a, const Row& b) {
+        if (a.gpa != b.gpa) return a.gpa > b.gpa;
+        return a.firstName + " " + a.lastName < b.firstName + " " + b.lastName;
+      });
+    }));
+  }
+  {
+    auto copy = rows;
+    std::printf("%-44s %12.1f\n", "std::sort, field-wise names (Student now)", ms([&] {
+      std::sort(copy.begin(), copy.end(), [](const Row& a, const Row& b) {
+        if (a.gpa != b.gpa) return a.gpa > b.gpa;
+        return model::Student::compareFullName(a.firstName, a.lastName, b.firstName, b.lastName) < 0;
+      });
+    }));
+  }
+
+  model::Leaderboard board;
+  const auto fillMs = ms([&] {
+    for (const auto& r : rows) board.upsert(r.id, r.gpa, r.firstName + " " + r.lastName);
+  });
+
+  std::printf("%-44s %12.1f\n", "Leaderboard::ranking, std::sort", ms([&] { board.ranking(nullptr); }));
+  WorkerPool pool(threads - 1); // + aufrufender Thread
+  char label[64];
+  std::snprintf(label, sizeof(label), "Leaderboard::ranking, parallelSort (%zu thr)", pool.size() + 1);
+  std::printf("%-44s %12.1f\n", label, ms([&] { board.ranking(&pool); }));
+  std::printf("%-44s %12.1f  (%.0f ns/upsert)\n", "Leaderboard fill (upsert all)", fillMs, fillMs * 1e6 / kStudents);
+  {
+    // sortierter Import: jeder neue Name landet in derselben Lücke am Ende
+    constexpr std::int32_t kSorted = 200000;
+    model::Leaderboard sorted;
+    char name[32];
+    const auto sortedMs = ms([&] {
+      for (std::int32_t id = 1; id <= kSorted; ++id) {
+        std::snprintf(name, sizeof(name), "Student %08d", id);
+        sorted.upsert(id, 3.0, name);
+      }
+    });
+    std::printf("%-44s %12.1f  (%.0f ns/upsert)\n", "Leaderboard fill, 200k names in sorted order", sortedMs,
+                sortedMs * 1e6 / kSorted);
+  }
+
+  std::mt19937 rng(9);
+  std::size_t i = 0;
+  volatile std::size_t sink = 0;
+  bench::printHeader("Leaderboard queries/updates (1M students)");
+  bench::run("top(10)", [&] { sink = board.top(10).size(); });
+  bench::run("top(100)", [&] { sink = board.top(100).size(); });
+  bench::run("top(1000)", [&] { sink = board.top(1000).size(); }, 8);
+  bench::run("upsert (GPA change, random student)", [&] {
+    const auto& r = rows[(i++ * 7919) % kStudents];
+    board.upsert(r.id, 1.0 + (double) (rng() % 301) / 100.0, r.firstName + " " + r.lastName);
+  });
+  bench::run("upsert (best drops out) + top(1000)", [&] {
+    const auto best = board.top(1)[0];
+    const auto& r = rows[(std::size_t) best - 1];
+    board.upsert(best, 0.5, r.firstName + " " + r.lastName);
+    sink = board.top(1000).size();
+  }, 8);
+
+  std::vector<model::Leaderboard::Entry> keys;
+  keys.reserve(kStudents);
+  for (const auto& r : rows) keys.push_back({model::Leaderboard::gpaKey(r.gpa), r.id});
+  auto scratch = keys;
+  bench::run("partial_sort top 10 over all keys", [&] {
+    scratch = keys;
+    std::partial_sort(scratch.begin(), scratch.begin() + 10, scratch.end());
+    sink = (std::size_t) scratch[0].id;
+  }, 1, 2);
+  (void) sink;
+}
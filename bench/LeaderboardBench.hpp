@@ -0,0 +1,13 @@
+#ifndef LeaderboardBench_hpp
+#define LeaderboardBench_hpp
+
+/**
+ * Rangliste nach GPA/Name.
+ * - volle Sortierung: Vergleich über zusammengesetzte Namen (altes Student::operator<), Vergleich Feld für Feld,
+ *   gepackter Schlüssel mit std::sort und mit Leaderboard::parallelSort (WorkerPool)
+ * - Befüllen in zufälliger und in sortierter Namensreihenfolge (lokale Neuverteilung der Labels)
+ * - top(k) aus dem geordneten Index gegen partial_sort über alle Schlüssel, upsert-Kosten, auch wenn die Spitze wechselt
+ */
+void runLeaderboardBench();
+
+#endif // LeaderboardBench_hpp
@@ -0,0 +1,283 @@
+#include "HdrHistogram.hpp"
+
+#include "AppComponent.hpp"
+#include "AppControllers.hpp"
+
+#include "app/JwksStandIn.hpp"
+#include "app/MyApiTestClient.hpp"
+#include "app/TestKeys.hpp"
+
+#include "oatpp/network/virtual_/client/ConnectionProvider.hpp"
+#include "oatpp/network/Server.hpp"
+#include "oatpp/web/client/HttpRequestExecutor.hpp"
+#include "oatpp/Environment.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Lastgenerator: kompletter AppComponent-Stack (Router, AuthInterceptor, JwtVerifier, Connection-Handler
+ * des SERVER_MODE) in-process über das oatpp-virtual_::Interface, also ohne Kernel-TCP im Messpfad.
+ * - N Client-Threads mit je einer Keep-Alive-Verbindung, Request-Mix gewichtet
+ * - Tokens signiert ein lokaler Schlüssel, JWKS liefert JwksStandIn (offline)
+ * - Ausgabe: Durchsatz + Perzentile pro Endpoint, HDR-Verteilung (.hgrm) über alle Requests
+ *
+ * Aufruf: my-project-loadgen [concurrency=16] [duration=10] [warmup=2] [mix=root:1,public:1,secure:2]
+ *                            [tokens=1] [hgrm=<datei>]
+ * Mix-Einträge: root (/), public (/api/public/ping), secure (/api/secure/ping mit Token),
+ *               anonymous (/api/secure/ping ohne Token → 401)
+ */
+namespace {
+
+constexpr const char* kVirtualHost = "loadgen";
+
+enum class Target { Root, Public, Secure, Anonymous };
+constexpr std::size_t kTargetCount = 4;
+constexpr const char* kTargetNames[kTargetCount] = {"root", "public", "secure", "anonymous"};
+constexpr v_int32 kExpectedStatus[kTargetCount] = {200, 200, 200, 401};
+
+struct Options {
+  std::size_t concurrency = 16;
+  double durationSeconds = 10;
+  double warmupSeconds = 2;
+  std::string mix = "root:1,public:1,secure:2";
+  std::size_t tokens = 1;
+  std::string hgrm;
+};
+
+Options parse(int argc, const char* argv[]) {
+  Options o;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const auto eq = arg.find('=');
+    const auto key = arg.substr(0, eq);
+    const auto value = eq == std::string::npos ? std::string() : arg.substr(eq + 1);
+    if (key == "concurrency") o.concurrency = (std::size_t) std::max(1, std::atoi(value.c_str()));
+    else if (key == "duration") o.durationSeconds = std::max(0.1, std::atof(value.c_str()));
+    else if (key == "warmup") o.warmupSeconds = std::max(0.0, std::atof(value.c_str()));
+    else if (key == "mix") o.mix = value;
+    else if (key == "tokens") o.tokens = (std::size_t) std::max(1, std::atoi(value.c_str()));
+    else if (key == "hgrm") o.hgrm = value;
+    else throw std::runtime_error("unknown option '" + key + "'");
+  }
+  return o;
+}
+
+/*
+ * "root:1,secure:3" → Sequenz, in der jeder Endpoint gemäß Gewicht vorkommt (deterministisch, ohne RNG im Messpfad).
+ */
+std::vector<Target> parseMix(const std::string& mix) {
+  std::vector<Target> schedule;
+  std::size_t pos = 0;
+  while (pos < mix.size()) {
+    auto end = mix.find(',', pos);
+    if (end == std::string::npos) end = mix.size();
+    const auto item = mix.substr(pos, end - pos);
+    pos = end + 1;
+    if (item.empty()) continue;
+    const auto colon = item.find(':');
+    const auto name = item.substr(0, colon);
+    const int weight = colon == std::string::npos ? 1 : std::atoi(item.c_str() + colon + 1);
+    std::size_t t = 0;
+    while (t < kTargetCount && name != kTargetNames[t]) ++t;
+    if (t == kTargetCount) throw std::runtime_error("unknown mix entry '" + name + "'");
+    for (int w = 0; w < weight; ++w) schedule.push_back((Target) t);
+  }
+  if (schedule.empty()) throw std::runtime_error("empty mix");
+  return schedule;
+}
+
+struct ClientStats {
+  std::vector<HdrHistogram> latency = std::vector<HdrHistogram>(kTargetCount);
+  std::uint64_t errors[kTargetCount] = {};
+  std::uint64_t reconnects = 0;
+};
+
+class LoadClient {
+private:
+  std::shared_ptr<MyApiTestClient> m_client;
+  std::shared_ptr<oatpp::web::client::RequestExecutor::ConnectionHandle> m_connection;
+public:
+
+  LoadClient(const std::shared_ptr<oatpp::network::ClientConnectionProvider>& provider,
+             const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& mapper)
+    : m_client(MyApiTestClient::createShared(oatpp::web::client::HttpRequestExecutor::createShared(provider), mapper))
+  {}
+
+  /*
+   * Ein Request inkl. Body-Lesen; Statuscode oder -1 bei Verbindungsfehler (nächster Request verbindet neu).
+   */
+  v_int32 call(Target target, const oatpp::String& authorization, std::uint64_t& reconnects) {
+    try {
+      if (!m_connection) {
+        m_connection = m_client->getConnection();
+        ++reconnects;
+      }
+      std::shared_ptr<oatpp::web::protocol::http::incoming::Response> response;
+      switch (target) {
+        case Target::Root: response = m_client->getRoot(m_connection); break;
+        case Target::Public: response = m_client->getPublicPing(m_connection); break;
+        case Target::Secure: response = m_client->getSecurePing(authorization, m_connection); break;
+        case Target::Anonymous: response = m_client->getSecurePingAnonymous(m_connection); break;
+      }
+      response->readBodyToString(); // Verbindung für den nächsten Request freimachen
+      return response->getStatusCode();
+    } catch (const std::exception&) {
+      m_connection.reset();
+      return -1;
+    }
+  }
+
+};
+
+double toMicros(std::int64_t ns) {
+  return (double) ns / 1000.0;
+}
+
+void printRow(const char* name, const HdrHistogram& h, std::uint64_t errors, double seconds) {
+  std::printf("%-10s %10llu %8llu %12.0f %9.1f %9.1f %9.1f %9.1f %10.1f\n", name,
+              (unsigned long long) h.count(), (unsigned long long) errors, (double) h.count() / seconds,
+              toMicros(h.valueAtPercentile(50)), toMicros(h.valueAtPercentile(90)),
+              toMicros(h.valueAtPercentile(99)), toMicros(h.valueAtPercentile(99.9)), toMicros(h.max()));
+}
+
+void run(const Options& options) {
+  const auto schedule = parseMix(options.mix);
+
+  /* Lokaler IdP: Schlüssel + JWKS, AppComponent liest die Auth-Konfiguration aus ENV */
+  TestKeys keys;
+  JwksStandIn idp(keys.jwks()); // Port vom Kernel
+  const auto authCfg = TestKeys::config(idp.url());
+  setenv("KEYCLOAK_ISSUER", authCfg->issuer.c_str(), 1);
+  setenv("KEYCLOAK_JWKS_URL", authCfg->jwksUrl.c_str(), 1);
+  setenv("KEYCLOAK_AUDIENCE", authCfg->audience.c_str(), 1);
+  setenv("SECURE_PATH_PREFIXES", "/api/secure/", 1);
+  setenv("SERVER_VIRTUAL_HOST", kVirtualHost, 1);
+
+  std::vector<oatpp::String> tokens;
+  for (std::size_t i = 0; i < options.tokens; ++i) {
+    tokens.push_back("Bearer " + keys.sign(*authCfg, "load-user-" + std::to_string(i)));
+  }
+
+  AppComponent components;
+  addAppControllers();
+
+  OATPP_COMPONENT(std::shared_ptr<ServerConfig>, serverConfig);
+  OATPP_COMPONENT(std::shared_ptr<oatpp::network::ServerConnectionProvider>, serverProvider);
+  OATPP_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, connectionHandler);
+  OATPP_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, mappers);
+
+  oatpp::network::Server server(serverProvider, connectionHandler);
+  std::thread serverThread([&server] { server.run(); });
+
+  auto clientProvider = oatpp::network::virtual_::client::ConnectionProvider::createShared(
+    oatpp::network::virtual_::Interface::obtainShared(kVirtualHost));
+  const auto mapper = mappers->getMapper("application/json");
+
+  /* Bereit, sobald der JWKS geladen ist (im Async-Modus liefert der Interceptor bis dahin 503) */
+  {
+    LoadClient probe(clientProvider, mapper);
+    std::uint64_t ignored = 0;
+    for (int i = 0; i < 500 && probe.call(Target::Secure, tokens[0], ignored) != 200; ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+
+  std::printf("\nload: %s mode, concurrency=%zu, duration=%.1fs (+%.1fs warmup), mix=%s, tokens=%zu\n\n",
+              serverConfig->modeName(), options.concurrency, options.durationSeconds, options.warmupSeconds,
+              options.mix.c_str(), options.tokens);
+
+  std::atomic<bool> recording{false};
+  std::atomic<bool> stopping{false};
+  std::vector<ClientStats> stats(options.concurrency);
+  std::vector<std::thread> clients;
+  for (std::size_t c = 0; c < options.concurrency; ++c) {
+    clients.emplace_back([&, c] {
+      LoadClient client(clientProvider, mapper);
+      auto& s = stats[c];
+      std::size_t step = c; // versetzt starten, damit nicht alle Clients gleichzeitig denselben Endpoint treffen
+      while (!stopping.load(std::memory_order_relaxed)) {
+        const auto target = schedule[step % schedule.size()];
+        const auto& token = tokens[(step / schedule.size() + c) % tokens.size()];
+        ++step;
+        const auto start = std::chrono::steady_clock::now();
+        const auto status = client.call(target, token, s.reconnects);
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        if (!recording.load(std::memory_order_relaxed)) continue;
+        const auto t = (std::size_t) target;
+        s.latency[t].record(ns);
+        if (status != kExpectedStatus[t]) ++s.errors[t];
+      }
+    });
+  }
+
+  std::this_thread::sleep_for(std::chrono::duration<double>(options.warmupSeconds));
+  recording = true;
+  const auto measureStart = std::chrono::steady_clock::now();
+  std::this_thread::sleep_for(std::chrono::duration<double>(options.durationSeconds));
+  recording = false;
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - measureStart).count();
+  stopping = true;
+  for (auto& t : clients) t.join();
+
+  server.stop();
+  serverProvider->stop();
+  connectionHandler->stop();
+  serverThread.join();
+
+  /* Auswertung: Histogramme der Threads zusammenführen */
+  HdrHistogram total;
+  std::uint64_t totalErrors = 0;
+  std::uint64_t reconnects = 0;
+  std::printf("%-10s %10s %8s %12s %9s %9s %9s %9s %10s\n",
+              "endpoint", "requests", "errors", "req/s", "p50 µs", "p90 µs", "p99 µs", "p99.9 µs", "max µs");
+  for (std::size_t t = 0; t < kTargetCount; ++t) {
+    HdrHistogram h;
+    std::uint64_t errors = 0;
+    for (const auto& s : stats) {
+      h.add(s.latency[t]);
+      errors += s.errors[t];
+    }
+    if (h.count() == 0) continue;
+    printRow(kTargetNames[t], h, errors, seconds);
+    total.add(h);
+    totalErrors += errors;
+  }
+  for (const auto& s : stats) reconnects += s.reconnects;
+  printRow("total", total, totalErrors, seconds);
+  std::printf("\nconnections opened: %llu\n\n", (unsigned long long) reconnects);
+
+  if (options.hgrm.empty()) {
+    total.printPercentiles(stdout);
+  } else if (std::FILE* f = std::fopen(options.hgrm.c_str(), "w")) {
+    total.printPercentiles(f);
+    std::fclose(f);
+    std::printf("latency distribution (µs) written to %s\n", options.hgrm.c_str());
+  } else {
+    throw std::runtime_error("cannot write " + options.hgrm);
+  }
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+
+  oatpp::Environment::init();
+
+  int rc = 0;
+  try {
+    run(parse(argc, argv));
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "loadgen: %s\n", e.what());
+    rc = 1;
+  }
+
+  oatpp::Environment::destroy();
+  return rc;
+}
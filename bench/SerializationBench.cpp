@@ -0,0 +1,24 @@
+#include "SerializationBench.hpp"
+#include "BenchHarness.hpp"
+
+#include "dto/DTOs.hpp"
+
+#include "oatpp/json/ObjectMapper.hpp"
+
+void runSerializationBench() {
+  auto dto = MyDto::createShared();
+  dto->statusCode = 200;
+  dto->message = "Hello World!";
+
+  oatpp::json::ObjectMapper compact;
+  oatpp::json::ObjectMapper pretty;
+  pretty.serializerConfig().json.useBeautifier = true;
+
+  volatile v_buff_size sink = 0;
+
+  bench::printHeader("MyDto JSON serialization");
+  bench::run("writeToString, compact", [&] { sink = compact.writeToString(dto)->size(); });
+  bench::run("writeToString, beautifier", [&] { sink = pretty.writeToString(dto)->size(); });
+
+  (void) sink;
+}
@@ -0,0 +1,9 @@
+#ifndef SerializationBench_hpp
+#define SerializationBench_hpp
+
+/**
+ * MyDto → JSON mit oatpp::json::ObjectMapper, mit und ohne Beautifier (ein Thread, BenchHarness).
+ */
+void runSerializationBench();
+
+#endif // SerializationBench_hpp
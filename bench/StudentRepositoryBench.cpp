@@ -0,0 +1,113 @@
+#include "StudentRepositoryBench.hpp"
+#include "BenchHarness.hpp"
+
+#include "model/StudentRepository.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr std::int32_t kRecords = 1'000'000;
+
+model::StudentRecord makeRecord(std::int32_t id) {
+  static const char* universities[] = {"TU Berlin", "LMU", "RWTH Aachen"};
+  auto& symbols = model::SymbolTable::global();
+  model::StudentRecord r;
+  r.id = id;
+  r.firstName = "Vorname" + std::to_string(id % 5000);
+  r.lastName = "Nachname" + std::to_string(id % 20000);
+  r.age = 18 + id % 15;
+  r.gpa = 1.0 + (id % 300) / 100.0;
+  r.university = symbols.intern(universities[id % 3]);
+  r.courses.add(symbols.intern("Analysis"));
+  r.courses.add(symbols.intern("Lineare Algebra"));
+  return r;
+}
+
+template<typename Fill>
+double insertMs(Fill&& fill) {
+  const auto t0 = std::chrono::steady_clock::now();
+  fill();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+}
+
+void runStudentRepositoryBench() {
+  std::vector<model::StudentRecord> input;
+  input.reserve(kRecords);
+  for (std::int32_t id = 1; id <= kRecords; ++id) input.push_back(makeRecord(id));
+
+  std::printf("\nStudentRepository insert (%d records)\n", kRecords);
+  std::printf("%-44s %12s %14s\n", "variant", "ms", "inserts/s");
+  auto row = [](const char* name, double ms) {
+    std::printf("%-44s %12.1f %14.0f\n", name, ms, kRecords / ms * 1e3);
+  };
+
+  {
+    model::StudentRepository repo;
+    row("StudentRepository", insertMs([&] { for (const auto& r : input) repo.create(r); }));
+  }
+  {
+    std::unordered_map<std::int32_t, model::StudentRecord> map;
+    row("unordered_map", insertMs([&] { for (const auto& r : input) map.emplace(r.id, r); }));
+  }
+  {
+    model::StudentRepository repo;
+    row("StudentRepository + reserve", insertMs([&] {
+      repo.reserve(kRecords);
+      for (const auto& r : input) repo.create(r);
+    }));
+  }
+
+  model::StudentRepository repo;
+  repo.reserve(kRecords);
+  std::unordered_map<std::int32_t, model::StudentRecord> map;
+  map.reserve(kRecords);
+  for (const auto& r : input) {
+    repo.create(r);
+    map.emplace(r.id, r);
+  }
+  input.clear();
+  input.shrink_to_fit();
+
+  // zufällige IDs vorab, damit der Generator nicht mitgemessen wird
+  std::mt19937 rng(42);
+  std::vector<std::int32_t> hits(1 << 16);
+  std::vector<std::int32_t> misses(1 << 16);
+  for (auto& id : hits) id = 1 + (std::int32_t) (rng() % kRecords);
+  for (auto& id : misses) id = kRecords + 1 + (std::int32_t) (rng() % kRecords);
+  std::size_t i = 0;
+  volatile double sink = 0;
+
+  bench::printHeader("StudentRepository lookup (random id, 1M records)");
+  bench::run("read() hit, no copy", [&] {
+    repo.read(hits[i++ & 0xFFFF], [&](const model::StudentRecord& r) { sink = r.gpa; });
+  });
+  bench::run("find() hit, copy", [&] {
+    sink = repo.find(hits[i++ & 0xFFFF])->gpa;
+  });
+  bench::run("unordered_map::find hit (no lock)", [&] {
+    sink = map.find(hits[i++ & 0xFFFF])->second.gpa;
+  });
+  bench::run("read() miss", [&] {
+    repo.read(misses[i++ & 0xFFFF], [&](const model::StudentRecord& r) { sink = r.gpa; });
+  });
+  bench::run("unordered_map::find miss (no lock)", [&] {
+    sink = map.find(misses[i++ & 0xFFFF]) == map.end() ? 0 : 1;
+  });
+  bench::run("page(offset, 50)", [&] {
+    repo.page((i++ * 50) % kRecords, 50, [&](const model::StudentRecord& r) { sink = r.gpa; });
+  }, 16);
+
+  std::size_t slots = 16; // wie IdIndex::reserve
+  while (slots * 7 < (std::size_t) kRecords * 10) slots <<= 1;
+  std::printf("\nsizeof(StudentRecord) = %zu bytes (+ heap for strings/courses), index = %.1f bytes/record\n",
+              sizeof(model::StudentRecord), 8.0 * (double) slots / kRecords);
+  (void) sink;
+}
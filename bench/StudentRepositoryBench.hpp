@@ -0,0 +1,12 @@
+#ifndef StudentRepositoryBench_hpp
+#define StudentRepositoryBench_hpp
+
+/**
+ * StudentRepository bei 1 Mio. Datensätzen, ein Thread, BenchHarness.
+ * - Einfügen (mit/ohne reserve) gegen std::unordered_map<id, StudentRecord>
+ * - Lookup per id: read() ohne Kopie, find() mit Kopie, unordered_map als Referenz; Treffer und Fehlgriffe
+ * - Speicher pro Datensatz (Array + Index) und Seiten à 50 Datensätzen
+ */
+void runStudentRepositoryBench();
+
+#endif // StudentRepositoryBench_hpp
@@ -0,0 +1,40 @@
+
+#include "AuthBench.hpp"
+#include "CompactStudentBench.hpp"
+#include "CompressionBench.hpp"
+#include "JwksContentionBench.hpp"
+#include "JwtDecodeBench.hpp"
+#include "LeaderboardBench.hpp"
+#include "SerializationBench.hpp"
+#include "StudentRepositoryBench.hpp"
+
+#include "oatpp/Environment.hpp"
+
+#include <cstring>
+#include <iostream>
+
+/**
+ * Benchmarks laufen offline (lokale Schlüssel, lokaler JWKS-Server, kein IdP nötig).
+ * Optional: Name eines Benchmarks als Argument, sonst alle.
+ */
+int main(int argc, const char* argv[]) {
+
+  oatpp::Environment::init();
+
+  const char* only = argc > 1 ? argv[1] : nullptr;
+  auto selected = [only](const char* name) { return !only || std::strcmp(only, name) == 0; };
+
+  if (selected("auth")) runAuthBench();
+  if (selected("serialization")) runSerializationBench();
+  if (selected("jwt-decode")) runJwtDecodeBench();
+  if (selected("jwks-contention")) runJwksContentionBench();
+  if (selected("compression")) runCompressionBench();
+  if (selected("student-repository")) runStudentRepositoryBench();
+  if (selected("leaderboard")) runLeaderboardBench();
+  if (selected("compact-student")) runCompactStudentBench();
+
+  std::cout << std::endl;
+
+  oatpp::Environment::destroy();
+  return 0;
+}
@@ -1,8 +1,7 @@
-#include "./controller/MyController.hpp"
 #include "./AppComponent.hpp"
-#include "./controller/MyAuthController.hpp"
+#include "./AppControllers.hpp"
 
-#include "oatpp/network/Server.hpp"
+#include "./server/MultiAcceptorServer.hpp"
 
 #include <iostream>
 
@@ -11,14 +10,10 @@ void run() {
   /* Register Components in scope of run() method */
   AppComponent components;
 
-  /* Get router component */
-  OATPP_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, router);
+  OATPP_COMPONENT(std::shared_ptr<ServerConfig>, serverConfig);
 
-  OATPP_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, mappers);
-
-  /* Create MyController and add all of its endpoints to router */
-  router->addController(std::make_shared<MyController>(mappers));
-   router->addController(std::make_shared<MyAuthController>(mappers));
+  /* Add controllers for the configured server mode to the router */
+  addAppControllers();
 
   /* Get connection handler component */
   OATPP_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, connectionHandler);
@@ -26,14 +21,24 @@ void run() {
   /* Get connection provider component */
   OATPP_COMPONENT(std::shared_ptr<oatpp::network::ServerConnectionProvider>, connectionProvider);
 
+  /* One listener per acceptor shard (SO_REUSEPORT), all on the port of the first one */
+  auto providers = ReusePortConnectionProvider::withShards(*serverConfig, connectionProvider);
+
   /* Create server which takes provided TCP connections and passes them to HTTP connection handler */
-  oatpp::network::Server server(connectionProvider, connectionHandler);
+  MultiAcceptorServer server(std::move(providers), connectionHandler);
 
   /* Print info about server port */
-  OATPP_LOGi("MyApp", "Server running on port {}", connectionProvider->getProperty("port").toString());
+  OATPP_LOGi("MyApp", "Server running on {}:{} ({} mode, {} acceptors)",
+             connectionProvider->getProperty("host").toString(), connectionProvider->getProperty("port").toString(),
+             serverConfig->modeName(), server.acceptors());
 
   /* Run server */
   server.run();
+
+  /* Print token cache effectiveness */
+  OATPP_COMPONENT(std::shared_ptr<JwtVerifier>, verifier);
+  const auto stats = verifier->tokenCacheStats();
+  OATPP_LOGi("MyApp", "Token cache: hits={}, misses={}, size={}", stats.hits, stats.misses, stats.size);
   
 }
 
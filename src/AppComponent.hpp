@@ -2,9 +2,12 @@
 #define AppComponent_hpp
 
 #include "oatpp/web/server/HttpConnectionHandler.hpp"
+#include "oatpp/web/server/AsyncHttpConnectionHandler.hpp"
 #include "oatpp/web/mime/ContentMappers.hpp"
 
-#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+#include "oatpp/network/virtual_/server/ConnectionProvider.hpp"
+#include "oatpp/network/virtual_/Interface.hpp"
+
 #include "oatpp/json/ObjectMapper.hpp"
 
 #include "oatpp/macro/component.hpp"
@@ -12,6 +15,19 @@
 #include "./auth/AuthConfig.hpp"
 #include "./auth/JwtVerifier.hpp"
 #include "./auth/AuthInterceptor.hpp"
+#include "./auth/AsyncAuthInterceptor.hpp"
+#include "./server/ServerConfig.hpp"
+#include "./server/ReusePortConnectionProvider.hpp"
+#include "./server/WorkerPoolConnectionHandler.hpp"
+#include "./server/PrettyJsonInterceptor.hpp"
+#include "./server/CompressionInterceptor.hpp"
+#include "./server/AdmissionController.hpp"
+#include "./util/WorkerPool.hpp"
+#include "./model/StudentRepository.hpp"
+#include "./metrics/ConnectionMetricsHandler.hpp"
+#include "./metrics/HttpMetrics.hpp"
+#include "./metrics/MetricsExporter.hpp"
+#include "./metrics/ServerTiming.hpp"
 
 /**
  *  Class which creates and holds Application components and registers components in oatpp::base::Environment
@@ -19,12 +35,39 @@
  */
 class AppComponent {
 public:
+
+  // ServerConfig aus ENV (SERVER_MODE=threaded|async)
+  OATPP_CREATE_COMPONENT(std::shared_ptr<ServerConfig>, serverConfig)([] {
+    return ServerConfig::fromEnv();
+  }());
+
+  /**
+   *  Executor for coroutines (only in async mode, nullptr otherwise)
+   */
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::async::Executor>, executor)([] {
+    OATPP_COMPONENT(std::shared_ptr<ServerConfig>, cfg);
+    if (cfg->mode != ServerConfig::Mode::Async) return std::shared_ptr<oatpp::async::Executor>();
+    return std::make_shared<oatpp::async::Executor>(
+      (v_int32) cfg->dataThreads(),        /* Data-Processing threads */
+      (v_int32) cfg->asyncIoThreads,       /* I/O threads */
+      (v_int32) cfg->asyncTimerThreads     /* Timer threads */
+    );
+  }());
   
   /**
-   *  Create ConnectionProvider component which listens on the port
+   *  Create ConnectionProvider component which listens on the configured host/port
+   *  (or on a virtual interface when SERVER_VIRTUAL_HOST is set)
    */
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ServerConnectionProvider>, serverConnectionProvider)([] {
-    return oatpp::network::tcp::server::ConnectionProvider::createShared({"0.0.0.0", 8000, oatpp::network::Address::IP_4});
+    OATPP_COMPONENT(std::shared_ptr<ServerConfig>, cfg);
+    if (!cfg->virtualHost.empty()) {
+      // In-Process ohne Kernel-TCP (Lastgenerator verbindet sich über dasselbe Interface)
+      auto iface = oatpp::network::virtual_::Interface::obtainShared(cfg->virtualHost);
+      return std::static_pointer_cast<oatpp::network::ServerConnectionProvider>(
+        oatpp::network::virtual_::server::ConnectionProvider::createShared(iface));
+    }
+    // SERVER_HOST/PORT/BACKLOG/DUAL_STACK; erster Shard bei SERVER_ACCEPTORS > 1 (weitere in App.cpp)
+    return std::static_pointer_cast<oatpp::network::ServerConnectionProvider>(ReusePortConnectionProvider::createShared(*cfg));
   }());
   
   /**
@@ -47,31 +90,163 @@ public:
   // JwtVerifier
   OATPP_CREATE_COMPONENT(std::shared_ptr<JwtVerifier>, jwtVerifier)([] {
     OATPP_COMPONENT(std::shared_ptr<AuthConfig>, cfg);
-    return std::make_shared<JwtVerifier>(cfg);
+    auto verifier = std::make_shared<JwtVerifier>(cfg);
+    verifier->jwks().startRefresher(); // JWKS im Hintergrund aktuell halten
+    return verifier;
   }());
   
+  // WorkerPool für parallele Signaturprüfung (Batch-Endpoint)
+  OATPP_CREATE_COMPONENT(std::shared_ptr<WorkerPool>, workerPool)([] {
+    OATPP_COMPONENT(std::shared_ptr<AuthConfig>, cfg);
+    const auto threads = cfg->verifyWorkers > 0 ? cfg->verifyWorkers : std::thread::hardware_concurrency();
+    return std::make_shared<WorkerPool>(threads);
+  }());
+
+  // AuthInterceptor (App meldet Controller mit Endpoint-Auth-Flags per protectEndpoints an);
+  // im Async-Modus die nicht-blockierende Variante
+  OATPP_CREATE_COMPONENT(std::shared_ptr<AuthInterceptor>, authInterceptor)([] {
+    OATPP_COMPONENT(std::shared_ptr<JwtVerifier>, verifier);
+    OATPP_COMPONENT(std::shared_ptr<ServerConfig>, cfg);
+    if (cfg->mode == ServerConfig::Mode::Async) {
+      return std::static_pointer_cast<AuthInterceptor>(std::make_shared<AsyncAuthInterceptor>(verifier));
+    }
+    return std::make_shared<AuthInterceptor>(verifier);
+  }());
+
+  // Request-Metriken pro Endpoint/Status (App meldet Controller per addEndpoints an)
+  OATPP_CREATE_COMPONENT(std::shared_ptr<HttpMetrics>, httpMetrics)([] {
+    return std::make_shared<HttpMetrics>();
+  }());
+
+  // Rangliste nach GPA, vom Repository bei jedem Schreiben mitgeführt
+  OATPP_CREATE_COMPONENT(std::shared_ptr<model::Leaderboard>, leaderboard)([] {
+    return std::make_shared<model::Leaderboard>();
+  }());
+
+  // Student-Datenhaltung (In-Memory, geteilt von allen Worker-Threads)
+  OATPP_CREATE_COMPONENT(std::shared_ptr<model::StudentRepository>, studentRepository)([] {
+    OATPP_COMPONENT(std::shared_ptr<model::Leaderboard>, leaderboard);
+    OATPP_COMPONENT(std::shared_ptr<ServerConfig>, cfg);
+    auto repository = std::make_shared<model::StudentRepository>(cfg->studentMaxRecords);
+    repository->setLeaderboard(leaderboard);
+    return repository;
+  }());
+
+  // Lastabwurf vor Auth (ADMISSION=static|adaptive, sonst nullptr)
+  OATPP_CREATE_COMPONENT(std::shared_ptr<AdmissionController>, admissionController)([] {
+    OATPP_COMPONENT(std::shared_ptr<ServerConfig>, cfg);
+    if (cfg->admission == ServerConfig::Admission::Off) return std::shared_ptr<AdmissionController>();
+    AdmissionController::Options options;
+    options.adaptive = cfg->admission == ServerConfig::Admission::Adaptive;
+    options.limit.initial = cfg->admissionLimit;
+    options.limit.min = cfg->admissionMinLimit;
+    options.limit.max = cfg->admissionMaxLimit;
+    options.limit.targetNs = (std::int64_t) cfg->admissionTargetLatencyMs * 1'000'000;
+    options.retryAfterSec = cfg->admissionRetryAfterSec;
+    for (const auto& [prefix, priority] : cfg->admissionPriorities) {
+      options.routes.emplace_back(prefix, AdmissionController::parsePriority(priority));
+    }
+    options.crossThread = cfg->mode == ServerConfig::Mode::Async;
+    return std::make_shared<AdmissionController>(options);
+  }());
+
   /**
    *  Create ConnectionHandler component which uses Router component to route requests
+   *  (wrapped in ConnectionMetricsHandler to count open connections)
    */
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, serverConnectionHandler)([] {
     OATPP_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, router); // get Router component
-    auto h = oatpp::web::server::HttpConnectionHandler::createShared(router);
+    OATPP_COMPONENT(std::shared_ptr<AuthInterceptor>, authInterceptor);
+    OATPP_COMPONENT(std::shared_ptr<HttpMetrics>, httpMetrics);
+    OATPP_COMPONENT(std::shared_ptr<AdmissionController>, admission);
+    OATPP_COMPONENT(std::shared_ptr<ServerConfig>, cfg);
 
+    // Reihenfolge Request: Metriken (Zeit inkl. Auth), Admission (vor jeder Token-Arbeit), Server-Timing, Auth,
+    // Ende der Kette; Response: Pretty-JSON auf Wunsch, Kompression (braucht den fertigen Body), Server-Timing,
+    // Admission (Slot frei), Metriken zuletzt (endgültiger Status)
+    const bool async = cfg->mode == ServerConfig::Mode::Async;
+    auto metricsInterceptor = std::make_shared<MetricsInterceptor>(httpMetrics, /*crossThread=*/async);
+    std::shared_ptr<metrics::ServerTimingInterceptor> timing;
+    if (cfg->serverTiming != ServerConfig::Timing::Off) {
+      timing = std::make_shared<metrics::ServerTimingInterceptor>(cfg->serverTiming == ServerConfig::Timing::Always);
+    }
+    auto pretty = std::make_shared<PrettyJsonInterceptor>();
+    std::shared_ptr<CompressionInterceptor> compressor;
+    if (!cfg->compression.empty()) {
+      compression::Options options;
+      for (const auto& name : cfg->compression) {
+        compression::Encoding e;
+        if (compression::parse(name, e)) options.encodings.push_back(e);
+      }
+      options.minSize = cfg->compressionMinSize;
+      options.level = cfg->compressionLevel;
+      options.brotliQuality = cfg->compressionBrotliQuality;
+      compressor = std::make_shared<CompressionInterceptor>(std::move(options));
+    }
+    auto addInterceptors = [&](const auto& h) {
+      h->addRequestInterceptor(metricsInterceptor);
+      if (admission) h->addRequestInterceptor(admission);
+      if (timing) h->addRequestInterceptor(timing);
+      h->addRequestInterceptor(authInterceptor);
+      if (timing) h->addRequestInterceptor(metrics::ServerTimingInterceptor::chainEnd());
+      if (admission) h->addResponseInterceptor(admission); // zuerst: Slot frei, auch wenn ein späterer wirft
+      h->addResponseInterceptor(pretty);
+      if (compressor) h->addResponseInterceptor(compressor);
+      if (timing) h->addResponseInterceptor(timing);
+      h->addResponseInterceptor(metricsInterceptor);
+    };
+
+    std::shared_ptr<oatpp::network::ConnectionHandler> inner;
+    if (async) {
+      OATPP_COMPONENT(std::shared_ptr<oatpp::async::Executor>, executor);
+      auto h = oatpp::web::server::AsyncHttpConnectionHandler::createShared(router, executor);
+      addInterceptors(h);
+      inner = h;
+    } else if (cfg->mode == ServerConfig::Mode::Pool) {
+      WorkerPoolConnectionHandler::Config pool;
+      pool.workers = cfg->poolWorkers;
+      pool.queueDepth = cfg->poolQueueDepth;
+      pool.pinCpus = cfg->poolPinCpus;
+      pool.idleTimeoutMs = cfg->poolIdleTimeoutMs;
+      auto h = WorkerPoolConnectionHandler::createShared(router, pool);
+      addInterceptors(h);
+      inner = h;
+    } else {
+      auto h = oatpp::web::server::HttpConnectionHandler::createShared(router);
+      addInterceptors(h);
+      inner = h;
+    }
+
+    return std::static_pointer_cast<oatpp::network::ConnectionHandler>(ConnectionMetricsHandler::createShared(inner));
+  }());
+
+  // Prometheus-Export für /metrics
+  OATPP_CREATE_COMPONENT(std::shared_ptr<MetricsExporter>, metricsExporter)([] {
+    OATPP_COMPONENT(std::shared_ptr<HttpMetrics>, httpMetrics);
     OATPP_COMPONENT(std::shared_ptr<JwtVerifier>, verifier);
-    h->addRequestInterceptor(std::make_shared<AuthInterceptor>(verifier));
-    return std::static_pointer_cast<oatpp::network::ConnectionHandler>(h);
+    OATPP_COMPONENT(std::shared_ptr<AuthInterceptor>, authInterceptor);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, handler);
+    OATPP_COMPONENT(std::shared_ptr<AdmissionController>, admission);
+    return std::make_shared<MetricsExporter>(httpMetrics, verifier, authInterceptor,
+                                             std::static_pointer_cast<ConnectionMetricsHandler>(handler), admission);
   }());
   
   /**
    *  Create ObjectMapper component to serialize/deserialize DTOs in Contoller's API
    */
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, apiContentMappers)([] {
+    OATPP_COMPONENT(std::shared_ptr<ServerConfig>, cfg);
 
+    // kompaktes JSON; formatiert nur pro Request über ?pretty / Accept: ...; pretty=true (PrettyJsonInterceptor)
     auto json = std::make_shared<oatpp::json::ObjectMapper>();
-    json->serializerConfig().json.useBeautifier = true;
+    json->serializerConfig().json.useBeautifier = false;
 
     auto mappers = std::make_shared<oatpp::web::mime::ContentMappers>();
-    mappers->putMapper(json);
+    if (cfg->serverTiming != ServerConfig::Timing::Off) {
+      mappers->putMapper(std::make_shared<metrics::TimingObjectMapper>(json)); // Stage "serialize"
+    } else {
+      mappers->putMapper(json);
+    }
 
     return mappers;
 
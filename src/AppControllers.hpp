@@ -0,0 +1,79 @@
+#ifndef AppControllers_hpp
+#define AppControllers_hpp
+
+#include "./controller/MyController.hpp"
+#include "./controller/MyAuthController.hpp"
+#include "./controller/TokenController.hpp"
+#include "./controller/StudentController.hpp"
+#include "./controller/MyAsyncController.hpp"
+#include "./controller/MyAuthAsyncController.hpp"
+#include "./controller/MetricsController.hpp"
+#include "./controller/MetricsAsyncController.hpp"
+
+#include "./auth/AuthInterceptor.hpp"
+#include "./metrics/HttpMetrics.hpp"
+#include "./server/ServerConfig.hpp"
+
+#include "oatpp/macro/component.hpp"
+
+/**
+ *  Add the application's controllers to the router component and register their endpoints for metrics.
+ *  Shared by App.cpp and the load generator, so both run the same routes; AppComponent must be in scope.
+ */
+inline void addAppControllers() {
+
+  OATPP_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, router);
+  OATPP_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, mappers);
+  OATPP_COMPONENT(std::shared_ptr<AuthInterceptor>, authInterceptor);
+  OATPP_COMPONENT(std::shared_ptr<HttpMetrics>, httpMetrics);
+  OATPP_COMPONENT(std::shared_ptr<ServerConfig>, serverConfig);
+  OATPP_COMPONENT(std::shared_ptr<model::StudentRepository>, studentRepository);
+  OATPP_COMPONENT(std::shared_ptr<model::Leaderboard>, leaderboard);
+  OATPP_COMPONENT(std::shared_ptr<JwtVerifier>, verifier);
+  OATPP_COMPONENT(std::shared_ptr<WorkerPool>, workerPool);
+
+  auto add = [&](const std::shared_ptr<oatpp::web::server::api::ApiController>& controller) {
+    httpMetrics->addEndpoints(controller);
+    router->addController(controller);
+  };
+
+  /* /metrics nur auf Wunsch, standardmäßig nur mit Bearer Token (METRICS=protected|public|off) */
+  auto addMetrics = [&](const std::shared_ptr<oatpp::web::server::api::ApiController>& controller) {
+    if (serverConfig->metrics == ServerConfig::Metrics::Off) return;
+    if (serverConfig->metrics == ServerConfig::Metrics::Protected) authInterceptor->protectEndpoints(controller);
+    add(controller);
+  };
+
+  if (serverConfig->mode == ServerConfig::Mode::Async) {
+    /* Coroutine-based controllers for AsyncHttpConnectionHandler */
+    add(std::make_shared<MyAsyncController>(mappers));
+
+    auto authController = std::make_shared<MyAuthAsyncController>(mappers);
+    authInterceptor->protectEndpoints(authController); // Endpoint-Auth-Flags übernehmen
+    add(authController);
+
+    addMetrics(std::make_shared<MetricsAsyncController>(mappers));
+  } else {
+    /* Create MyController and add all of its endpoints to router */
+    add(std::make_shared<MyController>(mappers));
+
+    auto authController = std::make_shared<MyAuthController>(mappers);
+    authInterceptor->protectEndpoints(authController); // Endpoint-Auth-Flags übernehmen
+    add(authController);
+
+    /* Batch-Prüfung wartet auf den WorkerPool → nur mit synchronen Handlern (threaded/pool); nur mit Bearer Token */
+    auto tokenController = std::make_shared<TokenController>(mappers, verifier, workerPool);
+    authInterceptor->protectEndpoints(tokenController);
+    add(tokenController);
+
+    /* Student-CRUD (synchrone Handler; kurze Sperren, kein I/O), nur mit Bearer Token */
+    auto studentController = std::make_shared<StudentController>(mappers, studentRepository, leaderboard);
+    authInterceptor->protectEndpoints(studentController);
+    add(studentController);
+
+    addMetrics(std::make_shared<MetricsController>(mappers));
+  }
+
+}
+
+#endif /* AppControllers_hpp */
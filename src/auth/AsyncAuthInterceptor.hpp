@@ -0,0 +1,50 @@
+#pragma once
+#include "AuthInterceptor.hpp"
+#include <algorithm>
+#include <string>
+
+/**
+ * AsyncAuthInterceptor
+ * - Variante von AuthInterceptor für den Async-Modus (AsyncHttpConnectionHandler)
+ * - läuft auf Executor-Threads, blockiert daher nie auf einen JWKS-Fetch (verifyNonBlocking)
+ * - Schlüssel wird gerade (im Refresher) geladen → 503 mit Retry-After, Client versucht es erneut
+ * - kid bestätigt unbekannt (Negativ-Cache) oder Token ungültig → 401 wie im Thread-Modus
+ * - Rate-Limits (IP vorher, sub/azp nachher) wie im Thread-Modus
+ */
+class AsyncAuthInterceptor : public AuthInterceptor {
+  static std::shared_ptr<Response> keysPending(int retryAfterSec) {
+    auto r = oatpp::web::protocol::http::outgoing::ResponseFactory::createResponse(
+      Status::CODE_503, "Signing keys are being refreshed");
+    r->putHeader("Retry-After", std::to_string(retryAfterSec));
+    return r;
+  }
+
+public:
+  using AuthInterceptor::AuthInterceptor;
+
+  std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req) override {
+    if (!isProtected(*req)) {
+      return nullptr; // nicht geschützt → weiterreichen
+    }
+    if (auto limited = preLimit(*req)) return limited;
+
+    const auto tok = bearerOf(*req);
+    if (tok.empty()) {
+      count(Outcome::MissingToken);
+      return missingToken();
+    }
+
+    try {
+      const auto claims = verifier_->verifyNonBlocking(tok);
+      if (auto limited = subjectLimit(*claims)) return limited;
+      count(Outcome::Accepted);
+      return nullptr; // OK → weiterreichen
+    } catch (const JwksPendingError&) {
+      count(Outcome::KeysPending);
+      return keysPending(std::max(1, verifier_->config()->jwksMinRefreshSeconds));
+    } catch (const std::exception& e) {
+      count(Outcome::InvalidToken);
+      return invalidToken();
+    }
+  }
+};
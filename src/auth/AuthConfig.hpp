@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <cstdlib>
 #include <memory>
 #include <string>
@@ -10,6 +11,15 @@
  * - issuer / jwksUrl: Pflicht (sonst fail-fast in AppComponent)
  * - audience: optional, aber empfehlenswert
  * - securePathPrefixes: Pfade, die Auth benötigen (Default: "/api/secure/")
+ * - jwksMaxStaleMinutes: so lange nach Ablauf darf der letzte gute JWKS weiterverwendet werden
+ * - jwksMinRefreshSeconds: Mindestabstand erzwungener Reloads wegen unbekannter kids
+ * - jwksNegativeCacheSeconds: so lange wird ein unbekannter kid ohne Reload abgelehnt
+ * - tokenCacheSize: max. Anzahl verifizierter Tokens im Cache (0 = aus)
+ * - batchMaxTokens: max. Tokens pro Request an /api/tokens/verify (1 … 128)
+ * - verifyWorkers: Threads für parallele Signaturprüfung im Batch (0 = CPU-Kerne)
+ * - rateLimit{Ip,Sub,Azp}: Token Bucket (Requests/s, Burst; 0 = aus); Ip vor, Sub/Azp nach der Signaturprüfung
+ * - rateLimitMaxKeys: max. Buckets pro Limiter; rateLimitIpHeader: Client-IP aus diesem Header (letzter Eintrag,
+ *   z.B. X-Forwarded-For hinter einem Proxy) statt der Peer-Adresse der Verbindung
  */
 struct AuthConfig {
   std::string issuer;
@@ -17,7 +27,21 @@ struct AuthConfig {
   std::string audience; // optional
   int leewaySec = 60;
   int jwksCacheMinutes = 15;
+  int jwksMaxStaleMinutes = 60;
+  int jwksMinRefreshSeconds = 10;
+  int jwksNegativeCacheSeconds = 30;
+  std::size_t tokenCacheSize = 10000;
+  std::size_t batchMaxTokens = 32;
+  std::size_t verifyWorkers = 0;
   std::vector<std::string> securePathPrefixes;
+  double rateLimitIpRps = 0;
+  double rateLimitIpBurst = 0;
+  double rateLimitSubRps = 0;
+  double rateLimitSubBurst = 0;
+  double rateLimitAzpRps = 0;
+  double rateLimitAzpBurst = 0;
+  std::size_t rateLimitMaxKeys = 100000;
+  std::string rateLimitIpHeader;
 
   static std::shared_ptr<AuthConfig> fromEnv() {
     auto get = [](const char* k, const char* def = "") {
@@ -28,6 +52,10 @@ struct AuthConfig {
       const char* v = std::getenv(k);
       return v ? std::atoi(v) : def;
     };
+    auto getd = [](const char* k, double def) {
+      const char* v = std::getenv(k);
+      return v ? std::max(0.0, std::atof(v)) : def;
+    };
     auto splitCsv = [](const std::string& csv) {
       std::vector<std::string> out;
       std::stringstream ss(csv);
@@ -49,7 +77,21 @@ struct AuthConfig {
     c->audience         = get("KEYCLOAK_AUDIENCE");
     c->leewaySec        = geti("JWT_LEEWAY_SECONDS", 60);
     c->jwksCacheMinutes = geti("JWKS_CACHE_MINUTES", 15);
+    c->jwksMaxStaleMinutes = geti("JWKS_MAX_STALE_MINUTES", 60);
+    c->jwksMinRefreshSeconds = geti("JWKS_MIN_REFRESH_SECONDS", 10);
+    c->jwksNegativeCacheSeconds = geti("JWKS_NEGATIVE_CACHE_SECONDS", 30);
+    c->tokenCacheSize   = (std::size_t) std::max(0, geti("TOKEN_CACHE_SIZE", 10000));
+    c->batchMaxTokens   = (std::size_t) std::clamp(geti("VERIFY_BATCH_MAX_TOKENS", 32), 1, 128);
+    c->verifyWorkers    = (std::size_t) std::max(0, geti("VERIFY_WORKERS", 0));
     c->securePathPrefixes = splitCsv(get("SECURE_PATH_PREFIXES", "/api/secure/"));
+    c->rateLimitIpRps   = getd("RATE_LIMIT_IP_RPS", 0);
+    c->rateLimitIpBurst = getd("RATE_LIMIT_IP_BURST", 0);
+    c->rateLimitSubRps  = getd("RATE_LIMIT_SUB_RPS", 0);
+    c->rateLimitSubBurst = getd("RATE_LIMIT_SUB_BURST", 0);
+    c->rateLimitAzpRps  = getd("RATE_LIMIT_AZP_RPS", 0);
+    c->rateLimitAzpBurst = getd("RATE_LIMIT_AZP_BURST", 0);
+    c->rateLimitMaxKeys = (std::size_t) std::max(1, geti("RATE_LIMIT_MAX_KEYS", 100000));
+    c->rateLimitIpHeader = get("RATE_LIMIT_IP_HEADER");
     return c;
   }
 };
@@ -2,71 +2,236 @@
 #include <oatpp/web/server/interceptor/RequestInterceptor.hpp>
 #include <oatpp/web/protocol/http/Http.hpp>
 #include <oatpp/web/protocol/http/outgoing/ResponseFactory.hpp>
+#include <oatpp/web/server/api/ApiController.hpp>
 #include "JwtVerifier.hpp"
+#include "RateLimiter.hpp"
+#include "RouteMatcher.hpp"
+#include "metrics/ServerTiming.hpp"
+#include "metrics/Sharded.hpp"
+#include <array>
+#include <string>
+#include <string_view>
 
 /**
  * AuthInterceptor
  * - schützt Pfade (ENV: SECURE_PATH_PREFIXES) mit Bearer Token
+ * - optional pro Endpoint: ENDPOINT_INFO → info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME)
+ *   und Controller per protectEndpoints() anmelden
+ * - Schutzentscheidung: ein Trie-Lauf über die Pfad-Bytes, keine Allokation
+ * - Token bleibt eine View in den Header-Puffer bis in den TokenCache (Happy Path ohne Allokation)
  * - 401 bei fehlendem/ungültigem Token (WWW-Authenticate gesetzt)
  * - Claims können optional ins Request-Bundle gelegt werden
+ * - Ergebnisse geschützter Requests (akzeptiert / Grund der Ablehnung) als Sharded-Zähler für /metrics
+ * - Rate-Limits (AuthConfig, Token Bucket): pro Client-IP vor Bearer/Signatur (billiger Vorfilter),
+ *   pro sub und azp direkt nach der Prüfung; sonst 429 mit Retry-After und RateLimit-*-Headern
  */
 class AuthInterceptor : public oatpp::web::server::interceptor::RequestInterceptor {
+public:
+  enum class Outcome { Accepted, MissingToken, InvalidToken, KeysPending, RateLimited };
+  static constexpr std::size_t kOutcomes = 5;
+
+  static const char* outcomeName(Outcome o) {
+    switch (o) {
+      case Outcome::Accepted: return "accepted";
+      case Outcome::MissingToken: return "missing_token";
+      case Outcome::InvalidToken: return "invalid_token";
+      case Outcome::RateLimited: return "rate_limited";
+      default: return "keys_pending";
+    }
+  }
+
+protected:
+  using Request = oatpp::web::protocol::http::incoming::Request;
+  using Response = oatpp::web::protocol::http::outgoing::Response;
+  using Status = oatpp::web::protocol::http::Status;
+
   std::shared_ptr<JwtVerifier> verifier_;
+  RouteMatcher protected_;
+  std::array<metrics::ShardedCounter, kOutcomes> outcomes_;
+  RateLimiter ipLimit_;
+  RateLimiter subLimit_;
+  RateLimiter azpLimit_;
+  oatpp::String ipHeader_;
+
+  void count(Outcome o) noexcept { outcomes_[(std::size_t) o].add(); }
+
+  static std::string_view view(const oatpp::data::share::MemoryLabel& l) {
+    return std::string_view(static_cast<const char*>(l.getData()), (size_t) l.getSize());
+  }
 
-  static bool matchesAnyPrefix(const std::string& path, const std::vector<std::string>& prefixes) {
-    for (const auto& p : prefixes) {
-      if (path.rfind(p, 0) == 0) return true; // startsWith
+  bool isProtected(const Request& req) const {
+    const auto& path = req.getStartingLine().path;
+    return protected_.matches(std::string_view(static_cast<const char*>(path.getData()), (size_t) path.getSize()));
+  }
+
+  /*
+   * Token aus dem Authorization-Header als View direkt in den Header-Puffer des Requests
+   * (kein captureToOwnMemory wie bei getHeader()). Leer, wenn Header/Schema fehlt.
+   */
+  static std::string_view bearerOf(const Request& req) {
+    metrics::StageScope stage(metrics::Stage::Bearer);
+    const auto& headers = req.getHeaders().getAll_Unsafe();
+    auto h = headers.find("Authorization");
+    if (h == headers.end()) return {};
+    return extractBearer(std::string_view(static_cast<const char*>(h->second.getData()), (size_t) h->second.getSize()));
+  }
+
+  static std::shared_ptr<Response> missingToken() {
+    auto r = oatpp::web::protocol::http::outgoing::ResponseFactory::createResponse(
+      Status::CODE_401, "Missing or invalid Authorization header");
+    r->putHeader("WWW-Authenticate", "Bearer");
+    return r;
+  }
+
+  static std::shared_ptr<Response> tooManyRequests(const RateLimiter::Decision& d, const char* scope) {
+    auto r = oatpp::web::protocol::http::outgoing::ResponseFactory::createResponse(
+      Status::CODE_429, std::string("Rate limit exceeded (") + scope + ")");
+    r->putHeader("Retry-After", std::to_string(d.retryAfterSec));
+    r->putHeader("RateLimit-Limit", std::to_string(d.limit));
+    r->putHeader("RateLimit-Remaining", std::to_string(d.remaining));
+    r->putHeader("RateLimit-Reset", std::to_string(d.resetSec));
+    return r;
+  }
+
+  /*
+   * Client-Adresse als View: letzter Eintrag des konfigurierten Headers (vom eigenen Proxy angehängt) oder
+   * Peer-Adresse der Verbindung (Property "peer_address", ReusePortConnectionProvider). Fehlt der Header
+   * (z.B. direkter Zugriff am Proxy vorbei), gilt die Peer-Adresse. Leer, wenn unbekannt.
+   */
+  std::string_view clientAddress(Request& req) const {
+    if (ipHeader_) {
+      const auto& headers = req.getHeaders().getAll_Unsafe();
+      auto h = headers.find(ipHeader_);
+      if (h != headers.end()) {
+        auto v = view(h->second);
+        const auto comma = v.rfind(',');
+        if (comma != std::string_view::npos) v.remove_prefix(comma + 1);
+        while (!v.empty() && v.front() == ' ') v.remove_prefix(1);
+        while (!v.empty() && v.back() == ' ') v.remove_suffix(1);
+        if (!v.empty()) return v;
+      }
     }
-    return false;
+    const auto connection = req.getConnection();
+    if (!connection) return {};
+    const auto& properties = connection->getInputStreamContext().getProperties().getAll_Unsafe();
+    auto p = properties.find("peer_address");
+    return p == properties.end() ? std::string_view() : view(p->second);
   }
-  static std::string getBearer(const oatpp::String& header) {
-    if (!header) return {};
-    const std::string s = header->c_str();
-    const auto sp = s.find(' ');
-    if (sp == std::string::npos) return {};
-    auto scheme = s.substr(0, sp);
-    for (auto& c : scheme) c = (char)tolower(c);
-    if (scheme != "bearer") return {};
-    return s.substr(sp + 1);
+
+  /*
+   * Vorfilter pro Client-IP, vor Bearer-Parsing und Signaturprüfung. Ohne bekannte Adresse (z.B. virtual_) kein Limit.
+   */
+  std::shared_ptr<Response> preLimit(Request& req) {
+    if (!ipLimit_.enabled()) return nullptr;
+    const auto ip = clientAddress(req);
+    if (ip.empty()) return nullptr;
+    const auto d = ipLimit_.acquire(RateLimiter::hashAddress(ip));
+    if (d.allowed) return nullptr;
+    count(Outcome::RateLimited);
+    return tooManyRequests(d, "ip");
+  }
+
+  /*
+   * Limits pro sub und azp aus dem geprüften Token.
+   */
+  std::shared_ptr<Response> subjectLimit(const VerifiedClaims& claims) {
+    if (subLimit_.enabled() && !claims.subject.empty()) {
+      const auto d = subLimit_.acquire(RateLimiter::hashKey(claims.subject));
+      if (!d.allowed) {
+        count(Outcome::RateLimited);
+        return tooManyRequests(d, "sub");
+      }
+    }
+    if (azpLimit_.enabled() && !claims.authorizedParty.empty()) {
+      const auto d = azpLimit_.acquire(RateLimiter::hashKey(claims.authorizedParty));
+      if (!d.allowed) {
+        count(Outcome::RateLimited);
+        return tooManyRequests(d, "azp");
+      }
+    }
+    return nullptr;
+  }
+
+  static std::shared_ptr<Response> invalidToken() {
+    // Sicherheitsbewusst: keine Token-Inhalte loggen.
+    auto r = oatpp::web::protocol::http::outgoing::ResponseFactory::createResponse(
+      Status::CODE_401, "Unauthorized");
+    r->putHeader("WWW-Authenticate", "Bearer error=\"invalid_token\"");
+    return r;
   }
 
 public:
-  explicit AuthInterceptor(std::shared_ptr<JwtVerifier> v) : verifier_(std::move(v)) {}
+  static constexpr const char* SECURITY_SCHEME = "bearerAuth";
+
+  explicit AuthInterceptor(std::shared_ptr<JwtVerifier> v)
+    : verifier_(std::move(v))
+    , ipLimit_({verifier_->config()->rateLimitIpRps, verifier_->config()->rateLimitIpBurst}, verifier_->config()->rateLimitMaxKeys)
+    , subLimit_({verifier_->config()->rateLimitSubRps, verifier_->config()->rateLimitSubBurst}, verifier_->config()->rateLimitMaxKeys)
+    , azpLimit_({verifier_->config()->rateLimitAzpRps, verifier_->config()->rateLimitAzpBurst}, verifier_->config()->rateLimitMaxKeys)
+    , ipHeader_(verifier_->config()->rateLimitIpHeader.empty() ? oatpp::String() : oatpp::String(verifier_->config()->rateLimitIpHeader))
+  {
+    for (const auto& p : verifier_->config()->securePathPrefixes) {
+      protected_.addPrefix(p);
+    }
+  }
 
-  std::shared_ptr<oatpp::web::protocol::http::outgoing::Response>
-  intercept(const std::shared_ptr<oatpp::web::protocol::http::incoming::Request>& req) override {
-    const auto path = req->getStartingLine().path.toString();
-    const auto& cfg = *verifier_->config();
-    if (!matchesAnyPrefix(path, cfg.securePathPrefixes)) {
+  /**
+   * Token aus "Bearer <token>" (Schema case-insensitive), als View in den Header-Puffer.
+   * Leer, wenn Schema falsch oder kein Token vorhanden.
+   */
+  static std::string_view extractBearer(std::string_view header) {
+    static constexpr std::string_view scheme = "bearer";
+    if (header.size() <= scheme.size() || header[scheme.size()] != ' ') return {};
+    for (size_t i = 0; i < scheme.size(); ++i) {
+      if ((header[i] | 0x20) != scheme[i]) return {}; // ASCII tolower
+    }
+    auto tok = header.substr(scheme.size() + 1);
+    while (!tok.empty() && tok.front() == ' ') tok.remove_prefix(1);
+    while (!tok.empty() && tok.back() == ' ') tok.remove_suffix(1);
+    return tok;
+  }
+
+  /**
+   * Endpoints mit Security-Requirement SECURITY_SCHEME zusätzlich schützen.
+   * Vor dem Serverstart aufrufen (Matcher ist danach nur noch lesend).
+   */
+  void protectEndpoints(const std::shared_ptr<oatpp::web::server::api::ApiController>& controller) {
+    for (const auto& endpoint : controller->getEndpoints().list) {
+      const auto info = endpoint->info();
+      if (info && info->path && info->securityRequirements.count(SECURITY_SCHEME) > 0) {
+        protected_.addEndpointPath(*info->path);
+      }
+    }
+  }
+
+  std::int64_t outcomeCount(Outcome o) const noexcept { return outcomes_[(std::size_t) o].value(); }
+
+  std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req) override {
+    if (!isProtected(*req)) {
       return nullptr; // nicht geschützt → weiterreichen
     }
+    if (auto limited = preLimit(*req)) return limited;
 
-    const auto tok = getBearer(req->getHeader("authorization"));
+    const auto tok = bearerOf(*req);
     if (tok.empty()) {
-      auto r = oatpp::web::protocol::http::outgoing::ResponseFactory::createResponse(
-        oatpp::web::protocol::http::Status::CODE_401, "Missing or invalid Authorization header");
-      r->putHeader("WWW-Authenticate", "Bearer");
-      return r;
+      count(Outcome::MissingToken);
+      return missingToken();
     }
 
     try {
-      const auto decoded = verifier_->verify(tok);
+      const auto claims = verifier_->verify(tok);
+      if (auto limited = subjectLimit(*claims)) return limited;
 
       // Optional: Ausgewählte Claims ins Bundle legen (sparsam!)
-      // if (auto sub = decoded.get_subject()) {
-      //   req->putBundleData("jwt.sub", oatpp::String(*sub));
-      // }
-      // if (decoded.has_payload_claim("preferred_username")) {
-      //   req->putBundleData("jwt.username", oatpp::String(decoded.get_payload_claim("preferred_username").as_string()));
+      // if (!claims->subject.empty()) {
+      //   req->putBundleData("jwt.sub", oatpp::String(claims->subject));
       // }
 
+      count(Outcome::Accepted);
       return nullptr; // OK → weiterreichen
     } catch (const std::exception& e) {
-      // Sicherheitsbewusst: keine Token-Inhalte loggen.
-      auto r = oatpp::web::protocol::http::outgoing::ResponseFactory::createResponse(
-        oatpp::web::protocol::http::Status::CODE_401, "Unauthorized");
-      r->putHeader("WWW-Authenticate", "Bearer error=\"invalid_token\"");
-      return r;
+      count(Outcome::InvalidToken);
+      return invalidToken();
     }
   }
 };
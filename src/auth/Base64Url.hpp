@@ -0,0 +1,150 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define BASE64URL_HAVE_SSSE3 1
+#endif
+
+/**
+ * base64url-Decoding (RFC 4648 §5, ohne Padding) für JWT-Segmente.
+ * - x86: SSSE3-Pfad (16 Zeichen → 12 Bytes pro Schritt), zur Laufzeit per CPU-Check gewählt
+ * - sonst/Rest: skalare Tabelle
+ * - ungültige Zeichen oder '=' → false
+ */
+namespace base64url {
+
+/**
+ * Maximale Ausgabegröße für n Eingabezeichen.
+ */
+inline std::size_t decodedSize(std::size_t n) {
+  return (n / 4) * 3 + ((n % 4) * 3) / 4;
+}
+
+namespace detail {
+
+struct Table {
+  std::uint8_t v[256];
+  constexpr Table() : v() {
+    for (int i = 0; i < 256; ++i) v[i] = 0xFF;
+    for (int i = 0; i < 26; ++i) { v['A' + i] = (std::uint8_t) i; v['a' + i] = (std::uint8_t) (26 + i); }
+    for (int i = 0; i < 10; ++i) v['0' + i] = (std::uint8_t) (52 + i);
+    v[(unsigned char) '-'] = 62;
+    v[(unsigned char) '_'] = 63;
+  }
+};
+
+inline constexpr Table kTable{};
+
+inline bool decodeScalar(const char* in, std::size_t n, std::uint8_t* out, std::size_t& written) {
+  std::size_t o = 0;
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    const std::uint32_t a = kTable.v[(unsigned char) in[i]];
+    const std::uint32_t b = kTable.v[(unsigned char) in[i + 1]];
+    const std::uint32_t c = kTable.v[(unsigned char) in[i + 2]];
+    const std::uint32_t d = kTable.v[(unsigned char) in[i + 3]];
+    if ((a | b | c | d) & 0x80) return false;
+    const std::uint32_t v = (a << 18) | (b << 12) | (c << 6) | d;
+    out[o++] = (std::uint8_t) (v >> 16);
+    out[o++] = (std::uint8_t) (v >> 8);
+    out[o++] = (std::uint8_t) v;
+  }
+  const std::size_t rest = n - i;
+  if (rest == 1) return false;
+  if (rest >= 2) {
+    const std::uint32_t a = kTable.v[(unsigned char) in[i]];
+    const std::uint32_t b = kTable.v[(unsigned char) in[i + 1]];
+    const std::uint32_t c = rest == 3 ? kTable.v[(unsigned char) in[i + 2]] : 0;
+    if ((a | b | c) & 0x80) return false;
+    const std::uint32_t v = (a << 18) | (b << 12) | (c << 6);
+    out[o++] = (std::uint8_t) (v >> 16);
+    if (rest == 3) out[o++] = (std::uint8_t) (v >> 8);
+  }
+  written += o;
+  return true;
+}
+
+#ifdef BASE64URL_HAVE_SSSE3
+
+/*
+ * Zeichen → 6-Bit-Werte über Bereichsvergleiche (A-Z, a-z, 0-9, '-', '_'),
+ * danach Packen von 4x6 Bit in 3 Bytes mit maddubs/madd + shuffle.
+ * Verarbeitet nur volle 16er-Blöcke; gibt die Anzahl verbrauchter Zeichen zurück
+ * (kleiner als n bei Rest oder ungültigem Zeichen → skalar weiter).
+ */
+__attribute__((target("ssse3")))
+inline std::size_t decodeSsse3(const char* in, std::size_t n, std::uint8_t* out) {
+  const __m128i offAZ   = _mm_set1_epi8((char) -65);
+  const __m128i offaz   = _mm_set1_epi8((char) -71);
+  const __m128i off09   = _mm_set1_epi8(4);
+  const __m128i offDash = _mm_set1_epi8(62 - 45);
+  const __m128i offUnd  = _mm_set1_epi8((char) (63 - 95));
+  const __m128i pack    = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+  std::size_t i = 0;
+  std::size_t o = 0;
+  for (; i + 16 <= n; i += 16, o += 12) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    const __m128i mAZ = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8('Z' + 1)));
+    const __m128i maz = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8('z' + 1)));
+    const __m128i m09 = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1)));
+    const __m128i mDash = _mm_cmpeq_epi8(x, _mm_set1_epi8('-'));
+    const __m128i mUnd  = _mm_cmpeq_epi8(x, _mm_set1_epi8('_'));
+    const __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(mAZ, maz), _mm_or_si128(m09, mDash)), mUnd);
+    if (_mm_movemask_epi8(valid) != 0xFFFF) break;
+
+    __m128i off = _mm_and_si128(mAZ, offAZ);
+    off = _mm_or_si128(off, _mm_and_si128(maz, offaz));
+    off = _mm_or_si128(off, _mm_and_si128(m09, off09));
+    off = _mm_or_si128(off, _mm_and_si128(mDash, offDash));
+    off = _mm_or_si128(off, _mm_and_si128(mUnd, offUnd));
+    const __m128i values = _mm_add_epi8(x, off);
+
+    const __m128i ab = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const __m128i abcd = _mm_madd_epi16(ab, _mm_set1_epi32(0x00011000));
+    const __m128i bytes = _mm_shuffle_epi8(abcd, pack);
+
+    alignas(16) std::uint8_t tmp[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(tmp), bytes);
+    std::memcpy(out + o, tmp, 12);
+  }
+  return i;
+}
+
+inline bool cpuHasSsse3() {
+  static const bool has = __builtin_cpu_supports("ssse3");
+  return has;
+}
+
+#endif
+
+} // namespace detail
+
+/**
+ * Dekodiert `in` nach `out` (mind. decodedSize(in.size()) Bytes), setzt `written`.
+ */
+inline bool decode(std::string_view in, std::uint8_t* out, std::size_t& written) {
+  written = 0;
+  std::size_t consumed = 0;
+#ifdef BASE64URL_HAVE_SSSE3
+  if (in.size() >= 16 && detail::cpuHasSsse3()) {
+    consumed = detail::decodeSsse3(in.data(), in.size(), out);
+    written = consumed / 4 * 3;
+  }
+#endif
+  return detail::decodeScalar(in.data() + consumed, in.size() - consumed, out + written, written);
+}
+
+/**
+ * Nur skalar (Referenz für Tests/Benchmarks).
+ */
+inline bool decodeScalar(std::string_view in, std::uint8_t* out, std::size_t& written) {
+  written = 0;
+  return detail::decodeScalar(in.data(), in.size(), out, written);
+}
+
+} // namespace base64url
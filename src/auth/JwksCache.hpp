@@ -1,84 +1,568 @@
 #pragma once
+#include "AuthConfig.hpp"
+#include "metrics/Sharded.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <string>
 #include <unordered_map>
 #include <chrono>
+#include <memory>
 #include <mutex>
+#include <random>
 #include <stdexcept>
+#include <thread>
 #include <curl/curl.h>
 #include <nlohmann/json.hpp>
+#include <jwt-cpp/jwt.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
 
 /**
- * Thread-sicherer JWKS-Cache (kid -> (n,e)), TTL-basiert.
- * - Fetch via libcurl (5s Timeout, Follow-Redirects)
+ * Fertig aufgebauter Schlüssel eines JWKS-Eintrags (unveränderlich).
+ * - alg: RS256 mit bereits erzeugtem OpenSSL-Public-Key
+ * - verifier: alg + iss/aud/leeway, einmal pro kid beim Laden gebaut
+ * - pkey: derselbe Public Key als EVP_PKEY für den schnellen Decode-Pfad (JwtFastDecoder)
+ */
+struct JwkKey {
+  using Verifier = jwt::verifier<jwt::default_clock, jwt::traits::kazuho_picojson>;
+
+  jwt::algorithm::rs256 alg;
+  Verifier verifier;
+  std::shared_ptr<EVP_PKEY> pkey;
+
+  JwkKey(const std::string& publicKeyPem, const AuthConfig& cfg)
+    : alg(publicKeyPem)
+    , verifier(makeVerifier(alg, cfg))
+    , pkey(readPublicKey(publicKeyPem))
+  {}
+
+private:
+  static std::shared_ptr<EVP_PKEY> readPublicKey(const std::string& pem) {
+    std::unique_ptr<BIO, decltype(&BIO_free)> bio(BIO_new_mem_buf(pem.data(), (int) pem.size()), BIO_free);
+    EVP_PKEY* raw = bio ? PEM_read_bio_PUBKEY(bio.get(), nullptr, nullptr, nullptr) : nullptr;
+    if (!raw) throw std::runtime_error("invalid public key");
+    return std::shared_ptr<EVP_PKEY>(raw, EVP_PKEY_free);
+  }
+
+  static Verifier makeVerifier(const jwt::algorithm::rs256& alg, const AuthConfig& cfg) {
+    auto v = jwt::verify()
+      .allow_algorithm(alg)
+      .leeway(cfg.leewaySec)
+      .with_issuer(cfg.issuer);
+    if (!cfg.audience.empty()) {
+      v.with_audience(cfg.audience);
+    }
+    return v;
+  }
+};
+
+/**
+ * Schlüssel (noch) nicht verfügbar, Reload läuft im Hintergrund (tryGetKey → Pending).
+ */
+class JwksPendingError : public std::runtime_error {
+public:
+  JwksPendingError() : std::runtime_error("JWKS reload pending") {}
+};
+
+/**
+ * Thread-sicherer JWKS-Cache (kid -> JwkKey), TTL-basiert.
+ * - Schlüssel werden beim Laden einmal gebaut (n,e → PEM → OpenSSL-Key), nicht pro Request
+ * - Snapshot-Design: Leser holen sich ohne Lock den aktuellen, unveränderlichen Schlüsselsatz,
+ *   ein einzelner Writer (writeMutex_) lädt neu und publiziert einen neuen Snapshot
+ * - Leser blockieren nie hinter einem laufenden Fetch, solange ihr Snapshot gültig ist
+ * - Hintergrund-Refresher (startRefresher) lädt vor Ablauf der TTL neu (mit Jitter);
+ *   danach/bei Fehlern wird der letzte gute Satz bis jwksMaxStaleMinutes weiterverwendet
+ * - Unbekannte kids: gleichzeitige Reloads laufen als ein Fetch (single-flight), erzwungene Reloads
+ *   höchstens alle jwksMinRefreshSeconds, bestätigt unbekannte kids landen kurz im Negativ-Cache
+ * - Fetch via libcurl (5s Timeout, Follow-Redirects) über ein wiederverwendetes Handle (Keep-Alive),
+ *   konditional (If-None-Match/If-Modified-Since) → 304 verlängert den bestehenden Satz ohne Parsing
+ * - TTL aus Cache-Control: max-age des IdP (auf kMinTtl … kMaxTtl begrenzt), sonst jwksCacheMinutes;
+ *   ein 304 ohne max-age behält die TTL des bestehenden Satzes
  * - Fail-closed: schlägt Fetch/Re-Load fehl → wirft Exception → 401 oben
+ * - tryGetKey: nicht-blockierende Variante für den Async-Modus, Fetches nur über den Refresher
+ * - reloadStats/reloadLatency: Anzahl, 304-Anteil, Fehler und Dauer der HTTP-Reloads (für /metrics)
  */
 class JwksCache {
-  const std::string url_;
-  std::chrono::steady_clock::time_point expireAt_{};
-  std::unordered_map<std::string, std::pair<std::string,std::string>> kidToNE_;
-  std::mutex m_;
+public:
+  using KeyMap = std::unordered_map<std::string, std::shared_ptr<const JwkKey>>;
+
+  /**
+   * Ergebnis von tryGetKey: Found (key gesetzt), Unknown (kid nach Reload nicht im JWKS),
+   * Pending (Reload angestoßen/läuft, später erneut versuchen).
+   */
+  enum class KeyStatus { Found, Unknown, Pending };
+  struct KeyLookup {
+    KeyStatus status;
+    std::shared_ptr<const JwkKey> key;
+  };
+
+  struct ReloadStats {
+    std::uint64_t reloads = 0;     // abgeschlossene Fetches (200 oder 304)
+    std::uint64_t notModified = 0; // davon 304
+    std::uint64_t failures = 0;    // Fetch- oder Parse-Fehler
+  };
+
+private:
+  struct Snapshot {
+    std::shared_ptr<const KeyMap> keys;               // bei 304 unverändert weitergereicht
+    std::chrono::seconds ttl;
+    std::chrono::steady_clock::time_point expireAt;   // frisch bis hier
+    std::chrono::steady_clock::time_point staleUntil; // danach nur noch bis hier (stale-while-revalidate)
+    std::uint64_t version;
+  };
+
+  /*
+   * Pro Thread gecachter Snapshot. Der Lesepfad vergleicht nur eine atomare Versionsnummer;
+   * erst wenn ein Writer publiziert hat, wird der shared_ptr (einmalig) neu geladen.
+   * Versionen sind prozessweit eindeutig, daher kann der Slot mehreren Instanzen dienen.
+   */
+  struct ReaderSlot {
+    std::uint64_t version = 0;
+    std::shared_ptr<const Snapshot> snapshot;
+  };
+
+  std::shared_ptr<AuthConfig> cfg_;
+  std::shared_ptr<const Snapshot> snapshot_; // nur über std::atomic_load/atomic_store
+  std::atomic<std::uint64_t> version_{0};    // Version von snapshot_, für den lock-freien Vergleich
+  std::mutex writeMutex_;                    // genau ein Writer lädt/publiziert
+  std::atomic<std::chrono::steady_clock::rep> nextForcedReloadAt_{0}; // geschrieben unter writeMutex_, gelesen auch davor
+
+  // HTTP-Zustand des Writers (nur unter writeMutex_)
+  CURL* curl_ = nullptr;
+  std::string etag_;
+  std::string lastModified_;
+
+  struct FetchResult {
+    long status = 0;
+    std::string body;
+    std::string etag;
+    std::string lastModified;
+    long maxAgeSec = -1;
+  };
+
+  static constexpr std::chrono::seconds kMinTtl{30}; // Untergrenze, falls der IdP max-age=0 schickt
+  static constexpr std::chrono::seconds kMaxTtl{24 * 3600}; // Obergrenze: rotierte Schlüssel spätestens nach einem Tag neu laden
+
+  // Negativ-Cache für unbekannte kids (nur auf dem Miss-Pfad benutzt)
+  static constexpr std::size_t kMaxUnknownKids = 1024;
+  std::unordered_map<std::string, std::chrono::steady_clock::time_point> unknownKids_;
+  std::deque<std::pair<std::string, std::chrono::steady_clock::time_point>> unknownOrder_; // älteste vorne
+  std::unordered_map<std::string, std::uint64_t> awaitedKids_; // tryGetKey: kid → Version beim Anstoßen
+  std::deque<std::pair<std::string, std::uint64_t>> awaitedOrder_; // älteste vorne
+  std::mutex unknownMutex_;
+  std::atomic<std::chrono::steady_clock::rep> nextAsyncReloadAt_{0}; // tryGetKey: Mindestabstand
+
+  // Hintergrund-Refresher
+  std::thread refresher_;
+  std::mutex refreshMutex_;
+  std::condition_variable refreshCv_;
+  bool stopping_ = false;
+  std::atomic<bool> refresherRunning_{false};
+  std::atomic<bool> refreshRequested_{false};
+
+  // Reload-Statistik (selten geschrieben, jederzeit gelesen)
+  std::atomic<std::uint64_t> reloads_{0};
+  std::atomic<std::uint64_t> reloadsNotModified_{0};
+  std::atomic<std::uint64_t> reloadFailures_{0};
+  metrics::LatencyHistogram reloadLatency_;
+
+  static std::uint64_t nextVersion() {
+    static std::atomic<std::uint64_t> source{0};
+    return source.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  const Snapshot* current() const {
+    thread_local ReaderSlot slot;
+    const auto v = version_.load(std::memory_order_acquire);
+    if (slot.version != v) {
+      slot.snapshot = std::atomic_load(&snapshot_);
+      slot.version = slot.snapshot ? slot.snapshot->version : 0;
+    }
+    return slot.snapshot.get();
+  }
 
   static size_t writeCb(void* ptr, size_t size, size_t nmemb, void* data) {
     auto* s = static_cast<std::string*>(data);
     s->append(static_cast<char*>(ptr), size * nmemb);
     return size * nmemb;
   }
-  static std::string fetchUrl(const std::string& url) {
-    CURL* curl = curl_easy_init();
-    if (!curl) throw std::runtime_error("curl init failed");
-    std::string out;
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 5L);
-    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCb);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &out);
-    auto rc = curl_easy_perform(curl);
-    long code = 0;
-    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &code);
-    curl_easy_cleanup(curl);
-    if (rc != CURLE_OK || code / 100 != 2) {
+  static size_t headerCb(char* buffer, size_t size, size_t nitems, void* data) {
+    auto* r = static_cast<FetchResult*>(data);
+    const size_t len = size * nitems;
+    std::string line(buffer, len);
+    while (!line.empty() && (line.back() == '\r' || line.back() == '\n')) line.pop_back();
+    if (line.rfind("HTTP/", 0) == 0) {
+      *r = FetchResult{}; // neue Antwort (z.B. nach Redirect) → Header zurücksetzen
+      return len;
+    }
+    const auto colon = line.find(':');
+    if (colon == std::string::npos) return len;
+    std::string name = line.substr(0, colon);
+    for (auto& c : name) c = (char) tolower(c);
+    auto value = line.substr(colon + 1);
+    value.erase(0, value.find_first_not_of(" \t"));
+    if (name == "etag") {
+      r->etag = value;
+    } else if (name == "last-modified") {
+      r->lastModified = value;
+    } else if (name == "cache-control") {
+      for (auto& c : value) c = (char) tolower(c);
+      const auto pos = value.find("max-age=");
+      if (pos != std::string::npos) {
+        r->maxAgeSec = std::strtol(value.c_str() + pos + 8, nullptr, 10);
+      }
+    }
+    return len;
+  }
+  // nur mit writeMutex_ aufrufen
+  FetchResult fetchLocked(bool conditional) {
+    if (!curl_) {
+      curl_ = curl_easy_init();
+      if (!curl_) throw std::runtime_error("curl init failed");
+      curl_easy_setopt(curl_, CURLOPT_TIMEOUT, 5L);
+      curl_easy_setopt(curl_, CURLOPT_FOLLOWLOCATION, 1L);
+      curl_easy_setopt(curl_, CURLOPT_TCP_KEEPALIVE, 1L);
+      curl_easy_setopt(curl_, CURLOPT_NOSIGNAL, 1L);
+      curl_easy_setopt(curl_, CURLOPT_WRITEFUNCTION, writeCb);
+      curl_easy_setopt(curl_, CURLOPT_HEADERFUNCTION, headerCb);
+    }
+    FetchResult r;
+    std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> headers(nullptr, curl_slist_free_all);
+    if (conditional) {
+      curl_slist* list = nullptr;
+      if (!etag_.empty()) list = curl_slist_append(list, ("If-None-Match: " + etag_).c_str());
+      if (!lastModified_.empty()) list = curl_slist_append(list, ("If-Modified-Since: " + lastModified_).c_str());
+      headers.reset(list);
+    }
+    curl_easy_setopt(curl_, CURLOPT_URL, cfg_->jwksUrl.c_str());
+    curl_easy_setopt(curl_, CURLOPT_HTTPHEADER, headers.get());
+    curl_easy_setopt(curl_, CURLOPT_WRITEDATA, &r.body);
+    curl_easy_setopt(curl_, CURLOPT_HEADERDATA, &r);
+    auto rc = curl_easy_perform(curl_); // Verbindung bleibt im Handle für den nächsten Fetch offen
+    curl_easy_setopt(curl_, CURLOPT_HTTPHEADER, nullptr);
+    curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &r.status);
+    if (rc != CURLE_OK || (r.status / 100 != 2 && r.status != 304)) {
       throw std::runtime_error("fetch JWKS failed");
     }
-    return out;
+    return r;
   }
-  void reloadLocked(int ttlMin) {
-    const auto body = fetchUrl(url_);
+  KeyMap parseKeys(const std::string& body) const {
     auto j = nlohmann::json::parse(body, /*cb=*/nullptr, /*allow_exceptions=*/true);
-    std::unordered_map<std::string, std::pair<std::string,std::string>> newMap;
+    KeyMap newMap;
     for (auto& k : j["keys"]) {
       if (k.value("kty","") != "RSA") continue;
       const auto kid = k.value("kid", "");
       const auto n   = k.value("n", "");
       const auto e   = k.value("e", "");
-      if (!kid.empty() && !n.empty() && !e.empty()) {
-        newMap.emplace(kid, std::make_pair(n, e)); // base64url kodiert
+      if (kid.empty() || n.empty() || e.empty()) continue;
+      try {
+        // n,e sind base64url kodiert → einmalig PEM + OpenSSL-Key bauen
+        const auto pem = jwt::helper::create_public_key_from_rsa_components(n, e);
+        newMap.emplace(kid, std::make_shared<const JwkKey>(pem, *cfg_));
+      } catch (const std::exception&) {
+        // defekter Schlüssel → überspringen, übrige kids bleiben nutzbar
       }
     }
     if (newMap.empty()) throw std::runtime_error("JWKS empty");
-    kidToNE_.swap(newMap);
-    expireAt_ = std::chrono::steady_clock::now() + std::chrono::minutes(ttlMin);
+    return newMap;
+  }
+  // nur mit writeMutex_ aufrufen
+  void publishLocked(std::shared_ptr<const KeyMap> keys, std::chrono::seconds ttl) {
+    auto s = std::make_shared<Snapshot>();
+    s->keys = std::move(keys);
+    s->ttl = ttl;
+    const auto now = std::chrono::steady_clock::now();
+    s->expireAt = now + ttl;
+    s->staleUntil = s->expireAt + std::chrono::minutes(cfg_->jwksMaxStaleMinutes);
+    s->version = nextVersion();
+    const auto v = s->version;
+    std::atomic_store(&snapshot_, std::shared_ptr<const Snapshot>(std::move(s)));
+    version_.store(v, std::memory_order_release);
+  }
+  void reloadLocked(int ttlMin) {
+    metrics::ScopedTimer timer(reloadLatency_);
+    try {
+      fetchAndPublishLocked(ttlMin);
+    } catch (...) {
+      reloadFailures_.fetch_add(1, std::memory_order_relaxed);
+      throw;
+    }
+    reloads_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void fetchAndPublishLocked(int ttlMin) {
+    const auto current = std::atomic_load(&snapshot_);
+    auto r = fetchLocked(/*conditional=*/current != nullptr);
+    const bool notModified = r.status == 304 && current;
+    // 304 ohne max-age: die Frist, mit der der gespeicherte Satz publiziert wurde, gilt weiter (RFC 9111)
+    const auto ttl = r.maxAgeSec >= 0 ? std::clamp(std::chrono::seconds(r.maxAgeSec), kMinTtl, kMaxTtl)
+      : notModified ? current->ttl
+      : std::chrono::seconds(std::chrono::minutes(ttlMin));
+    if (notModified) {
+      reloadsNotModified_.fetch_add(1, std::memory_order_relaxed);
+      publishLocked(current->keys, ttl); // unverändert → nur Frist verlängern
+      return;
+    }
+    auto keys = std::make_shared<const KeyMap>(parseKeys(r.body));
+    etag_ = std::move(r.etag);
+    lastModified_ = std::move(r.lastModified);
+    publishLocked(std::move(keys), ttl);
+  }
+  bool isKnownUnknown(const std::string& kid, std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lk(unknownMutex_);
+    auto it = unknownKids_.find(kid);
+    if (it == unknownKids_.end()) return false;
+    if (now < it->second) return true;
+    unknownKids_.erase(it);
+    return false;
+  }
+  /*
+   * Alle Einträge haben dieselbe Frist → Einfügereihenfolge = Ablaufreihenfolge. Vorne werden abgelaufene
+   * und, bei einer Flut zufälliger kids, die ältesten Einträge verdrängt (O(1) pro Eintrag, kein Leeren).
+   * unknownOrder_ kann überholte Einträge enthalten (kid neu gemerkt oder schon gelöscht), höchstens 2× kMaxUnknownKids.
+   */
+  void rememberUnknown(const std::string& kid, std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lk(unknownMutex_);
+    const auto until = now + std::chrono::seconds(cfg_->jwksNegativeCacheSeconds);
+    unknownKids_.insert_or_assign(kid, until);
+    unknownOrder_.emplace_back(kid, until);
+    while (!unknownOrder_.empty()
+           && (unknownOrder_.front().second <= now || unknownKids_.size() > kMaxUnknownKids
+               || unknownOrder_.size() > 2 * kMaxUnknownKids)) {
+      const auto& [oldest, oldestUntil] = unknownOrder_.front();
+      auto it = unknownKids_.find(oldest);
+      if (it != unknownKids_.end() && it->second == oldestUntil) unknownKids_.erase(it);
+      unknownOrder_.pop_front();
+    }
+  }
+
+  /*
+   * true, wenn für diesen kid schon ein Reload angestoßen wurde und seitdem ein neuer Satz
+   * (auch 304) publiziert ist → kid ist bestätigt unbekannt. Sonst merken und false.
+   * Voll → wie rememberUnknown die ältesten Einträge verdrängen: eine Flut zufälliger kids kostet nur so viele
+   * wartende Einträge, wie sie über kMaxUnknownKids hinaus anlegt, statt alle zu löschen.
+   */
+  bool reloadedSinceAwaited(const std::string& kid, std::uint64_t version) {
+    std::lock_guard<std::mutex> lk(unknownMutex_);
+    auto it = awaitedKids_.find(kid);
+    if (it == awaitedKids_.end()) {
+      awaitedKids_.emplace(kid, version);
+      awaitedOrder_.emplace_back(kid, version);
+      while (!awaitedOrder_.empty()
+             && (awaitedKids_.size() > kMaxUnknownKids || awaitedOrder_.size() > 2 * kMaxUnknownKids)) {
+        const auto& [oldest, oldestVersion] = awaitedOrder_.front();
+        auto old = awaitedKids_.find(oldest);
+        if (old != awaitedKids_.end() && old->second == oldestVersion) awaitedKids_.erase(old);
+        awaitedOrder_.pop_front();
+      }
+      return false;
+    }
+    if (it->second == version) return false;
+    awaitedKids_.erase(it);
+    return true;
+  }
+  // Refresher anstoßen, höchstens alle jwksMinRefreshSeconds (auch bei ausgefallenem IdP)
+  void requestRefreshThrottled(std::chrono::steady_clock::time_point now) {
+    auto due = nextAsyncReloadAt_.load(std::memory_order_relaxed);
+    const auto t = now.time_since_epoch().count();
+    if (t < due) return;
+    const auto next = (now + std::chrono::seconds(cfg_->jwksMinRefreshSeconds)).time_since_epoch().count();
+    if (!nextAsyncReloadAt_.compare_exchange_strong(due, next, std::memory_order_relaxed)) return;
+    if (!refresherRunning_.load(std::memory_order_relaxed)) startRefresher();
+    requestRefresh();
+  }
+
+  void requestRefresh() {
+    if (!refreshRequested_.exchange(true)) {
+      std::lock_guard<std::mutex> lk(refreshMutex_);
+      refreshCv_.notify_one();
+    }
+  }
+  void refreshLoop() {
+    std::mt19937 rng(std::random_device{}());
+    std::uniform_real_distribution<double> jitter(0.7, 0.9);
+    auto nextAt = std::chrono::steady_clock::now(); // initiales Laden sofort
+    auto retryDelay = std::chrono::seconds(5);
+
+    std::unique_lock<std::mutex> lk(refreshMutex_);
+    while (!stopping_) {
+      refreshCv_.wait_until(lk, nextAt, [this] { return stopping_ || refreshRequested_.load(); });
+      if (stopping_) break;
+      refreshRequested_ = false;
+      lk.unlock();
+
+      const int ttlMin = cfg_->jwksCacheMinutes;
+      bool ok = true;
+      std::chrono::seconds ttl{0};
+      try {
+        std::scoped_lock wlk(writeMutex_);
+        reloadLocked(ttlMin);
+        ttl = std::atomic_load(&snapshot_)->ttl;
+      } catch (const std::exception&) {
+        ok = false; // letzter guter Satz bleibt bis staleUntil in Gebrauch
+      }
+
+      const auto now = std::chrono::steady_clock::now();
+      if (ok) {
+        // vor Ablauf der TTL erneut laden, Jitter verteilt Instanzen über die Zeit
+        nextAt = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(ttl * jitter(rng));
+        retryDelay = std::chrono::seconds(5);
+      } else {
+        nextAt = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(retryDelay * jitter(rng) / 0.8);
+        retryDelay = std::min<std::chrono::seconds>(retryDelay * 2, std::chrono::seconds(60));
+      }
+      lk.lock();
+    }
+  }
+
+  static std::shared_ptr<const JwkKey> find(const Snapshot* s, const std::string& kid) {
+    if (!s) return nullptr;
+    auto it = s->keys->find(kid);
+    return it == s->keys->end() ? nullptr : it->second;
   }
 
 public:
-  explicit JwksCache(std::string url) : url_(std::move(url)) {
+  explicit JwksCache(std::shared_ptr<AuthConfig> cfg) : cfg_(std::move(cfg)) {
     // optional: curl_global_init(CURL_GLOBAL_ALL); // libcurl ist idempotent genug pro easy handle
   }
 
-  std::pair<std::string,std::string> getNE(const std::string& kid, int ttlMin) {
-    std::scoped_lock lk(m_);
+  ~JwksCache() {
+    stopRefresher();
+    if (curl_) curl_easy_cleanup(curl_);
+  }
+
+  /**
+   * Hintergrund-Refresher starten: lädt sofort und danach vor Ablauf der TTL neu.
+   * Ohne Refresher lädt der erste Request nach Ablauf synchron (altes Verhalten).
+   */
+  void startRefresher() {
+    if (refresherRunning_.exchange(true)) return;
+    {
+      std::lock_guard<std::mutex> lk(refreshMutex_);
+      stopping_ = false;
+    }
+    refresher_ = std::thread([this] { refreshLoop(); });
+  }
+
+  void stopRefresher() {
+    if (!refresherRunning_.exchange(false)) return;
+    {
+      std::lock_guard<std::mutex> lk(refreshMutex_);
+      stopping_ = true;
+    }
+    refreshCv_.notify_all();
+    if (refresher_.joinable()) refresher_.join();
+  }
+
+  /**
+   * Schlüsselsatz direkt aus einem JWKS-Dokument übernehmen (z.B. Bootstrap, Tests, Benchmarks).
+   */
+  void load(const std::string& jwksJson, int ttlMin) {
+    auto keys = std::make_shared<const KeyMap>(parseKeys(jwksJson));
+    std::scoped_lock lk(writeMutex_);
+    publishLocked(std::move(keys), std::chrono::minutes(ttlMin));
+  }
+
+  /**
+   * TTL des aktuellen Schlüsselsatzes (max-age des IdP oder jwksCacheMinutes), 0 ohne Satz.
+   */
+  std::chrono::seconds keySetTtl() const {
+    const auto* snap = current();
+    return snap ? snap->ttl : std::chrono::seconds(0);
+  }
+
+  ReloadStats reloadStats() const noexcept {
+    ReloadStats st;
+    st.reloads = reloads_.load(std::memory_order_relaxed);
+    st.notModified = reloadsNotModified_.load(std::memory_order_relaxed);
+    st.failures = reloadFailures_.load(std::memory_order_relaxed);
+    return st;
+  }
+
+  const metrics::LatencyHistogram& reloadLatency() const noexcept { return reloadLatency_; }
+
+  /**
+   * Anzahl Schlüssel im aktuellen Satz (0 ohne Satz).
+   */
+  std::size_t keyCount() const {
+    const auto* snap = current();
+    return snap && snap->keys ? snap->keys->size() : 0;
+  }
+
+  std::shared_ptr<const JwkKey> getKey(const std::string& kid, int ttlMin) {
+    // Fast path: gültiger Snapshot + bekannter kid → kein Lock
+    const auto* snap = current();
+    const auto now = std::chrono::steady_clock::now();
+    if (snap && now < snap->expireAt) {
+      if (auto key = find(snap, kid)) return key;
+    } else if (snap && now < snap->staleUntil && refresherRunning_.load(std::memory_order_relaxed)) {
+      // abgelaufen, aber noch tolerierbar: Refresher anstoßen (gedrosselt wie in tryGetKey, sonst weckt
+      // jeder Request bei ausgefallenem IdP einen Fetch), mit letztem guten Satz weiter
+      requestRefreshThrottled(now);
+      if (auto key = find(snap, kid)) return key;
+    }
+    const auto seenVersion = snap ? snap->version : 0;
+
+    // bekannt unbekannter kid → ohne Fetch und ohne Writer-Lock ablehnen
+    if (snap && isKnownUnknown(kid, now)) {
+      throw std::runtime_error("kid not found in JWKS");
+    }
+    // Satz noch brauchbar, seitdem nicht ersetzt, und erzwungener Reload erst später erlaubt → der Writer würde
+    // nichts laden; ohne Writer-Lock ablehnen, sonst serialisiert eine kid-Flut alle Threads an writeMutex_
+    const bool usable = snap && now < (refresherRunning_.load(std::memory_order_relaxed) ? snap->staleUntil : snap->expireAt);
+    if (usable && version_.load(std::memory_order_acquire) == seenVersion
+        && now.time_since_epoch().count() < nextForcedReloadAt_.load(std::memory_order_relaxed)) {
+      rememberUnknown(kid, now);
+      throw std::runtime_error("kid not found in JWKS");
+    }
+
+    // Slow path: abgelaufen oder unbekannter kid (mögliche Rotation) → genau ein Writer lädt neu,
+    // wer währenddessen wartet, übernimmt dessen Ergebnis (single-flight)
+    std::scoped_lock lk(writeMutex_);
+    auto latest = std::atomic_load(&snapshot_);
+    if (!latest || latest->version == seenVersion) {
+      const auto t = std::chrono::steady_clock::now();
+      const bool expired = !latest || t >= (refresherRunning_.load() ? latest->staleUntil : latest->expireAt);
+      if (expired) {
+        reloadLocked(ttlMin);
+      } else if (t.time_since_epoch().count() >= nextForcedReloadAt_.load(std::memory_order_relaxed)) {
+        // auch bei Fehlschlag gesetzt, sonst hämmert eine kid-Flut den IdP
+        nextForcedReloadAt_.store((t + std::chrono::seconds(cfg_->jwksMinRefreshSeconds)).time_since_epoch().count(),
+                                  std::memory_order_relaxed);
+        reloadLocked(ttlMin);
+      }
+      latest = std::atomic_load(&snapshot_);
+    }
+    auto key = find(latest.get(), kid);
+    if (!key) {
+      rememberUnknown(kid, now);
+      throw std::runtime_error("kid not found in JWKS");
+    }
+    return key;
+  }
+
+  /**
+   * Wie getKey, aber ohne je auf einen Fetch oder den Writer-Lock zu warten (Async-Modus).
+   * Fehlt der kid oder ist kein brauchbarer Satz da, lädt der Refresher (gedrosselt) im Hintergrund;
+   * der Aufrufer bekommt Pending und versucht es später erneut.
+   */
+  KeyLookup tryGetKey(const std::string& kid) {
+    const auto* snap = current();
     const auto now = std::chrono::steady_clock::now();
-    if (now >= expireAt_) {
-      reloadLocked(ttlMin);
-    }
-    auto it = kidToNE_.find(kid);
-    if (it == kidToNE_.end()) {
-      // mögliche Rotation → hart neu laden
-      reloadLocked(ttlMin);
-      it = kidToNE_.find(kid);
-      if (it == kidToNE_.end()) {
-        throw std::runtime_error("kid not found in JWKS");
+    const bool fresh = snap && now < snap->expireAt;
+    const bool stale = snap && !fresh && now < snap->staleUntil;
+    if (fresh || stale) {
+      if (stale) requestRefreshThrottled(now);
+      if (auto key = find(snap, kid)) return {KeyStatus::Found, std::move(key)};
+      if (isKnownUnknown(kid, now)) return {KeyStatus::Unknown, nullptr};
+      if (reloadedSinceAwaited(kid, snap->version)) {
+        rememberUnknown(kid, now);
+        return {KeyStatus::Unknown, nullptr};
       }
     }
-    return it->second;
+    requestRefreshThrottled(now);
+    return {KeyStatus::Pending, nullptr};
   }
 };
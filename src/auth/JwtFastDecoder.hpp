@@ -0,0 +1,245 @@
+#pragma once
+#include "Base64Url.hpp"
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * Ergebnis von JwtFastDecoder::decode. Alle Views zeigen in thread-lokale Puffer
+ * bzw. in das Token selbst und gelten bis zum nächsten decode() im selben Thread.
+ */
+struct FastJwt {
+  std::string_view signingInput; // "header.payload" (Bytes, über die signiert wurde)
+  std::string_view alg;
+  std::string_view kid;
+  std::string_view iss;
+  std::string_view sub;
+  std::string_view azp;
+  std::string_view aud; // roher JSON-Wert: "x" (ohne Quotes) oder [..] (mit Klammern)
+  bool audIsArray = false;
+  bool hasExp = false, hasNbf = false, hasIat = false;
+  std::int64_t exp = 0, nbf = 0, iat = 0;
+  const std::uint8_t* signature = nullptr;
+  std::size_t signatureSize = 0;
+
+  /**
+   * true, wenn `expected` der aud-String ist bzw. im aud-Array vorkommt.
+   */
+  bool hasAudience(std::string_view expected) const;
+};
+
+/**
+ * JwtFastDecoder
+ * - ein Durchlauf: Segmente splitten, base64url (SIMD) in wiederverwendete thread-lokale Puffer,
+ *   Claims lazy aus dem JSON lesen (nur kid/alg, iss/aud/exp/nbf/iat/sub/azp)
+ * - kein DOM, keine temporären Strings
+ * - decode() == false bei allem Ungewöhnlichen (z.B. Escapes in gelesenen Strings, Gleitkomma-exp);
+ *   der Aufrufer fällt dann auf jwt-cpp zurück
+ */
+class JwtFastDecoder {
+public:
+  static bool decode(std::string_view token, FastJwt& out);
+
+  /**
+   * Nur den Header lesen (z.B. zum Gruppieren nach kid); Views gelten wie bei decode().
+   */
+  static bool decodeHeader(std::string_view token, std::string_view& alg, std::string_view& kid);
+
+private:
+  struct Buffers {
+    std::vector<std::uint8_t> header;
+    std::vector<std::uint8_t> payload;
+    std::vector<std::uint8_t> signature;
+  };
+  static Buffers& buffers() {
+    thread_local Buffers b;
+    return b;
+  }
+
+  static bool decodeSegment(std::string_view in, std::vector<std::uint8_t>& buf, std::string_view& out) {
+    buf.resize(base64url::decodedSize(in.size())); // wächst nur, Kapazität bleibt pro Thread erhalten
+    std::size_t n = 0;
+    if (!base64url::decode(in, buf.data(), n)) return false;
+    out = std::string_view(reinterpret_cast<const char*>(buf.data()), n);
+    return true;
+  }
+
+  /*
+   * Minimaler Scanner über ein flaches JSON-Objekt: Werte unbekannter Keys werden übersprungen
+   * (inkl. verschachtelter Objekte/Arrays), gesuchte Keys per Callback geliefert.
+   */
+  class Scanner {
+    std::string_view s_;
+    std::size_t i_ = 0;
+  public:
+    explicit Scanner(std::string_view s) : s_(s) {}
+
+    void ws() {
+      while (i_ < s_.size() && (s_[i_] == ' ' || s_[i_] == '\t' || s_[i_] == '\n' || s_[i_] == '\r')) ++i_;
+    }
+    bool eat(char c) {
+      ws();
+      if (i_ < s_.size() && s_[i_] == c) { ++i_; return true; }
+      return false;
+    }
+    bool peek(char c) {
+      ws();
+      return i_ < s_.size() && s_[i_] == c;
+    }
+    // String ohne Quotes; escaped = true, wenn Backslashes enthalten sind
+    bool string(std::string_view& out, bool& escaped) {
+      if (!eat('"')) return false;
+      const auto start = i_;
+      escaped = false;
+      while (i_ < s_.size() && s_[i_] != '"') {
+        if (s_[i_] == '\\') { escaped = true; ++i_; }
+        ++i_;
+      }
+      if (i_ >= s_.size()) return false;
+      out = s_.substr(start, i_ - start);
+      ++i_;
+      return true;
+    }
+    // Ganzzahl (exp/nbf/iat); Bruchteile/Exponenten → false (Fallback)
+    bool integer(std::int64_t& out) {
+      ws();
+      bool neg = false;
+      if (i_ < s_.size() && s_[i_] == '-') { neg = true; ++i_; }
+      const auto start = i_;
+      std::int64_t v = 0;
+      while (i_ < s_.size() && s_[i_] >= '0' && s_[i_] <= '9') {
+        if (v > (INT64_MAX - 9) / 10) return false;
+        v = v * 10 + (s_[i_] - '0');
+        ++i_;
+      }
+      if (i_ == start) return false;
+      if (i_ < s_.size() && (s_[i_] == '.' || s_[i_] == 'e' || s_[i_] == 'E')) return false;
+      out = neg ? -v : v;
+      return true;
+    }
+    // beliebigen Wert überspringen, Rohbereich liefern
+    bool skip(std::string_view* raw = nullptr) {
+      ws();
+      if (i_ >= s_.size()) return false;
+      const auto start = i_;
+      const char c = s_[i_];
+      if (c == '"') {
+        std::string_view tmp; bool esc;
+        if (!string(tmp, esc)) return false;
+      } else if (c == '{' || c == '[') {
+        int depth = 0;
+        while (i_ < s_.size()) {
+          const char d = s_[i_];
+          if (d == '"') {
+            std::string_view tmp; bool esc;
+            if (!string(tmp, esc)) return false;
+            continue;
+          }
+          if (d == '{' || d == '[') ++depth;
+          if (d == '}' || d == ']') {
+            if (--depth == 0) { ++i_; break; }
+          }
+          ++i_;
+        }
+        if (depth != 0) return false;
+      } else {
+        while (i_ < s_.size() && s_[i_] != ',' && s_[i_] != '}' && s_[i_] != ']' &&
+               s_[i_] != ' ' && s_[i_] != '\n' && s_[i_] != '\r' && s_[i_] != '\t') ++i_;
+        if (i_ == start) return false;
+      }
+      if (raw) *raw = s_.substr(start, i_ - start);
+      return true;
+    }
+
+    template<typename OnKey>
+    bool object(OnKey&& onKey) {
+      if (!eat('{')) return false;
+      if (eat('}')) return true;
+      do {
+        std::string_view key; bool esc;
+        if (!string(key, esc) || !eat(':')) return false;
+        if (!onKey(esc ? std::string_view() : key, *this)) return false;
+      } while (eat(','));
+      return eat('}');
+    }
+  };
+
+  static bool readString(Scanner& sc, std::string_view& out) {
+    bool escaped;
+    return sc.string(out, escaped) && !escaped;
+  }
+
+  static bool readHeader(std::string_view header, std::string_view& alg, std::string_view& kid) {
+    Scanner h(header);
+    return h.object([&](std::string_view key, Scanner& sc) {
+      if (key == "alg") return readString(sc, alg);
+      if (key == "kid") return readString(sc, kid);
+      return sc.skip();
+    });
+  }
+};
+
+inline bool FastJwt::hasAudience(std::string_view expected) const {
+  if (!audIsArray) return aud == expected;
+  // "[\"a\",\"b\"]" → Elemente vergleichen
+  std::size_t i = 0;
+  while ((i = aud.find('"', i)) != std::string_view::npos) {
+    const auto end = aud.find('"', i + 1);
+    if (end == std::string_view::npos) return false;
+    if (aud.substr(i + 1, end - i - 1) == expected) return true;
+    i = end + 1;
+  }
+  return false;
+}
+
+inline bool JwtFastDecoder::decode(std::string_view token, FastJwt& out) {
+  out = FastJwt{};
+  const auto d1 = token.find('.');
+  if (d1 == std::string_view::npos) return false;
+  const auto d2 = token.find('.', d1 + 1);
+  if (d2 == std::string_view::npos || token.find('.', d2 + 1) != std::string_view::npos) return false;
+
+  auto& buf = buffers();
+  std::string_view header, payload, signature;
+  if (!decodeSegment(token.substr(0, d1), buf.header, header)) return false;
+  if (!decodeSegment(token.substr(d1 + 1, d2 - d1 - 1), buf.payload, payload)) return false;
+  if (!decodeSegment(token.substr(d2 + 1), buf.signature, signature)) return false;
+  out.signingInput = token.substr(0, d2);
+  out.signature = buf.signature.data();
+  out.signatureSize = signature.size();
+
+  if (!readHeader(header, out.alg, out.kid)) return false;
+
+  // doppelte Claims wären mehrdeutig → Fallback
+  Scanner p(payload);
+  bool hasIss = false, hasAud = false, hasSub = false, hasAzp = false;
+  const bool payloadOk = p.object([&](std::string_view key, Scanner& sc) {
+    auto once = [](bool& seen) { if (seen) return false; seen = true; return true; };
+    if (key == "iss") return once(hasIss) && readString(sc, out.iss);
+    if (key == "sub") return once(hasSub) && readString(sc, out.sub);
+    if (key == "azp") return once(hasAzp) && readString(sc, out.azp);
+    if (key == "exp") return once(out.hasExp) && sc.integer(out.exp);
+    if (key == "nbf") return once(out.hasNbf) && sc.integer(out.nbf);
+    if (key == "iat") return once(out.hasIat) && sc.integer(out.iat);
+    if (key == "aud") {
+      if (!once(hasAud)) return false;
+      if (sc.peek('[')) {
+        out.audIsArray = true;
+        if (!sc.skip(&out.aud)) return false;
+        return out.aud.find('\\') == std::string_view::npos;
+      }
+      return readString(sc, out.aud);
+    }
+    if (key.empty()) return false; // escaped Key → könnte ein gesuchter sein
+    return sc.skip();
+  });
+  return payloadOk;
+}
+
+inline bool JwtFastDecoder::decodeHeader(std::string_view token, std::string_view& alg, std::string_view& kid) {
+  alg = kid = std::string_view();
+  const auto d1 = token.find('.');
+  if (d1 == std::string_view::npos) return false;
+  std::string_view header;
+  return decodeSegment(token.substr(0, d1), buffers().header, header) && readHeader(header, alg, kid);
+}
@@ -1,45 +1,265 @@
 #pragma once
 #include "AuthConfig.hpp"
 #include "JwksCache.hpp"
+#include "JwtFastDecoder.hpp"
+#include "TokenCache.hpp"
+#include "VerifiedClaims.hpp"
+#include "metrics/ServerTiming.hpp"
+#include "metrics/Sharded.hpp"
+#include "util/WorkerPool.hpp"
 #include <jwt-cpp/jwt.h>
+#include <openssl/evp.h>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 /**
  * JwtVerifier
- * - RS256 Validierung gegen JWKS (n,e) und iss/aud/exp/nbf/iat + leeway
- * - Erwartet jwt-cpp >= 0.7.x (rs256-ctor mit n,e (base64url))
+ * - RS256 Validierung gegen JWKS und iss/aud/exp/nbf/iat + leeway
+ * - Erwartet jwt-cpp >= 0.7.x (helper::create_public_key_from_rsa_components)
+ * - Bereits verifizierte Tokens kommen aus dem TokenCache (bis exp - leeway)
+ * - Decode-Pfad bei Cache-Miss per Build-Option MY_PROJECT_FAST_JWT:
+ *   Fast = JwtFastDecoder (SIMD-base64url, lazy Claims, EVP_DigestVerify),
+ *   JwtCpp = jwt::decode + jwt::verifier; Fast fällt bei ungewöhnlichen Tokens auf JwtCpp zurück
  */
 class JwtVerifier {
+public:
+  enum class DecodePath { JwtCpp, Fast };
+
+#ifdef MY_PROJECT_FAST_JWT
+  static constexpr DecodePath kDefaultDecodePath = DecodePath::Fast;
+#else
+  static constexpr DecodePath kDefaultDecodePath = DecodePath::JwtCpp;
+#endif
+
+private:
   std::shared_ptr<AuthConfig> cfg_;
   JwksCache jwks_;
+  TokenCache tokens_;
+  metrics::LatencyHistogram verifyLatency_;
 
-public:
-  explicit JwtVerifier(std::shared_ptr<AuthConfig> cfg)
-    : cfg_(std::move(cfg)), jwks_(cfg_->jwksUrl) {}
+  static std::shared_ptr<const VerifiedClaims>
+  toClaims(const jwt::decoded_jwt<jwt::traits::kazuho_picojson>& decoded) {
+    auto c = std::make_shared<VerifiedClaims>();
+    if (decoded.has_subject()) c->subject = decoded.get_subject();
+    if (decoded.has_payload_claim("azp")) c->authorizedParty = decoded.get_payload_claim("azp").as_string();
+    if (decoded.has_expires_at()) {
+      c->expiresAt = std::chrono::duration_cast<std::chrono::seconds>(
+        decoded.get_expires_at().time_since_epoch()).count();
+    }
+    return c;
+  }
+
+  static bool verifySignature(EVP_PKEY* pkey, const FastJwt& jwt) {
+    thread_local std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> ctx(EVP_MD_CTX_new(), EVP_MD_CTX_free);
+    if (!ctx || EVP_MD_CTX_reset(ctx.get()) != 1) return false;
+    if (EVP_DigestVerifyInit(ctx.get(), nullptr, EVP_sha256(), nullptr, pkey) != 1) return false;
+    return EVP_DigestVerify(ctx.get(), jwt.signature, jwt.signatureSize,
+                            reinterpret_cast<const unsigned char*>(jwt.signingInput.data()),
+                            jwt.signingInput.size()) == 1;
+  }
 
-  jwt::decoded_jwt<jwt::traits::kazuho_picojson> verify(const std::string& token) {
-    auto decoded = jwt::decode<jwt::traits::kazuho_picojson>(token);
+  // Schlüsselsuche als Server-Timing-Stage "jwks" (inkl. evtl. blockierendem Fetch)
+  template<typename KeyLookup>
+  static std::shared_ptr<const JwkKey> lookup(std::string_view kid, KeyLookup& keyFor) {
+    metrics::StageScope stage(metrics::Stage::JwksLookup);
+    return keyFor(kid);
+  }
+
+  /*
+   * Gleiche Prüfungen wie der jwt-cpp-Verifier aus JwkKey:
+   * alg == RS256, Signatur, iss (Pflicht), aud (Pflicht wenn konfiguriert), exp/nbf/iat mit leeway.
+   */
+  template<typename KeyLookup>
+  std::shared_ptr<const VerifiedClaims> verifyFast(const FastJwt& jwt, KeyLookup&& keyFor) {
+    if (jwt.alg != "RS256") throw std::runtime_error("wrong algorithm");
+    if (jwt.kid.empty()) throw std::runtime_error("missing kid");
+
+    const auto key = lookup(jwt.kid, keyFor);
+    {
+      metrics::StageScope stage(metrics::Stage::Signature);
+      if (!verifySignature(key->pkey.get(), jwt)) throw std::runtime_error("invalid signature");
+    }
+
+    if (jwt.iss != cfg_->issuer) throw std::runtime_error("invalid issuer");
+    if (!cfg_->audience.empty() && !jwt.hasAudience(cfg_->audience)) throw std::runtime_error("invalid audience");
+
+    const auto now = std::chrono::duration_cast<std::chrono::seconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+    const auto leeway = (std::int64_t) cfg_->leewaySec;
+    if (jwt.hasExp && now > jwt.exp + leeway) throw std::runtime_error("token expired");
+    if (jwt.hasNbf && now < jwt.nbf - leeway) throw std::runtime_error("token not yet valid");
+    if (jwt.hasIat && now < jwt.iat - leeway) throw std::runtime_error("token issued in the future");
+
+    auto c = std::make_shared<VerifiedClaims>();
+    c->subject = std::string(jwt.sub);
+    c->authorizedParty = std::string(jwt.azp);
+    if (jwt.hasExp) c->expiresAt = jwt.exp;
+    return c;
+  }
+
+  template<typename KeyLookup>
+  std::shared_ptr<const VerifiedClaims> verifyJwtCpp(std::string_view token, KeyLookup&& keyFor) {
+    // jwt-cpp braucht einen eigenen std::string
+    auto decoded = jwt::decode<jwt::traits::kazuho_picojson>(std::string(token));
 
     auto kid_header = decoded.get_key_id();
     const auto kid = kid_header.empty() ? "" : kid_header;
     if (kid.empty()) throw std::runtime_error("missing kid");
 
-    const auto [n_b64u, e_b64u] = jwks_.getNE(kid, cfg_->jwksCacheMinutes);
+    // fertiger Verifier (Key + iss/aud/leeway) aus dem JWKS-Cache, kein Key-Aufbau pro Request
+    const auto key = lookup(kid, keyFor);
+    {
+      metrics::StageScope stage(metrics::Stage::Signature);
+      key->verifier.verify(decoded); // prüft Signatur + exp/nbf/iat
+    }
+
+    return toClaims(decoded);
+  }
+
+  template<typename KeyLookup>
+  std::shared_ptr<const VerifiedClaims> verifyWith(std::string_view token, DecodePath path, KeyLookup&& keyFor) {
+    if (path == DecodePath::Fast) {
+      FastJwt jwt;
+      if (JwtFastDecoder::decode(token, jwt)) return verifyFast(jwt, keyFor);
+      // Escapes, Gleitkomma-Zeitstempel o.ä. → jwt-cpp entscheidet
+    }
+    return verifyJwtCpp(token, keyFor);
+  }
+
+  std::shared_ptr<const JwkKey> keyFor(std::string_view kid) {
+    return jwks_.getKey(std::string(kid), cfg_->jwksCacheMinutes);
+  }
+
+public:
+  explicit JwtVerifier(std::shared_ptr<AuthConfig> cfg)
+    : cfg_(std::move(cfg))
+    , jwks_(cfg_)
+    , tokens_(cfg_->tokenCacheSize, cfg_->leewaySec)
+  {}
+
+  std::shared_ptr<const VerifiedClaims> verify(std::string_view token) {
+    metrics::ScopedTimer timer(verifyLatency_);
+    if (auto hit = tokens_.find(token)) return hit;
+
+    auto claims = verifyUncached(token, kDefaultDecodePath);
+    tokens_.insert(token, claims);
+    return claims;
+  }
+
+  /**
+   * Wie verify, blockiert aber nie auf einen JWKS-Fetch (Async-Modus, Executor-Threads).
+   * Wirft JwksPendingError, solange der passende Schlüssel noch geladen wird.
+   */
+  std::shared_ptr<const VerifiedClaims> verifyNonBlocking(std::string_view token) {
+    metrics::ScopedTimer timer(verifyLatency_);
+    if (auto hit = tokens_.find(token)) return hit;
 
-    // RS256 mit (n,e) – jwt-cpp baut intern den Public Key
-    const auto alg = jwt::algorithm::rs256(n_b64u, e_b64u);
-    auto v = jwt::verify()
-      .allow_algorithm(alg)
-      .leeway(cfg_->leewaySec)
-      .with_issuer(cfg_->issuer);
+    auto claims = verifyWith(token, kDefaultDecodePath, [this](std::string_view kid) {
+      auto r = jwks_.tryGetKey(std::string(kid));
+      if (r.status == JwksCache::KeyStatus::Found) return r.key;
+      if (r.status == JwksCache::KeyStatus::Unknown) throw std::runtime_error("kid not found in JWKS");
+      throw JwksPendingError();
+    });
+    tokens_.insert(token, claims);
+    return claims;
+  }
 
-    if (!cfg_->audience.empty()) {
-      v.with_audience(cfg_->audience);
+  /**
+   * Volle Prüfung ohne TokenCache über den gewählten Decode-Pfad (auch für Benchmarks/Tests).
+   */
+  std::shared_ptr<const VerifiedClaims> verifyUncached(std::string_view token, DecodePath path) {
+    return verifyWith(token, path, [this](std::string_view kid) { return keyFor(kid); });
+  }
+
+  /**
+   * Ergebnis pro Token von verifyBatch: claims bei Erfolg, sonst error (Grund ohne Token-Inhalt).
+   */
+  struct BatchResult {
+    std::shared_ptr<const VerifiedClaims> claims;
+    std::string error;
+  };
+
+  /**
+   * N Tokens in einem Aufruf prüfen (Gateway/Sidecar).
+   * - TokenCache-Treffer und Duplikate im Batch kosten keine Signaturprüfung
+   * - restliche Tokens nach kid gruppiert: ein JWKS-Lookup pro kid statt pro Token
+   * - Signaturprüfungen laufen parallel auf `pool` (nullptr = im Aufrufer)
+   * Ergebnisse in Eingabereihenfolge.
+   */
+  std::vector<BatchResult> verifyBatch(const std::vector<std::string_view>& tokens, WorkerPool* pool = nullptr) {
+    std::vector<BatchResult> results(tokens.size());
+
+    // 1. Cache und Duplikate (dup[i] = Index des ersten gleichen Tokens)
+    std::vector<std::size_t> dup(tokens.size());
+    std::unordered_map<std::string_view, std::size_t> firstSeen;
+    firstSeen.reserve(tokens.size());
+    std::vector<std::size_t> misses;
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+      dup[i] = firstSeen.emplace(tokens[i], i).first->second;
+      if (dup[i] != i) continue;
+      if (auto hit = tokens_.find(tokens[i])) results[i].claims = std::move(hit);
+      else misses.push_back(i);
     }
 
-    v.verify(decoded); // prüft exp/nbf/iat
+    // 2. nach kid gruppieren, Key einmal pro Gruppe holen
+    struct Job { std::size_t index; std::shared_ptr<const JwkKey> key; };
+    std::vector<Job> jobs;
+    jobs.reserve(misses.size());
+    std::unordered_map<std::string, std::vector<std::size_t>> byKid;
+    for (auto i : misses) {
+      std::string_view alg, kid;
+      if (JwtFastDecoder::decodeHeader(tokens[i], alg, kid) && !kid.empty()) {
+        byKid[std::string(kid)].push_back(i);
+      } else {
+        jobs.push_back({i, nullptr}); // ungewöhnlicher Header → Einzelprüfung entscheidet
+      }
+    }
+    for (auto& group : byKid) {
+      std::shared_ptr<const JwkKey> key;
+      try {
+        key = keyFor(group.first);
+      } catch (const std::exception& e) {
+        for (auto i : group.second) results[i].error = e.what();
+        continue;
+      }
+      for (auto i : group.second) jobs.push_back({i, key});
+    }
 
-    return decoded;
+    // 3. Signaturen parallel prüfen
+    auto verifyJob = [&](std::size_t j) {
+      const auto& job = jobs[j];
+      auto& result = results[job.index];
+      try {
+        const auto token = tokens[job.index];
+        result.claims = job.key
+          ? verifyWith(token, kDefaultDecodePath, [&](std::string_view) { return job.key; })
+          : verifyUncached(token, kDefaultDecodePath);
+        tokens_.insert(token, result.claims);
+      } catch (const std::exception& e) {
+        result.error = e.what();
+      }
+    };
+    if (pool) {
+      pool->parallelFor(jobs.size(), verifyJob);
+    } else {
+      for (std::size_t j = 0; j < jobs.size(); ++j) verifyJob(j);
+    }
+
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+      if (dup[i] != i) results[i] = results[dup[i]];
+    }
+    return results;
   }
 
+  JwksCache& jwks() noexcept { return jwks_; }
+
+  TokenCache::Stats tokenCacheStats() { return tokens_.stats(); }
+
+  /**
+   * Dauer von verify/verifyNonBlocking inkl. Cache-Treffern und Fehlern (Sharded, für /metrics).
+   */
+  const metrics::LatencyHistogram& verifyLatency() const noexcept { return verifyLatency_; }
+
   const std::shared_ptr<AuthConfig>& config() const noexcept { return cfg_; }
 };
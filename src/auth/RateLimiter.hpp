@@ -0,0 +1,178 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include <arpa/inet.h>
+
+/**
+ * RateLimiter
+ * - Token Bucket pro Schlüssel (sub, azp oder Client-IP): rate Tokens/s, höchstens burst auf Vorrat
+ * - Refill lazy beim Zugriff aus der verstrichenen Zeit, kein Timer-Thread
+ * - Tabelle in 64 Shards (je Mutex + Hash-Map), Schlüssel ist nur der 64-Bit-Hash → kein String pro Request;
+ *   eine Kollision teilt sich höchstens einen Bucket
+ * - Buckets pro Shard in LRU-Reihenfolge (zuletzt benutzt vorne); der hinterste ist auch der vollste,
+ *   weil alle gleich schnell nachfüllen
+ * - Idle-Eviction: ein Bucket, der wieder voll wäre, ist gleichwertig zu "nicht vorhanden" und wird beim
+ *   Aufräumen vom LRU-Ende entfernt (alle 4096 Zugriffe oder wenn der Shard voll ist; O(entfernte), kein Scan);
+ *   ist der Shard dann noch voll, wird der am längsten unbenutzte Bucket für den neuen Schlüssel
+ *   wiederverwendet → Speicher bleibt bei maxKeys gedeckelt, aktive (z.B. gerade gedrosselte) Schlüssel bleiben
+ * - hashAddress: IPv4 pro Adresse, IPv6 pro /64 (ein Anschluss bekommt meist ein ganzes /64)
+ * - rate == 0 → aus (acquire lässt alles durch)
+ */
+class RateLimiter {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Limit {
+    double ratePerSec = 0;
+    double burst = 0;
+  };
+
+  struct Decision {
+    bool allowed = true;
+    std::int64_t limit = 0;         // burst
+    std::int64_t remaining = 0;     // ganze Tokens nach diesem Request
+    std::int64_t resetSec = 0;      // bis der Bucket wieder voll ist
+    std::int64_t retryAfterSec = 0; // bis zum nächsten Token (nur bei !allowed)
+  };
+
+private:
+  static constexpr std::size_t kShards = 64;
+  static constexpr std::uint32_t kSweepEvery = 4096;
+
+  struct Bucket {
+    std::uint64_t key;
+    double tokens;
+    std::int64_t lastNs;
+  };
+
+  struct alignas(64) Shard {
+    std::mutex m;
+    std::list<Bucket> lru; // vorne zuletzt benutzt
+    std::unordered_map<std::uint64_t, std::list<Bucket>::iterator> buckets;
+    std::uint32_t ops = 0;
+  };
+
+  Limit limit_;
+  std::int64_t fullRefillNs_;
+  std::size_t shardCapacity_;
+  std::array<Shard, kShards> shards_;
+
+  static std::int64_t ns(Clock::time_point t) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+  }
+
+  Shard& shardFor(std::uint64_t h) {
+    return shards_[(h ^ (h >> 32)) & (kShards - 1)];
+  }
+
+  // idle Buckets vom LRU-Ende entfernen, bis der erste aktive kommt
+  void sweep(Shard& s, std::int64_t now) {
+    while (!s.lru.empty() && now - s.lru.back().lastNs >= fullRefillNs_) {
+      s.buckets.erase(s.lru.back().key);
+      s.lru.pop_back();
+    }
+  }
+
+public:
+  RateLimiter(Limit limit, std::size_t maxKeys)
+    : limit_{limit.ratePerSec, std::max(1.0, limit.burst > 0 ? limit.burst : limit.ratePerSec)}
+    , fullRefillNs_(limit.ratePerSec > 0 ? (std::int64_t) (limit_.burst / limit.ratePerSec * 1e9) : 0)
+    , shardCapacity_(std::max<std::size_t>(1, (maxKeys + kShards - 1) / kShards))
+  {}
+
+  bool enabled() const noexcept { return limit_.ratePerSec > 0; }
+
+  const Limit& limit() const noexcept { return limit_; }
+
+  static std::uint64_t hashKey(std::string_view key) {
+    return std::hash<std::string_view>{}(key);
+  }
+
+  /**
+   * Schlüssel für eine Client-Adresse: IPv4 (auch IPv4-mapped IPv6) als 4 Bytes, IPv6 als /64-Präfix;
+   * "[...]" und Zone ("%eth0") werden ignoriert. Nicht parsebar → Hash des Textes.
+   */
+  static std::uint64_t hashAddress(std::string_view address) {
+    if (address.size() >= 2 && address.front() == '[' && address.back() == ']') {
+      address = address.substr(1, address.size() - 2);
+    }
+    address = address.substr(0, address.find('%'));
+    char text[INET6_ADDRSTRLEN];
+    if (address.size() >= sizeof(text)) return hashKey(address);
+    std::memcpy(text, address.data(), address.size());
+    text[address.size()] = '\0';
+
+    unsigned char bytes[16];
+    if (::inet_pton(AF_INET, text, bytes) == 1) {
+      return hashKey(std::string_view(reinterpret_cast<const char*>(bytes), 4));
+    }
+    if (::inet_pton(AF_INET6, text, bytes) == 1) {
+      static constexpr unsigned char kMapped[12] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff};
+      if (std::memcmp(bytes, kMapped, sizeof(kMapped)) == 0) {
+        return hashKey(std::string_view(reinterpret_cast<const char*>(bytes + 12), 4));
+      }
+      return hashKey(std::string_view(reinterpret_cast<const char*>(bytes), 8));
+    }
+    return hashKey(address);
+  }
+
+  Decision acquire(std::uint64_t key, Clock::time_point at = Clock::now()) {
+    Decision d;
+    d.limit = (std::int64_t) limit_.burst;
+    if (!enabled()) return d;
+
+    const auto now = ns(at);
+    auto& s = shardFor(key);
+    std::scoped_lock lk(s.m);
+
+    if (++s.ops % kSweepEvery == 0) sweep(s, now);
+    auto found = s.buckets.find(key);
+    if (found == s.buckets.end()) {
+      if (s.buckets.size() >= shardCapacity_) sweep(s, now);
+      if (s.buckets.size() >= shardCapacity_) {
+        // am längsten unbenutzten Bucket übernehmen (Knoten wiederverwenden, keine Allokation)
+        s.buckets.erase(s.lru.back().key);
+        s.lru.splice(s.lru.begin(), s.lru, std::prev(s.lru.end()));
+        s.lru.front() = Bucket{key, limit_.burst, now};
+      } else {
+        s.lru.push_front(Bucket{key, limit_.burst, now});
+      }
+      s.buckets.emplace(key, s.lru.begin());
+    } else {
+      s.lru.splice(s.lru.begin(), s.lru, found->second);
+      auto& b = s.lru.front();
+      const auto elapsed = std::max<std::int64_t>(0, now - b.lastNs);
+      b.tokens = std::min(limit_.burst, b.tokens + (double) elapsed * limit_.ratePerSec / 1e9);
+      b.lastNs = now;
+    }
+
+    auto& b = s.lru.front();
+    if (b.tokens >= 1.0) {
+      b.tokens -= 1.0;
+    } else {
+      d.allowed = false;
+      d.retryAfterSec = std::max<std::int64_t>(1, (std::int64_t) std::ceil((1.0 - b.tokens) / limit_.ratePerSec));
+    }
+    d.remaining = (std::int64_t) b.tokens;
+    d.resetSec = (std::int64_t) std::ceil((limit_.burst - b.tokens) / limit_.ratePerSec);
+    return d;
+  }
+
+  std::size_t size() {
+    std::size_t n = 0;
+    for (auto& s : shards_) {
+      std::scoped_lock lk(s.m);
+      n += s.buckets.size();
+    }
+    return n;
+  }
+};
@@ -0,0 +1,111 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * RouteMatcher
+ * - Byte-Trie über geschützte Pfade, einmal beim Start gebaut
+ * - Präfix-Einträge (SECURE_PATH_PREFIXES) und Endpoint-Pfade (Endpoint-Flags) wie im oatpp-Router:
+ *   exakt, mit Variablen ("{id}" = ein oder mehr Bytes eines Segments, kein '/') und "*" am Ende (Rest beliebig)
+ * - matches() läuft direkt über die Pfad-Bytes des Requests, ohne Allokation; an Variablen-Knoten wird
+ *   zurückverfolgt (Segmente sind kurz); Query-String ('?...') wird ignoriert
+ * - nach dem Serverstart nur noch lesend benutzen (nicht synchronisiert)
+ */
+class RouteMatcher {
+  struct Node {
+    std::vector<std::pair<unsigned char, std::uint32_t>> children; // sortiert nach Byte
+    std::uint32_t variable = 0; // Knoten nach einem "{...}"-Segment, 0 = keiner
+    bool prefixEnd = false;
+    bool exactEnd = false;
+  };
+  std::vector<Node> nodes_{1};
+
+  std::uint32_t child(std::uint32_t node, unsigned char c) const {
+    const auto& ch = nodes_[node].children;
+    auto it = std::lower_bound(ch.begin(), ch.end(), c,
+      [](const std::pair<unsigned char, std::uint32_t>& e, unsigned char v) { return e.first < v; });
+    return (it != ch.end() && it->first == c) ? it->second : 0; // 0 = Wurzel = "kein Kind"
+  }
+
+  std::uint32_t addChild(std::uint32_t node, unsigned char c) {
+    auto next = child(node, c);
+    if (next != 0) return next;
+    next = (std::uint32_t) nodes_.size();
+    nodes_.emplace_back();
+    auto& ch = nodes_[node].children;
+    auto it = std::lower_bound(ch.begin(), ch.end(), c,
+      [](const std::pair<unsigned char, std::uint32_t>& e, unsigned char v) { return e.first < v; });
+    ch.insert(it, {c, next});
+    return next;
+  }
+
+  std::uint32_t insert(std::string_view path) {
+    std::uint32_t node = 0;
+    for (unsigned char c : path) node = addChild(node, c);
+    return node;
+  }
+
+  bool matchFrom(std::uint32_t node, std::string_view path, std::size_t i) const {
+    for (;; ++i) {
+      const auto& n = nodes_[node];
+      if (n.prefixEnd) return true;
+      if (n.variable != 0) {
+        const auto segmentEnd = std::min(path.find('/', i), path.size());
+        for (auto end = i + 1; end <= segmentEnd; ++end) {
+          if (matchFrom(n.variable, path, end)) return true;
+        }
+      }
+      if (i == path.size()) return n.exactEnd;
+      node = child(node, (unsigned char) path[i]);
+      if (node == 0) return false;
+    }
+  }
+
+public:
+
+  void addPrefix(std::string_view prefix) {
+    nodes_[insert(prefix)].prefixEnd = true;
+  }
+
+  void addExact(std::string_view path) {
+    nodes_[insert(path)].exactEnd = true;
+  }
+
+  /**
+   * Endpoint-Pfad registrieren, Segment für Segment wie der Router: "/api/x/{id}" schützt "/api/x/42",
+   * aber nicht "/api/x/42/y" oder "/api/xy"; ein "*" am Ende schützt alles ab dort.
+   */
+  void addEndpointPath(std::string_view pattern) {
+    std::uint32_t node = 0;
+    for (std::size_t i = 0; i < pattern.size(); ++i) {
+      if (pattern[i] == '*' && i + 1 == pattern.size()) {
+        nodes_[node].prefixEnd = true;
+        return;
+      }
+      const auto close = pattern[i] == '{' ? pattern.find('}', i) : std::string_view::npos;
+      if (close != std::string_view::npos) {
+        if (nodes_[node].variable == 0) {
+          const auto next = (std::uint32_t) nodes_.size();
+          nodes_.emplace_back();
+          nodes_[node].variable = next;
+        }
+        node = nodes_[node].variable;
+        i = close;
+      } else {
+        node = addChild(node, (unsigned char) pattern[i]);
+      }
+    }
+    nodes_[node].exactEnd = true;
+  }
+
+  bool matches(std::string_view path) const {
+    return matchFrom(0, path.substr(0, path.find('?')), 0);
+  }
+
+  bool empty() const noexcept {
+    return nodes_.size() == 1 && !nodes_[0].prefixEnd && !nodes_[0].exactEnd && nodes_[0].variable == 0;
+  }
+};
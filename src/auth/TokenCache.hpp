@@ -0,0 +1,126 @@
+#pragma once
+#include "VerifiedClaims.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * TokenCache
+ * - begrenzter, geshardeter Cache: hash(token) -> bereits verifizierte Claims
+ * - Einträge leben bis exp - leeway, Verdrängung per LRU (abgelaufene fallen beim Zugriff raus)
+ * - Treffer kostet einen Hash + einen Lookup, kein base64-Decoding, kein OpenSSL
+ * - Token wird beim Treffer voll verglichen → Hash-Kollisionen können kein fremdes Token "freischalten"
+ * - capacity == 0 → Cache deaktiviert
+ */
+class TokenCache {
+public:
+  struct Stats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::size_t size = 0;
+  };
+
+private:
+  static constexpr std::size_t kShards = 16;
+
+  struct Entry {
+    std::size_t hash;
+    std::string token;
+    std::int64_t validUntil; // Sekunden seit Epoch
+    std::shared_ptr<const VerifiedClaims> claims;
+  };
+
+  struct Shard {
+    std::mutex m;
+    std::list<Entry> lru; // front = zuletzt benutzt
+    std::unordered_map<std::size_t, std::list<Entry>::iterator> index;
+  };
+
+  const std::size_t shardCapacity_;
+  const int leewaySec_;
+  std::array<Shard, kShards> shards_;
+  std::atomic<std::uint64_t> hits_{0};
+  std::atomic<std::uint64_t> misses_{0};
+
+  static std::int64_t nowSec() {
+    return std::chrono::duration_cast<std::chrono::seconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+  }
+  Shard& shardFor(std::size_t h) {
+    return shards_[(h ^ (h >> 29)) & (kShards - 1)];
+  }
+
+public:
+  TokenCache(std::size_t capacity, int leewaySec)
+    : shardCapacity_(capacity == 0 ? 0 : (capacity + kShards - 1) / kShards)
+    , leewaySec_(leewaySec)
+  {}
+
+  bool enabled() const noexcept { return shardCapacity_ > 0; }
+
+  std::shared_ptr<const VerifiedClaims> find(std::string_view token) {
+    if (!enabled()) return nullptr;
+    const auto h = std::hash<std::string_view>{}(token);
+    const auto now = nowSec();
+    auto& s = shardFor(h);
+    {
+      std::scoped_lock lk(s.m);
+      auto it = s.index.find(h);
+      if (it != s.index.end() && it->second->token == token) {
+        if (it->second->validUntil > now) {
+          s.lru.splice(s.lru.begin(), s.lru, it->second);
+          hits_.fetch_add(1, std::memory_order_relaxed);
+          return it->second->claims;
+        }
+        s.lru.erase(it->second); // abgelaufen
+        s.index.erase(it);
+      }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  void insert(std::string_view token, std::shared_ptr<const VerifiedClaims> claims) {
+    if (!enabled() || !claims || claims->expiresAt == 0) return; // ohne exp keine Obergrenze → nicht cachen
+    const auto validUntil = claims->expiresAt - leewaySec_;
+    if (validUntil <= nowSec()) return;
+
+    const auto h = std::hash<std::string_view>{}(token);
+    auto& s = shardFor(h);
+    std::scoped_lock lk(s.m);
+    auto it = s.index.find(h);
+    if (it != s.index.end()) {
+      // gleiches Token erneut verifiziert oder Kollision → Eintrag ersetzen
+      auto& e = *it->second;
+      e.token.assign(token.data(), token.size());
+      e.validUntil = validUntil;
+      e.claims = std::move(claims);
+      s.lru.splice(s.lru.begin(), s.lru, it->second);
+      return;
+    }
+    s.lru.push_front(Entry{h, std::string(token), validUntil, std::move(claims)});
+    s.index.emplace(h, s.lru.begin());
+    while (s.lru.size() > shardCapacity_) {
+      s.index.erase(s.lru.back().hash);
+      s.lru.pop_back();
+    }
+  }
+
+  Stats stats() {
+    Stats st;
+    st.hits = hits_.load(std::memory_order_relaxed);
+    st.misses = misses_.load(std::memory_order_relaxed);
+    for (auto& s : shards_) {
+      std::scoped_lock lk(s.m);
+      st.size += s.lru.size();
+    }
+    return st;
+  }
+};
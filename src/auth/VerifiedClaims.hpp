@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * VerifiedClaims
+ * - schlanke, unveränderliche Sicht auf ein bereits geprüftes Token
+ * - wird im TokenCache gehalten und an Aufrufer weitergereicht (kein erneutes Decoding)
+ */
+struct VerifiedClaims {
+  std::string subject;         // sub
+  std::string authorizedParty; // azp (Keycloak: Client-ID)
+  std::int64_t expiresAt = 0;  // exp (Sekunden seit Epoch), 0 = kein exp
+};
@@ -0,0 +1 @@
+#include "MetricsAsyncController.hpp"
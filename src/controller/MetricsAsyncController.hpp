@@ -0,0 +1,50 @@
+#ifndef MetricsAsyncController_hpp
+#define MetricsAsyncController_hpp
+
+#include "auth/AuthInterceptor.hpp"
+#include "metrics/MetricsExporter.hpp"
+
+#include "oatpp/web/server/api/ApiController.hpp"
+#include "oatpp/macro/codegen.hpp"
+#include "oatpp/macro/component.hpp"
+
+#include OATPP_CODEGEN_BEGIN(ApiController) //<-- Begin Codegen
+
+/**
+ * Async variant of MetricsController (SERVER_MODE=async).
+ */
+class MetricsAsyncController : public oatpp::web::server::api::ApiController {
+private:
+  OATPP_COMPONENT(std::shared_ptr<MetricsExporter>, m_exporter);
+public:
+  /**
+   * Constructor with object mapper.
+   * @param apiContentMappers - mappers used to serialize/deserialize DTOs.
+   */
+  MetricsAsyncController(OATPP_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, apiContentMappers))
+    : oatpp::web::server::api::ApiController(apiContentMappers)
+  {}
+public:
+
+  ENDPOINT_INFO(Metrics) {
+    info->summary = "Laufzeit-Metriken im Prometheus-Format";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+    info->addResponse<String>(Status::CODE_200, MetricsExporter::CONTENT_TYPE);
+  }
+  ENDPOINT_ASYNC("GET", "/metrics", Metrics) {
+
+    ENDPOINT_ASYNC_INIT(Metrics)
+
+    Action act() override {
+      auto response = controller->createResponse(Status::CODE_200, controller->m_exporter->render());
+      response->putHeader(Header::CONTENT_TYPE, MetricsExporter::CONTENT_TYPE);
+      return _return(response);
+    }
+
+  };
+
+};
+
+#include OATPP_CODEGEN_END(ApiController) //<-- End Codegen
+
+#endif /* MetricsAsyncController_hpp */
@@ -0,0 +1 @@
+#include "MetricsController.hpp"
@@ -0,0 +1,45 @@
+#ifndef MetricsController_hpp
+#define MetricsController_hpp
+
+#include "auth/AuthInterceptor.hpp"
+#include "metrics/MetricsExporter.hpp"
+
+#include "oatpp/web/server/api/ApiController.hpp"
+#include "oatpp/macro/codegen.hpp"
+#include "oatpp/macro/component.hpp"
+
+#include OATPP_CODEGEN_BEGIN(ApiController) //<-- Begin Codegen
+
+/**
+ * Prometheus-Scrape-Endpoint (Textformat 0.0.4).
+ * Trägt das Security-Requirement; geschützt ist er, wenn AppControllers ihn per protectEndpoints anmeldet (METRICS).
+ */
+class MetricsController : public oatpp::web::server::api::ApiController {
+private:
+  OATPP_COMPONENT(std::shared_ptr<MetricsExporter>, m_exporter);
+public:
+  /**
+   * Constructor with object mapper.
+   * @param apiContentMappers - mappers used to serialize/deserialize DTOs.
+   */
+  MetricsController(OATPP_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, apiContentMappers))
+    : oatpp::web::server::api::ApiController(apiContentMappers)
+  {}
+public:
+
+  ENDPOINT_INFO(metrics) {
+    info->summary = "Laufzeit-Metriken im Prometheus-Format";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+    info->addResponse<String>(Status::CODE_200, MetricsExporter::CONTENT_TYPE);
+  }
+  ENDPOINT("GET", "/metrics", metrics) {
+    auto response = createResponse(Status::CODE_200, m_exporter->render());
+    response->putHeader(Header::CONTENT_TYPE, MetricsExporter::CONTENT_TYPE);
+    return response;
+  }
+
+};
+
+#include OATPP_CODEGEN_END(ApiController) //<-- End Codegen
+
+#endif /* MetricsController_hpp */
@@ -0,0 +1 @@
+#include "MyAsyncController.hpp"
@@ -0,0 +1,44 @@
+#ifndef MyAsyncController_hpp
+#define MyAsyncController_hpp
+
+#include "dto/DTOs.hpp"
+#include "server/HelloResponse.hpp"
+
+#include "oatpp/web/server/api/ApiController.hpp"
+#include "oatpp/macro/codegen.hpp"
+#include "oatpp/macro/component.hpp"
+
+#include OATPP_CODEGEN_BEGIN(ApiController) //<-- Begin Codegen
+
+/**
+ * Async variant of MyController (SERVER_MODE=async).
+ */
+class MyAsyncController : public oatpp::web::server::api::ApiController {
+private:
+  StaticResponse m_hello;
+public:
+  /**
+   * Constructor with object mapper.
+   * @param apiContentMappers - mappers used to serialize/deserialize DTOs.
+   */
+  MyAsyncController(OATPP_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, apiContentMappers))
+    : oatpp::web::server::api::ApiController(apiContentMappers)
+    , m_hello(HelloResponse::create(apiContentMappers->getDefaultMapper()))
+  {}
+public:
+
+  ENDPOINT_ASYNC("GET", "/", Root) {
+
+    ENDPOINT_ASYNC_INIT(Root)
+
+    Action act() override {
+      return _return(controller->m_hello.respond());
+    }
+
+  };
+
+};
+
+#include OATPP_CODEGEN_END(ApiController) //<-- End Codegen
+
+#endif /* MyAsyncController_hpp */
@@ -0,0 +1 @@
+#include "MyAuthAsyncController.hpp"
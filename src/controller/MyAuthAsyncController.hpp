@@ -0,0 +1,60 @@
+#ifndef MyAuthAsyncController_hpp
+#define MyAuthAsyncController_hpp
+
+#include "dto/DTOs.hpp"
+#include "server/HelloResponse.hpp"
+#include "auth/AuthInterceptor.hpp"
+
+#include "oatpp/web/server/api/ApiController.hpp"
+#include "oatpp/macro/codegen.hpp"
+#include "oatpp/macro/component.hpp"
+
+#include OATPP_CODEGEN_BEGIN(ApiController) //<-- Begin Codegen
+
+/**
+ * Async variant of MyAuthController (SERVER_MODE=async).
+ * Auth runs in AsyncAuthInterceptor before the coroutine is started.
+ */
+class MyAuthAsyncController : public oatpp::web::server::api::ApiController {
+private:
+  StaticResponse m_hello;
+public:
+  /**
+   * Constructor with object mapper.
+   * @param apiContentMappers - mappers used to serialize/deserialize DTOs.
+   */
+  MyAuthAsyncController(OATPP_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, apiContentMappers))
+    : oatpp::web::server::api::ApiController(apiContentMappers)
+    , m_hello(HelloResponse::create(apiContentMappers->getDefaultMapper()))
+  {}
+public:
+
+  ENDPOINT_ASYNC("GET", "/api/public/ping", PublicPing) {
+
+    ENDPOINT_ASYNC_INIT(PublicPing)
+
+    Action act() override {
+      return _return(controller->m_hello.respond());
+    }
+
+  };
+
+  ENDPOINT_INFO(SecurePing) {
+    info->summary = "Ping, nur mit gültigem Bearer Token";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+  }
+  ENDPOINT_ASYNC("GET", "/api/secure/ping", SecurePing) {
+
+    ENDPOINT_ASYNC_INIT(SecurePing)
+
+    Action act() override {
+      return _return(controller->m_hello.respond());
+    }
+
+  };
+
+};
+
+#include OATPP_CODEGEN_END(ApiController) //<-- End Codegen
+
+#endif /* MyAuthAsyncController_hpp */
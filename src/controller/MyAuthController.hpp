@@ -2,6 +2,8 @@
 #define MyAuthController_hpp
 
 #include "dto/DTOs.hpp"
+#include "server/HelloResponse.hpp"
+#include "auth/AuthInterceptor.hpp"
 
 #include "oatpp/web/server/api/ApiController.hpp"
 #include "oatpp/macro/codegen.hpp"
@@ -13,6 +15,8 @@
  * Sample Api Controller.
  */
 class MyAuthController : public oatpp::web::server::api::ApiController {
+private:
+  StaticResponse m_hello;
 public:
   /**
    * Constructor with object mapper.
@@ -20,21 +24,20 @@ public:
    */
   MyAuthController(OATPP_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, apiContentMappers))
     : oatpp::web::server::api::ApiController(apiContentMappers)
+    , m_hello(HelloResponse::create(apiContentMappers->getDefaultMapper()))
   {}
 public:
 
   ENDPOINT("GET", "/api/public/ping", publicPing) {
-    auto dto = MyDto::createShared();
-    dto->statusCode = 200;
-    dto->message = "Hello World!";
-    return createDtoResponse(Status::CODE_200, dto);
+    return m_hello.respond();
   }
 
-    ENDPOINT("GET", "/api/secure/ping", securePing) {
-    auto dto = MyDto::createShared();
-    dto->statusCode = 200;
-    dto->message = "Hello World!";
-    return createDtoResponse(Status::CODE_200, dto);
+  ENDPOINT_INFO(securePing) {
+    info->summary = "Ping, nur mit gültigem Bearer Token";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+  }
+  ENDPOINT("GET", "/api/secure/ping", securePing) {
+    return m_hello.respond();
   }
   
   
@@ -2,6 +2,7 @@
 #define MyController_hpp
 
 #include "dto/DTOs.hpp"
+#include "server/HelloResponse.hpp"
 
 #include "oatpp/web/server/api/ApiController.hpp"
 #include "oatpp/macro/codegen.hpp"
@@ -13,6 +14,8 @@
  * Sample Api Controller.
  */
 class MyController : public oatpp::web::server::api::ApiController {
+private:
+  StaticResponse m_hello;
 public:
   /**
    * Constructor with object mapper.
@@ -20,14 +23,12 @@ public:
    */
   MyController(OATPP_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, apiContentMappers))
     : oatpp::web::server::api::ApiController(apiContentMappers)
+    , m_hello(HelloResponse::create(apiContentMappers->getDefaultMapper()))
   {}
 public:
   
   ENDPOINT("GET", "/", root) {
-    auto dto = MyDto::createShared();
-    dto->statusCode = 200;
-    dto->message = "Hello World!";
-    return createDtoResponse(Status::CODE_200, dto);
+    return m_hello.respond();
   }
   
   // TODO Insert Your endpoints here !!!
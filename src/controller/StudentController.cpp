@@ -0,0 +1 @@
+#include "StudentController.hpp"
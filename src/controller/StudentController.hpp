@@ -0,0 +1,272 @@
+#ifndef StudentController_hpp
+#define StudentController_hpp
+
+#include "dto/DTOs.hpp"
+#include "model/StudentRepository.hpp"
+#include "auth/AuthInterceptor.hpp"
+
+#include "oatpp/web/server/api/ApiController.hpp"
+#include "oatpp/macro/codegen.hpp"
+#include "oatpp/macro/component.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+#include OATPP_CODEGEN_BEGIN(ApiController) //<-- Begin Codegen
+
+/**
+ * CRUD für Studenten über model::StudentRepository.
+ * - Einzelzugriffe per id in O(1); GET /api/students liefert Seiten (offset/limit, höchstens kMaxPageSize)
+ * - DTOs werden direkt aus dem Datensatz unter der Lesesperre gebaut (keine Zwischenkopie)
+ * - Kurs- und Universitätsnamen werden beim Schreiben interniert (SymbolTable::global()), beim Lesen aufgelöst;
+ *   erst nach der vollständigen Prüfung (Namen höchstens kMaxNameLength, höchstens kMaxCourses Kurse) und
+ *   nur für Schreibzugriffe, die das Repository annimmt → abgelehnte Requests füllen die Tabelle nicht
+ * - GET /api/students/top?k= aus dem Leaderboard (O(k)), das das Repository bei jedem Schreiben mitführt
+ * - POST/PUT lesen den Body selbst: nur mit Content-Length (411 sonst) und höchstens kMaxBodyBytes (413);
+ *   voller Speicherdeckel des Repositorys bzw. erschöpfte IDs → 507
+ * - alle Endpoints verlangen einen Bearer Token (SECURITY_SCHEME, per AuthInterceptor::protectEndpoints angemeldet);
+ *   der Schutz gilt pro Pfad, nicht pro Methode → lesende Endpoints unter denselben Pfaden sind mitgeschützt
+ */
+class StudentController : public oatpp::web::server::api::ApiController {
+public:
+  static constexpr std::size_t kDefaultPageSize = 50;
+  static constexpr std::size_t kMaxPageSize = 1000;
+  static constexpr std::size_t kMaxBodyBytes = 16 * 1024;
+  static constexpr std::size_t kMaxNameLength = 256;
+  static constexpr std::size_t kMaxCourses = 64;
+private:
+  std::shared_ptr<model::StudentRepository> m_students;
+  std::shared_ptr<model::Leaderboard> m_leaderboard;
+
+  static oatpp::Object<StudentDto> toDto(const model::StudentRecord& r) {
+    auto dto = StudentDto::createShared();
+    dto->id = r.id;
+    dto->firstName = r.firstName;
+    dto->lastName = r.lastName;
+    dto->age = r.age;
+    dto->gpa = r.gpa;
+    const auto& symbols = model::SymbolTable::global();
+    if (r.university != model::kNoSymbol) dto->university = symbols.name(r.university);
+    dto->courses = oatpp::List<oatpp::String>::createShared();
+    for (auto c : r.courses) dto->courses->push_back(symbols.name(c));
+    return dto;
+  }
+
+  /**
+   * Prüft den Body vollständig und übernimmt die Felder ohne Namen-IDs; interniert wird erst in internNames.
+   */
+  static model::StudentRecord toRecord(const oatpp::Object<StudentDto>& dto) {
+    OATPP_ASSERT_HTTP(dto, Status::CODE_400, "body missing");
+    OATPP_ASSERT_HTTP(dto->firstName && dto->lastName, Status::CODE_400, "firstName and lastName required");
+    OATPP_ASSERT_HTTP(dto->firstName->size() <= kMaxNameLength && dto->lastName->size() <= kMaxNameLength
+                      && (!dto->university || dto->university->size() <= kMaxNameLength),
+                      Status::CODE_400, "name too long");
+    OATPP_ASSERT_HTTP(!dto->age || *dto->age >= 0, Status::CODE_400, "age must not be negative");
+    OATPP_ASSERT_HTTP(!dto->gpa || *dto->gpa >= 0, Status::CODE_400, "gpa must not be negative");
+    if (dto->courses) {
+      OATPP_ASSERT_HTTP(dto->courses->size() <= kMaxCourses, Status::CODE_400, "too many courses");
+      for (const auto& c : *dto->courses) {
+        OATPP_ASSERT_HTTP(!c || c->size() <= kMaxNameLength, Status::CODE_400, "name too long");
+      }
+    }
+    model::StudentRecord r;
+    r.id = dto->id ? *dto->id : 0;
+    r.firstName = *dto->firstName;
+    r.lastName = *dto->lastName;
+    r.age = dto->age ? *dto->age : 0;
+    r.gpa = dto->gpa ? *dto->gpa : 0.0;
+    return r;
+  }
+
+  /**
+   * Universität und Kurse internieren - als prepare-Callback des Repositorys, also nur für Schreibzugriffe,
+   * die gelingen (kein Konflikt, kein 404, kein voller Speicher). Alle Namen in einem internAll(): ist die
+   * Tabelle für einen davon zu voll, wird keiner angelegt (400).
+   */
+  static void internNames(const oatpp::Object<StudentDto>& dto, model::StudentRecord& r) {
+    const bool hasUniversity = dto->university && !dto->university->empty();
+    std::vector<std::string_view> names;
+    names.reserve(1 + (dto->courses ? dto->courses->size() : 0));
+    if (hasUniversity) names.emplace_back(*dto->university);
+    if (dto->courses) {
+      for (const auto& c : *dto->courses) {
+        if (c) names.emplace_back(*c);
+      }
+    }
+    if (names.empty()) return;
+    std::vector<model::SymbolId> ids;
+    OATPP_ASSERT_HTTP(model::SymbolTable::global().internAll(names, ids), Status::CODE_400, "too many distinct names");
+    auto id = ids.begin();
+    if (hasUniversity) r.university = *id++;
+    r.courses.reserve((std::size_t) (ids.end() - id));
+    for (; id != ids.end(); ++id) r.courses.add(*id); // doppelte Kurse fallen weg
+  }
+
+  /**
+   * Nicht-negative Dezimalzahl ohne Überlauf (strtoull allein nimmt "-1" und setzt bei Überlauf nur ERANGE).
+   */
+  static bool parseSize(const oatpp::String& value, std::size_t& out) {
+    char* end = nullptr;
+    errno = 0;
+    const auto v = std::strtoull(value->c_str(), &end, 10);
+    if (value->empty() || *end != '\0' || (*value)[0] == '-' || errno == ERANGE) return false;
+    out = (std::size_t) v;
+    return true;
+  }
+
+  static std::size_t sizeParam(const oatpp::String& value, std::size_t fallback) {
+    if (!value || value->empty()) return fallback;
+    std::size_t v = 0;
+    OATPP_ASSERT_HTTP(parseSize(value, v), Status::CODE_400, "offset/limit/k must be non-negative integers");
+    return v;
+  }
+
+  /**
+   * Body als StudentDto, vor dem Lesen begrenzt: chunked ohne Länge → 411, größer als kMaxBodyBytes → 413.
+   */
+  oatpp::Object<StudentDto> readStudent(const std::shared_ptr<IncomingRequest>& request) {
+    using Header = oatpp::web::protocol::http::Header;
+    OATPP_ASSERT_HTTP(!request->getHeader(Header::TRANSFER_ENCODING), Status::CODE_411, "Content-Length required");
+    const auto length = request->getHeader(Header::CONTENT_LENGTH);
+    std::size_t bytes = 0;
+    OATPP_ASSERT_HTTP(!length || parseSize(length, bytes), Status::CODE_400, "invalid Content-Length");
+    OATPP_ASSERT_HTTP(bytes <= kMaxBodyBytes, Status::CODE_413, "body too large");
+    if (bytes == 0) return nullptr;
+    return request->readBodyToDto<oatpp::Object<StudentDto>>(getContentMappers()->getDefaultMapper());
+  }
+
+public:
+  /**
+   * @param apiContentMappers - mappers used to serialize/deserialize DTOs.
+   * @param students - shared repository.
+   * @param leaderboard - ranking attached to `students` (see StudentRepository::setLeaderboard).
+   */
+  StudentController(const std::shared_ptr<oatpp::web::mime::ContentMappers>& apiContentMappers,
+                    std::shared_ptr<model::StudentRepository> students,
+                    std::shared_ptr<model::Leaderboard> leaderboard)
+    : oatpp::web::server::api::ApiController(apiContentMappers)
+    , m_students(std::move(students))
+    , m_leaderboard(std::move(leaderboard))
+  {}
+public:
+
+  ENDPOINT_INFO(listStudents) {
+    info->summary = "Studenten seitenweise (Speicherreihenfolge)";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+    info->queryParams.add<UInt64>("offset").required = false;
+    info->queryParams.add<UInt64>("limit").required = false;
+    info->addResponse<Object<StudentPageDto>>(Status::CODE_200, "application/json");
+  }
+  ENDPOINT("GET", "/api/students", listStudents,
+           REQUEST(std::shared_ptr<IncomingRequest>, request)) {
+    const auto offset = sizeParam(request->getQueryParameter("offset"), 0);
+    const auto limit = std::min(sizeParam(request->getQueryParameter("limit"), kDefaultPageSize), kMaxPageSize);
+
+    auto page = StudentPageDto::createShared();
+    page->offset = (v_uint64) offset;
+    page->limit = (v_uint64) limit;
+    page->items = oatpp::List<oatpp::Object<StudentDto>>::createShared();
+    page->total = (v_uint64) m_students->page(offset, limit, [&](const model::StudentRecord& r) {
+      page->items->push_back(toDto(r));
+    });
+    return createDtoResponse(Status::CODE_200, page);
+  }
+
+  ENDPOINT_INFO(topStudents) {
+    info->summary = "Beste k Studenten nach GPA (dann Name), höchstens kMaxPageSize";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+    info->queryParams.add<UInt64>("k").required = false;
+    info->addResponse<List<Object<StudentDto>>>(Status::CODE_200, "application/json");
+  }
+  // vor /api/students/{id} deklariert, damit "top" nicht als id geroutet wird
+  ENDPOINT("GET", "/api/students/top", topStudents,
+           REQUEST(std::shared_ptr<IncomingRequest>, request)) {
+    const auto k = std::min(sizeParam(request->getQueryParameter("k"), 10), kMaxPageSize);
+    auto items = oatpp::List<oatpp::Object<StudentDto>>::createShared();
+    for (auto id : m_leaderboard->top(k)) {
+      m_students->read(id, [&](const model::StudentRecord& r) { items->push_back(toDto(r)); }); // gerade gelöscht → fehlt
+    }
+    return createDtoResponse(Status::CODE_200, items);
+  }
+
+  ENDPOINT_INFO(getStudent) {
+    info->summary = "Student per id";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+    info->addResponse<Object<StudentDto>>(Status::CODE_200, "application/json");
+    info->addResponse<String>(Status::CODE_404, "text/plain");
+  }
+  ENDPOINT("GET", "/api/students/{id}", getStudent,
+           PATH(Int32, id)) {
+    oatpp::Object<StudentDto> dto;
+    const bool found = m_students->read(id, [&](const model::StudentRecord& r) { dto = toDto(r); });
+    OATPP_ASSERT_HTTP(found, Status::CODE_404, "student not found");
+    return createDtoResponse(Status::CODE_200, dto);
+  }
+
+  ENDPOINT_INFO(createStudent) {
+    info->summary = "Student anlegen (ohne id → vom Server vergeben)";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+    info->addConsumes<Object<StudentDto>>("application/json");
+    info->addResponse<Object<StudentDto>>(Status::CODE_201, "application/json");
+    info->addResponse<String>(Status::CODE_409, "text/plain");
+    info->addResponse<String>(Status::CODE_413, "text/plain");
+    info->addResponse<String>(Status::CODE_507, "text/plain");
+  }
+  ENDPOINT("POST", "/api/students", createStudent,
+           REQUEST(std::shared_ptr<IncomingRequest>, request)) {
+    const auto body = readStudent(request);
+    auto record = toRecord(body);
+    OATPP_ASSERT_HTTP(record.id >= 0, Status::CODE_400, "id must not be negative");
+    oatpp::Object<StudentDto> dto;
+    const auto id = m_students->create(std::move(record), [&](model::StudentRecord& r) {
+      internNames(body, r);
+      dto = toDto(r);
+    });
+    OATPP_ASSERT_HTTP(id.status != model::CreateResult::Status::Full, Status::CODE_507, "student storage full");
+    OATPP_ASSERT_HTTP(id, Status::CODE_409, "student id already exists");
+    auto response = createDtoResponse(Status::CODE_201, dto);
+    response->putHeader("Location", "/api/students/" + std::to_string(*id));
+    return response;
+  }
+
+  ENDPOINT_INFO(updateStudent) {
+    info->summary = "Student vollständig ersetzen";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+    info->addConsumes<Object<StudentDto>>("application/json");
+    info->addResponse<Object<StudentDto>>(Status::CODE_200, "application/json");
+    info->addResponse<String>(Status::CODE_404, "text/plain");
+    info->addResponse<String>(Status::CODE_413, "text/plain");
+  }
+  ENDPOINT("PUT", "/api/students/{id}", updateStudent,
+           PATH(Int32, id),
+           REQUEST(std::shared_ptr<IncomingRequest>, request)) {
+    const auto body = readStudent(request);
+    auto record = toRecord(body);
+    record.id = id;
+    oatpp::Object<StudentDto> dto;
+    const bool found = m_students->update(std::move(record), [&](model::StudentRecord& r) {
+      internNames(body, r);
+      dto = toDto(r);
+    });
+    OATPP_ASSERT_HTTP(found, Status::CODE_404, "student not found");
+    return createDtoResponse(Status::CODE_200, dto);
+  }
+
+  ENDPOINT_INFO(deleteStudent) {
+    info->summary = "Student löschen";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+    info->addResponse<String>(Status::CODE_404, "text/plain");
+  }
+  ENDPOINT("DELETE", "/api/students/{id}", deleteStudent,
+           PATH(Int32, id)) {
+    OATPP_ASSERT_HTTP(m_students->remove(id), Status::CODE_404, "student not found");
+    return createResponse(Status::CODE_204);
+  }
+
+};
+
+#include OATPP_CODEGEN_END(ApiController) //<-- End Codegen
+
+#endif /* StudentController_hpp */
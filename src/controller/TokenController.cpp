@@ -0,0 +1 @@
+#include "TokenController.hpp"
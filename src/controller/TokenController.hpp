@@ -0,0 +1,93 @@
+#ifndef TokenController_hpp
+#define TokenController_hpp
+
+#include "dto/DTOs.hpp"
+#include "auth/JwtVerifier.hpp"
+#include "auth/AuthInterceptor.hpp"
+#include "util/WorkerPool.hpp"
+
+#include "oatpp/web/server/api/ApiController.hpp"
+#include "oatpp/macro/codegen.hpp"
+#include "oatpp/macro/component.hpp"
+
+#include OATPP_CODEGEN_BEGIN(ApiController) //<-- Begin Codegen
+
+/**
+ * Token-Prüfung als Dienst (Gateway/Sidecar).
+ * Prüft N Tokens pro Request über JwtVerifier::verifyBatch, statt N Requests durch den AuthInterceptor.
+ * - verlangt selbst einen Bearer Token (SECURITY_SCHEME, per AuthInterceptor::protectEndpoints angemeldet)
+ *   → IP-Limit vor der Signaturprüfung und sub/azp-Limits greifen wie bei allen geschützten Pfaden
+ * - höchstens batchMaxTokens Tokens pro Request (Default 32, höchstens 128)
+ * - Fehler nur als feste Gründe (publicReason), keine Details aus Decoder, JWKS oder jwt-cpp
+ */
+class TokenController : public oatpp::web::server::api::ApiController {
+private:
+  std::shared_ptr<JwtVerifier> m_verifier;
+  std::shared_ptr<WorkerPool> m_workerPool;
+public:
+  /**
+   * @param apiContentMappers - mappers used to serialize/deserialize DTOs.
+   * @param verifier - verifies the batch (same instance as the AuthInterceptor's).
+   * @param workerPool - threads for parallel signature checks.
+   */
+  TokenController(const std::shared_ptr<oatpp::web::mime::ContentMappers>& apiContentMappers,
+                  std::shared_ptr<JwtVerifier> verifier,
+                  std::shared_ptr<WorkerPool> workerPool)
+    : oatpp::web::server::api::ApiController(apiContentMappers)
+    , m_verifier(std::move(verifier))
+    , m_workerPool(std::move(workerPool))
+  {}
+
+  /**
+   * Interne Fehlermeldung → einer von vier festen Gründen für Clients.
+   */
+  static const char* publicReason(const std::string& error) {
+    if (error == "token expired") return "expired";
+    if (error == "token not yet valid" || error == "token issued in the future") return "not yet valid";
+    if (error == "fetch JWKS failed" || error == "JWKS empty" || error == "curl init failed") return "unavailable";
+    return "invalid";
+  }
+public:
+
+  ENDPOINT_INFO(verifyTokens) {
+    info->summary = "Mehrere Bearer Tokens in einem Request prüfen (Ergebnisse in Eingabereihenfolge)";
+    info->addSecurityRequirement(AuthInterceptor::SECURITY_SCHEME);
+    info->addConsumes<Object<TokenVerifyRequestDto>>("application/json");
+    info->addResponse<Object<TokenVerifyResponseDto>>(Status::CODE_200, "application/json");
+  }
+  ENDPOINT("POST", "/api/tokens/verify", verifyTokens,
+           BODY_DTO(Object<TokenVerifyRequestDto>, body)) {
+    OATPP_ASSERT_HTTP(body && body->tokens, Status::CODE_400, "tokens missing");
+    OATPP_ASSERT_HTTP(body->tokens->size() <= m_verifier->config()->batchMaxTokens,
+                      Status::CODE_400, "too many tokens");
+
+    std::vector<std::string_view> tokens;
+    tokens.reserve(body->tokens->size());
+    for (const auto& t : *body->tokens) {
+      tokens.emplace_back(t ? std::string_view(*t) : std::string_view());
+    }
+
+    const auto results = m_verifier->verifyBatch(tokens, m_workerPool.get());
+
+    auto response = TokenVerifyResponseDto::createShared();
+    response->results = oatpp::List<oatpp::Object<TokenVerifyResultDto>>::createShared();
+    for (const auto& r : results) {
+      auto dto = TokenVerifyResultDto::createShared();
+      dto->valid = r.claims != nullptr;
+      if (r.claims) {
+        dto->sub = r.claims->subject;
+        dto->azp = r.claims->authorizedParty;
+        if (r.claims->expiresAt > 0) dto->exp = r.claims->expiresAt;
+      } else {
+        dto->error = publicReason(r.error);
+      }
+      response->results->push_back(dto);
+    }
+    return createDtoResponse(Status::CODE_200, response);
+  }
+
+};
+
+#include OATPP_CODEGEN_END(ApiController) //<-- End Codegen
+
+#endif /* TokenController_hpp */
@@ -19,6 +19,72 @@ class MyDto : public oatpp::DTO {
   
 };
 
+/**
+ *  Request body of POST /api/tokens/verify.
+ */
+class TokenVerifyRequestDto : public oatpp::DTO {
+
+  DTO_INIT(TokenVerifyRequestDto, DTO)
+
+  DTO_FIELD(List<String>, tokens);
+
+};
+
+/**
+ *  Result for a single token (same position as in the request).
+ */
+class TokenVerifyResultDto : public oatpp::DTO {
+
+  DTO_INIT(TokenVerifyResultDto, DTO)
+
+  DTO_FIELD(Boolean, valid);
+  DTO_FIELD(String, sub);
+  DTO_FIELD(String, azp);
+  DTO_FIELD(Int64, exp);
+  DTO_FIELD(String, error);
+
+};
+
+class TokenVerifyResponseDto : public oatpp::DTO {
+
+  DTO_INIT(TokenVerifyResponseDto, DTO)
+
+  DTO_FIELD(List<Object<TokenVerifyResultDto>>, results);
+
+};
+
+/**
+ *  Student in the REST API (GET/POST/PUT /api/students).
+ *  id is ignored on PUT (path wins) and optional on POST (assigned by the server).
+ */
+class StudentDto : public oatpp::DTO {
+
+  DTO_INIT(StudentDto, DTO)
+
+  DTO_FIELD(Int32, id);
+  DTO_FIELD(String, firstName);
+  DTO_FIELD(String, lastName);
+  DTO_FIELD(Int32, age);
+  DTO_FIELD(Float64, gpa);
+  DTO_FIELD(String, university);
+  DTO_FIELD(List<String>, courses);
+
+};
+
+/**
+ *  One page of GET /api/students?offset=&limit=.
+ */
+class StudentPageDto : public oatpp::DTO {
+
+  DTO_INIT(StudentPageDto, DTO)
+
+  DTO_FIELD(UInt64, total);
+  DTO_FIELD(UInt64, offset);
+  DTO_FIELD(UInt64, limit);
+  DTO_FIELD(List<Object<StudentDto>>, items);
+
+};
+
 #include OATPP_CODEGEN_END(DTO)
 
 #endif /* DTOs_hpp */
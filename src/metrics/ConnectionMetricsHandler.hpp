@@ -0,0 +1,56 @@
+#pragma once
+#include "Sharded.hpp"
+
+#include "oatpp/network/ConnectionHandler.hpp"
+
+#include <memory>
+
+/**
+ * ConnectionMetricsHandler
+ * - Decorator um den eigentlichen ConnectionHandler (threaded/pool/async): zählt angenommene und offene Verbindungen
+ * - offen = bis die letzte Referenz auf die Verbindung fällt (Aliasing-shared_ptr mit eigenem Deleter);
+ *   derselbe Objektzeiger wird weitergereicht, dynamic_pointer_cast auf tcp::Connection funktioniert weiter
+ * - kein Wrapper um read/write → kein Overhead pro I/O-Aufruf
+ */
+class ConnectionMetricsHandler : public oatpp::network::ConnectionHandler {
+public:
+  struct Counters {
+    metrics::ShardedCounter accepted;
+    metrics::ShardedCounter open; // Gauge: +1 bei Annahme, −1 beim Schließen
+  };
+
+private:
+  std::shared_ptr<oatpp::network::ConnectionHandler> inner_;
+  std::shared_ptr<Counters> counters_ = std::make_shared<Counters>();
+
+public:
+  explicit ConnectionMetricsHandler(std::shared_ptr<oatpp::network::ConnectionHandler> inner)
+    : inner_(std::move(inner))
+  {}
+
+  static std::shared_ptr<ConnectionMetricsHandler> createShared(std::shared_ptr<oatpp::network::ConnectionHandler> inner) {
+    return std::make_shared<ConnectionMetricsHandler>(std::move(inner));
+  }
+
+  void handleConnection(const oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>& connection,
+                        const std::shared_ptr<const ParameterMap>& params) override {
+    counters_->accepted.add();
+    counters_->open.add();
+    auto object = connection.object;
+    auto* raw = object.get();
+    std::shared_ptr<oatpp::data::stream::IOStream> tracked(raw, [object = std::move(object), counters = counters_](oatpp::data::stream::IOStream*) mutable {
+      counters->open.add(-1);
+      object.reset();
+    });
+    inner_->handleConnection(oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>(tracked, connection.invalidator), params);
+  }
+
+  void stop() override {
+    inner_->stop();
+  }
+
+  const std::shared_ptr<oatpp::network::ConnectionHandler>& inner() const noexcept { return inner_; }
+
+  std::int64_t acceptedConnections() const noexcept { return counters_->accepted.value(); }
+  std::int64_t openConnections() const noexcept { return counters_->open.value(); }
+};
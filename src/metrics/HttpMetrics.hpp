@@ -0,0 +1,202 @@
+#pragma once
+#include "Sharded.hpp"
+
+#include <oatpp/web/server/interceptor/RequestInterceptor.hpp>
+#include <oatpp/web/server/interceptor/ResponseInterceptor.hpp>
+#include <oatpp/web/server/api/ApiController.hpp>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * HttpMetrics
+ * - Requests pro Endpoint (Methode + Route-Pattern aus dem Controller) und Statuscode, Latenz-Histogramm pro Endpoint
+ * - Endpoints werden vor dem Serverstart per addEndpoints() angemeldet; danach ist die Tabelle nur noch lesend
+ *   (Lookup ohne Lock/Allokation, unbekannte Pfade landen gesammelt in "unmatched" → begrenzte Kardinalität)
+ * - Statuscodes: feste Liste häufiger Codes, alle übrigen als Klasse (z.B. "5xx")
+ */
+class HttpMetrics {
+public:
+  static constexpr std::array<int, 21> kStatusCodes = {
+    200, 201, 202, 204, 301, 302, 304, 400, 401, 403, 404, 405, 409, 413, 415, 422, 429, 500, 502, 503, 504,
+  };
+  static constexpr std::size_t kStatusSlots = kStatusCodes.size() + 5; // + 1xx … 5xx
+
+  static std::size_t statusSlot(int code) {
+    for (std::size_t i = 0; i < kStatusCodes.size(); ++i) {
+      if (kStatusCodes[i] == code) return i;
+    }
+    const int cls = std::clamp(code / 100, 1, 5);
+    return kStatusCodes.size() + (std::size_t) (cls - 1);
+  }
+
+  static std::string statusLabel(std::size_t slot) {
+    if (slot < kStatusCodes.size()) return std::to_string(kStatusCodes[slot]);
+    return std::to_string(slot - kStatusCodes.size() + 1) + "xx";
+  }
+
+  class Endpoint {
+    friend class HttpMetrics;
+    struct alignas(64) Shard {
+      std::array<std::atomic<std::uint64_t>, kStatusSlots> counts{};
+    };
+    std::array<Shard, metrics::kShards> shards_;
+  public:
+    const std::string method;
+    const std::string path; // Route-Pattern, z.B. /api/students/{id}
+    metrics::LatencyHistogram latency;
+
+    Endpoint(std::string m, std::string p) : method(std::move(m)), path(std::move(p)) {}
+
+    void record(int status, std::chrono::steady_clock::duration elapsed) noexcept {
+      shards_[metrics::shardIndex()].counts[statusSlot(status)].fetch_add(1, std::memory_order_relaxed);
+      latency.observe(elapsed);
+    }
+
+    std::array<std::uint64_t, kStatusSlots> statusCounts() const noexcept {
+      std::array<std::uint64_t, kStatusSlots> out{};
+      for (const auto& s : shards_) {
+        for (std::size_t i = 0; i < kStatusSlots; ++i) out[i] += s.counts[i].load(std::memory_order_relaxed);
+      }
+      return out;
+    }
+  };
+
+private:
+  std::deque<Endpoint> endpoints_;                                  // stabile Adressen; [0] = unmatched
+  std::unordered_map<std::string_view, std::vector<Endpoint*>> exact_; // Pfad → Endpoints (je Methode)
+  std::vector<Endpoint*> templated_;                                // Pfade mit {var} oder *
+
+  static std::string_view pathOnly(std::string_view p) {
+    const auto q = p.find('?');
+    return q == std::string_view::npos ? p : p.substr(0, q);
+  }
+
+public:
+  /**
+   * Segmentweiser Vergleich: "{name}" passt auf genau ein Segment, "*" am Ende auf den Rest.
+   */
+  static bool matchesTemplate(std::string_view pattern, std::string_view path) {
+    while (!pattern.empty() && !path.empty()) {
+      if (pattern == "/*") return true;
+      const auto pe = pattern.find('/', 1);
+      const auto se = path.find('/', 1);
+      const auto pseg = pattern.substr(0, pe);
+      const auto sseg = path.substr(0, se);
+      const bool variable = pseg.size() > 2 && pseg[1] == '{' && pseg.back() == '}';
+      if (!variable && pseg != sseg) return false;
+      if (variable && sseg.size() < 2) return false; // leeres Segment
+      pattern = pe == std::string_view::npos ? std::string_view() : pattern.substr(pe);
+      path = se == std::string_view::npos ? std::string_view() : path.substr(se);
+    }
+    return pattern.empty() && path.empty();
+  }
+
+  HttpMetrics() {
+    endpoints_.emplace_back("", "unmatched");
+  }
+
+  HttpMetrics(const HttpMetrics&) = delete;
+  HttpMetrics& operator=(const HttpMetrics&) = delete;
+
+  /**
+   * Endpoints eines Controllers anmelden (vor dem Serverstart, wie AuthInterceptor::protectEndpoints).
+   */
+  void addEndpoints(const std::shared_ptr<oatpp::web::server::api::ApiController>& controller) {
+    for (const auto& e : controller->getEndpoints().list) {
+      const auto info = e->info();
+      if (!info || !info->path || !info->method) continue;
+      auto& ep = endpoints_.emplace_back(*info->method, *info->path);
+      if (ep.path.find('{') != std::string::npos || ep.path.find('*') != std::string::npos) {
+        templated_.push_back(&ep);
+      } else {
+        exact_[ep.path].push_back(&ep);
+      }
+    }
+  }
+
+  Endpoint& resolve(std::string_view method, std::string_view rawPath) {
+    const auto path = pathOnly(rawPath);
+    auto it = exact_.find(path);
+    if (it != exact_.end()) {
+      for (auto* ep : it->second) {
+        if (ep->method == method) return *ep;
+      }
+    }
+    for (auto* ep : templated_) {
+      if (ep->method == method && matchesTemplate(ep->path, path)) return *ep;
+    }
+    return endpoints_.front();
+  }
+
+  const std::deque<Endpoint>& endpoints() const noexcept { return endpoints_; }
+};
+
+/**
+ * MetricsInterceptor
+ * - als erster Request-Interceptor: Startzeit (vor Auth), als letzter Response-Interceptor: Status + Dauer
+ * - Startzeit thread_local (synchrone Handler: ein Thread pro Request); im Async-Modus kann die Antwort auf
+ *   einem anderen Executor-Thread entstehen → dort zusätzlich im Request-Bundle
+ */
+class MetricsInterceptor
+  : public oatpp::web::server::interceptor::RequestInterceptor
+  , public oatpp::web::server::interceptor::ResponseInterceptor
+{
+  using Request = oatpp::web::protocol::http::incoming::Request;
+  using Response = oatpp::web::protocol::http::outgoing::Response;
+  using Clock = std::chrono::steady_clock;
+
+  struct Started {
+    const Request* request = nullptr;
+    Clock::time_point at;
+  };
+  static Started& started() {
+    thread_local Started s;
+    return s;
+  }
+
+  std::shared_ptr<HttpMetrics> metrics_;
+  bool crossThread_;
+
+  static std::string_view view(const oatpp::data::share::StringKeyLabel& l) {
+    return std::string_view(static_cast<const char*>(l.getData()), (std::size_t) l.getSize());
+  }
+
+public:
+  MetricsInterceptor(std::shared_ptr<HttpMetrics> metrics, bool crossThread)
+    : metrics_(std::move(metrics))
+    , crossThread_(crossThread)
+  {}
+
+  std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req) override {
+    const auto now = Clock::now();
+    started() = {req.get(), now};
+    if (crossThread_) {
+      req->putBundleData("metrics.start", oatpp::Int64((v_int64) now.time_since_epoch().count()));
+    }
+    return nullptr;
+  }
+
+  std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req,
+                                      const std::shared_ptr<Response>& res) override {
+    if (!req || !res) return res; // Parse-Fehler: kein Request-Kontext
+    const auto now = Clock::now();
+    auto& s = started();
+    Clock::time_point at = now;
+    if (s.request == req.get()) {
+      at = s.at;
+    } else if (crossThread_) {
+      const auto stored = req->getBundleData<oatpp::Int64>("metrics.start");
+      if (stored) at = Clock::time_point(Clock::duration(*stored));
+    }
+    s.request = nullptr;
+    const auto& line = req->getStartingLine();
+    metrics_->resolve(view(line.method), view(line.path)).record(res->getStatus().code, now - at);
+    return res;
+  }
+};
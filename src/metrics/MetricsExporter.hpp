@@ -0,0 +1,169 @@
+#pragma once
+#include "ConnectionMetricsHandler.hpp"
+#include "HttpMetrics.hpp"
+#include "Sharded.hpp"
+
+#include "auth/AuthInterceptor.hpp"
+#include "auth/JwtVerifier.hpp"
+#include "server/AdmissionController.hpp"
+
+#include <cstdio>
+#include <string>
+
+/**
+ * MetricsExporter
+ * - sammelt beim Scrape alle Quellen ein (HttpMetrics, JwtVerifier, JwksCache, AuthInterceptor, Verbindungen,
+ *   AdmissionController falls aktiv)
+ *   und rendert das Prometheus-Textformat 0.0.4
+ * - Hot Path schreibt nur in Sharded-Zähler; Aufwand (Summieren, Formatieren) fällt hier pro Scrape an
+ */
+class MetricsExporter {
+public:
+  static constexpr const char* CONTENT_TYPE = "text/plain; version=0.0.4; charset=utf-8";
+
+private:
+  std::shared_ptr<HttpMetrics> http_;
+  std::shared_ptr<JwtVerifier> verifier_;
+  std::shared_ptr<AuthInterceptor> auth_;
+  std::shared_ptr<ConnectionMetricsHandler> connections_;
+  std::shared_ptr<AdmissionController> admission_;
+
+  static std::string escape(const std::string& v) {
+    std::string out;
+    out.reserve(v.size());
+    for (char c : v) {
+      if (c == '\\' || c == '"') out += '\\';
+      if (c == '\n') { out += "\\n"; continue; }
+      out += c;
+    }
+    return out;
+  }
+
+  static void header(std::string& out, const char* name, const char* type, const char* help) {
+    out += "# HELP "; out += name; out += ' '; out += help; out += '\n';
+    out += "# TYPE "; out += name; out += ' '; out += type; out += '\n';
+  }
+
+  static void sample(std::string& out, const std::string& name, const std::string& labels, double value) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.17g", value);
+    out += name;
+    if (!labels.empty()) { out += '{'; out += labels; out += '}'; }
+    out += ' '; out += buf; out += '\n';
+  }
+
+  static void histogram(std::string& out, const std::string& name, const std::string& labels,
+                        const metrics::LatencyHistogram& h) {
+    const auto snap = h.snapshot();
+    const std::string sep = labels.empty() ? "" : ",";
+    std::uint64_t cumulative = 0;
+    char le[32];
+    for (std::size_t b = 0; b < metrics::LatencyHistogram::kBuckets; ++b) {
+      cumulative += snap.counts[b];
+      if (b < metrics::LatencyHistogram::kBoundsNs.size()) {
+        std::snprintf(le, sizeof(le), "%g", (double) metrics::LatencyHistogram::kBoundsNs[b] / 1e9);
+      } else {
+        std::snprintf(le, sizeof(le), "+Inf");
+      }
+      sample(out, name + "_bucket", labels + sep + "le=\"" + le + "\"", (double) cumulative);
+    }
+    sample(out, name + "_sum", labels, (double) snap.sumNs / 1e9);
+    sample(out, name + "_count", labels, (double) snap.count);
+  }
+
+  void renderHttp(std::string& out) const {
+    header(out, "http_requests_total", "counter", "HTTP requests by endpoint and status.");
+    for (const auto& ep : http_->endpoints()) {
+      const auto counts = ep.statusCounts();
+      const auto labels = "method=\"" + escape(ep.method) + "\",endpoint=\"" + escape(ep.path) + "\"";
+      for (std::size_t i = 0; i < counts.size(); ++i) {
+        if (counts[i] == 0) continue;
+        sample(out, "http_requests_total", labels + ",status=\"" + HttpMetrics::statusLabel(i) + "\"", (double) counts[i]);
+      }
+    }
+    header(out, "http_request_duration_seconds", "histogram", "HTTP request latency by endpoint (interceptors + handler).");
+    for (const auto& ep : http_->endpoints()) {
+      if (ep.latency.snapshot().count == 0) continue;
+      histogram(out, "http_request_duration_seconds",
+                "method=\"" + escape(ep.method) + "\",endpoint=\"" + escape(ep.path) + "\"", ep.latency);
+    }
+  }
+
+  void renderAuth(std::string& out) const {
+    header(out, "auth_requests_total", "counter", "Protected requests by AuthInterceptor outcome.");
+    for (std::size_t i = 0; i < AuthInterceptor::kOutcomes; ++i) {
+      const auto o = (AuthInterceptor::Outcome) i;
+      sample(out, "auth_requests_total", std::string("outcome=\"") + AuthInterceptor::outcomeName(o) + "\"",
+             (double) auth_->outcomeCount(o));
+    }
+
+    header(out, "jwt_verify_duration_seconds", "histogram", "JwtVerifier::verify duration including token cache hits.");
+    histogram(out, "jwt_verify_duration_seconds", "", verifier_->verifyLatency());
+
+    const auto cache = verifier_->tokenCacheStats();
+    header(out, "jwt_token_cache_hits_total", "counter", "Token cache hits.");
+    sample(out, "jwt_token_cache_hits_total", "", (double) cache.hits);
+    header(out, "jwt_token_cache_misses_total", "counter", "Token cache misses.");
+    sample(out, "jwt_token_cache_misses_total", "", (double) cache.misses);
+    header(out, "jwt_token_cache_entries", "gauge", "Verified tokens currently cached.");
+    sample(out, "jwt_token_cache_entries", "", (double) cache.size);
+
+    auto& jwks = verifier_->jwks();
+    const auto reloads = jwks.reloadStats();
+    header(out, "jwks_reloads_total", "counter", "Completed JWKS fetches (200 or 304).");
+    sample(out, "jwks_reloads_total", "", (double) reloads.reloads);
+    header(out, "jwks_reloads_not_modified_total", "counter", "JWKS fetches answered with 304.");
+    sample(out, "jwks_reloads_not_modified_total", "", (double) reloads.notModified);
+    header(out, "jwks_reload_failures_total", "counter", "Failed JWKS fetches or unparsable key sets.");
+    sample(out, "jwks_reload_failures_total", "", (double) reloads.failures);
+    header(out, "jwks_reload_duration_seconds", "histogram", "JWKS reload duration (fetch + parse), successful or not.");
+    histogram(out, "jwks_reload_duration_seconds", "", jwks.reloadLatency());
+    header(out, "jwks_keys", "gauge", "Keys in the current JWKS.");
+    sample(out, "jwks_keys", "", (double) jwks.keyCount());
+  }
+
+  void renderConnections(std::string& out) const {
+    header(out, "server_connections_accepted_total", "counter", "Accepted client connections.");
+    sample(out, "server_connections_accepted_total", "", (double) connections_->acceptedConnections());
+    header(out, "server_connections_open", "gauge", "Client connections currently open (in flight).");
+    sample(out, "server_connections_open", "", (double) connections_->openConnections());
+  }
+
+  void renderAdmission(std::string& out) const {
+    if (!admission_) return;
+    header(out, "admission_requests_total", "counter", "Requests admitted or shed (503) by AdmissionController.");
+    for (std::size_t i = 0; i < AdmissionController::kPriorities; ++i) {
+      const auto p = (AdmissionController::Priority) i;
+      const auto labels = std::string("priority=\"") + AdmissionController::priorityName(p) + "\"";
+      sample(out, "admission_requests_total", labels + ",outcome=\"admitted\"", (double) admission_->admittedCount(p));
+      sample(out, "admission_requests_total", labels + ",outcome=\"rejected\"", (double) admission_->rejectedCount(p));
+    }
+    header(out, "admission_limit", "gauge", "Current concurrency limit.");
+    sample(out, "admission_limit", "", (double) admission_->limit());
+    header(out, "admission_inflight", "gauge", "Admitted requests not yet answered.");
+    sample(out, "admission_inflight", "", (double) admission_->inflight());
+  }
+
+public:
+  MetricsExporter(std::shared_ptr<HttpMetrics> http,
+                  std::shared_ptr<JwtVerifier> verifier,
+                  std::shared_ptr<AuthInterceptor> auth,
+                  std::shared_ptr<ConnectionMetricsHandler> connections,
+                  std::shared_ptr<AdmissionController> admission = nullptr)
+    : http_(std::move(http))
+    , verifier_(std::move(verifier))
+    , auth_(std::move(auth))
+    , connections_(std::move(connections))
+    , admission_(std::move(admission))
+  {}
+
+  std::string render() const {
+    std::string out;
+    out.reserve(16 * 1024);
+    renderHttp(out);
+    renderAuth(out);
+    renderConnections(out);
+    renderAdmission(out);
+    return out;
+  }
+};
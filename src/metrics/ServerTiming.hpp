@@ -0,0 +1,190 @@
+#pragma once
+#include "oatpp/web/server/interceptor/RequestInterceptor.hpp"
+#include "oatpp/web/server/interceptor/ResponseInterceptor.hpp"
+#include "oatpp/data/mapping/ObjectMapper.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+/**
+ * Stage-Timing pro Request als Server-Timing-Header (Debug).
+ * - Timeline: fester Puffer (ein Slot pro Stage) thread_local, pro Request zurückgesetzt → keine Allokation
+ * - StageScope an den Messpunkten (Bearer, JWKS-Lookup, Signatur, Serialisierung) prüft nur ein thread_local-Flag,
+ *   ist also bei abgeschaltetem Timing praktisch gratis
+ * - Zeiten über steady_clock (monoton)
+ * - Annahme: ein Request läuft auf einem Thread (threaded/pool; async solange der Handler nicht yieldet),
+ *   sonst fehlt der Header für diesen Request
+ */
+namespace metrics {
+
+enum class Stage : std::uint8_t { Bearer, JwksLookup, Signature, Serialization };
+constexpr std::size_t kStages = 4;
+
+class RequestTimeline {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Data {
+    bool active = false;
+    const void* owner = nullptr;   // Request, zu dem die Timeline gehört
+    Clock::time_point start;       // Eintritt in die Interceptor-Kette
+    Clock::time_point chainEnd;    // letzter Request-Interceptor fertig → Handler beginnt
+    bool chainDone = false;        // false: ein Interceptor hat selbst geantwortet (z.B. 401)
+    std::array<std::int64_t, kStages> ns{};
+    std::array<std::uint16_t, kStages> hits{};
+  };
+
+  static Data& current() noexcept {
+    thread_local Data d;
+    return d;
+  }
+
+  static void begin(const void* owner) noexcept {
+    auto& d = current();
+    d.active = true;
+    d.owner = owner;
+    d.start = Clock::now();
+    d.chainDone = false;
+    d.ns.fill(0);
+    d.hits.fill(0);
+  }
+
+  static void end() noexcept {
+    current().active = false;
+  }
+};
+
+class StageScope {
+  RequestTimeline::Data* data_;
+  Stage stage_;
+  RequestTimeline::Clock::time_point start_;
+public:
+  explicit StageScope(Stage stage) noexcept
+    : data_(RequestTimeline::current().active ? &RequestTimeline::current() : nullptr)
+    , stage_(stage)
+  {
+    if (data_) start_ = RequestTimeline::Clock::now();
+  }
+  ~StageScope() {
+    if (!data_) return;
+    const auto i = (std::size_t) stage_;
+    data_->ns[i] += std::chrono::duration_cast<std::chrono::nanoseconds>(RequestTimeline::Clock::now() - start_).count();
+    ++data_->hits[i];
+  }
+  StageScope(const StageScope&) = delete;
+  StageScope& operator=(const StageScope&) = delete;
+};
+
+/**
+ * ObjectMapper-Decorator: misst write/read des inneren Mappers als Stage Serialization.
+ */
+class TimingObjectMapper : public oatpp::data::mapping::ObjectMapper {
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper> inner_;
+public:
+  explicit TimingObjectMapper(std::shared_ptr<oatpp::data::mapping::ObjectMapper> inner)
+    : oatpp::data::mapping::ObjectMapper(inner->getInfo())
+    , inner_(std::move(inner))
+  {}
+
+  void write(oatpp::data::stream::ConsistentOutputStream* stream, const oatpp::Void& variant,
+             oatpp::data::mapping::ErrorStack& errorStack) const override {
+    StageScope scope(Stage::Serialization);
+    inner_->write(stream, variant, errorStack);
+  }
+
+  oatpp::Void read(oatpp::utils::parser::Caret& caret, const oatpp::Type* type,
+                   oatpp::data::mapping::ErrorStack& errorStack) const override {
+    StageScope scope(Stage::Serialization);
+    return inner_->read(caret, type, errorStack);
+  }
+
+  const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& inner() const noexcept { return inner_; }
+};
+
+/**
+ * ServerTimingInterceptor
+ * - als Request-Interceptor vor AuthInterceptor: Timeline starten (always oder Header X-Server-Timing)
+ * - chainEnd() als letzter Request-Interceptor: Ende der Kette = Beginn des Handlers
+ * - als Response-Interceptor: Server-Timing-Header schreiben (intercept, bearer, jwks, sig, handler, serialize, total; ms)
+ */
+class ServerTimingInterceptor
+  : public oatpp::web::server::interceptor::RequestInterceptor
+  , public oatpp::web::server::interceptor::ResponseInterceptor
+{
+public:
+  static constexpr const char* REQUEST_HEADER = "X-Server-Timing";
+
+private:
+  using Request = oatpp::web::protocol::http::incoming::Request;
+  using Response = oatpp::web::protocol::http::outgoing::Response;
+  using Clock = RequestTimeline::Clock;
+
+  class ChainEnd : public oatpp::web::server::interceptor::RequestInterceptor {
+  public:
+    std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req) override {
+      auto& d = RequestTimeline::current();
+      if (d.active && d.owner == req.get()) {
+        d.chainEnd = Clock::now();
+        d.chainDone = true;
+      }
+      return nullptr;
+    }
+  };
+
+  bool always_;
+
+  static void append(std::string& out, const char* name, std::int64_t ns) {
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%s%s;dur=%.3f", out.empty() ? "" : ", ", name, (double) ns / 1e6);
+    out += buf;
+  }
+
+public:
+  explicit ServerTimingInterceptor(bool always) : always_(always) {}
+
+  static std::shared_ptr<oatpp::web::server::interceptor::RequestInterceptor> chainEnd() {
+    return std::make_shared<ChainEnd>();
+  }
+
+  std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req) override {
+    if (always_ || req->getHeaders().getAll_Unsafe().find(REQUEST_HEADER) != req->getHeaders().getAll_Unsafe().end()) {
+      RequestTimeline::begin(req.get());
+    } else {
+      RequestTimeline::end(); // keine Reste eines früheren Requests auf diesem Thread
+    }
+    return nullptr;
+  }
+
+  std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req,
+                                      const std::shared_ptr<Response>& res) override {
+    auto& d = RequestTimeline::current();
+    if (!d.active || !req || d.owner != req.get() || !res) return res;
+    RequestTimeline::end();
+
+    const auto now = Clock::now();
+    auto ns = [](Clock::duration x) { return (std::int64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(x).count(); };
+    static constexpr const char* names[kStages] = {"bearer", "jwks", "sig", "serialize"};
+    const auto serialize = d.ns[(std::size_t) Stage::Serialization];
+
+    std::string value;
+    value.reserve(160);
+    append(value, "intercept", ns((d.chainDone ? d.chainEnd : now) - d.start));
+    for (std::size_t i = 0; i < (std::size_t) Stage::Serialization; ++i) {
+      if (d.hits[i]) append(value, names[i], d.ns[i]);
+    }
+    // Handler-Zeit ohne die darin enthaltene Serialisierung; hat ein Interceptor geantwortet, gab es keinen Handler
+    if (d.chainDone) {
+      append(value, "handler", std::max<std::int64_t>(0, ns(now - d.chainEnd) - serialize));
+    }
+    if (d.hits[(std::size_t) Stage::Serialization]) append(value, names[(std::size_t) Stage::Serialization], serialize);
+    append(value, "total", ns(now - d.start));
+    res->putHeader("Server-Timing", value);
+    return res;
+  }
+};
+
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * Bausteine für Metriken auf dem Hot Path (lock-frei, ohne geteilte Cache-Line).
+ * - jeder Thread schreibt in "seinen" Shard (fester Index pro Thread, Round-Robin vergeben),
+ *   relaxed fetch_add auf einer eigenen Cache-Line → keine Contention zwischen Worker-Threads
+ * - Lesen (Scrape) summiert alle Shards; Werte sind nicht atomar über Shards hinweg, für Zähler genügt das
+ */
+namespace metrics {
+
+constexpr std::size_t kShards = 16;
+
+inline std::size_t shardIndex() {
+  static std::atomic<std::size_t> next{0};
+  thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed) % kShards;
+  return index;
+}
+
+/**
+ * Zähler (monoton) oder Gauge (inc/dec), je Thread-Shard ein Atomic.
+ */
+class ShardedCounter {
+  struct alignas(64) Shard {
+    std::atomic<std::int64_t> value{0};
+  };
+  std::array<Shard, kShards> shards_;
+
+public:
+  void add(std::int64_t n = 1) noexcept {
+    shards_[shardIndex()].value.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  std::int64_t value() const noexcept {
+    std::int64_t sum = 0;
+    for (const auto& s : shards_) sum += s.value.load(std::memory_order_relaxed);
+    return sum;
+  }
+};
+
+/**
+ * Latenz-Histogramm mit festen Prometheus-Buckets (50 µs … 10 s), Summe in ns.
+ */
+class LatencyHistogram {
+public:
+  static constexpr std::array<std::int64_t, 17> kBoundsNs = {
+    50'000, 100'000, 250'000, 500'000,
+    1'000'000, 2'500'000, 5'000'000, 10'000'000, 25'000'000, 50'000'000,
+    100'000'000, 250'000'000, 500'000'000,
+    1'000'000'000, 2'500'000'000, 5'000'000'000, 10'000'000'000,
+  };
+  static constexpr std::size_t kBuckets = kBoundsNs.size() + 1; // letzter = +Inf
+
+  struct Snapshot {
+    std::array<std::uint64_t, kBuckets> counts{}; // nicht kumuliert
+    std::uint64_t count = 0;
+    std::int64_t sumNs = 0;
+  };
+
+private:
+  struct alignas(64) Shard {
+    std::array<std::atomic<std::uint64_t>, kBuckets> counts{};
+    std::atomic<std::int64_t> sumNs{0};
+  };
+  std::array<Shard, kShards> shards_;
+
+public:
+  void observe(std::int64_t ns) noexcept {
+    std::size_t b = 0;
+    while (b < kBoundsNs.size() && ns > kBoundsNs[b]) ++b;
+    auto& s = shards_[shardIndex()];
+    s.counts[b].fetch_add(1, std::memory_order_relaxed);
+    s.sumNs.fetch_add(ns, std::memory_order_relaxed);
+  }
+
+  void observe(std::chrono::steady_clock::duration d) noexcept {
+    observe((std::int64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+  }
+
+  Snapshot snapshot() const noexcept {
+    Snapshot out;
+    for (const auto& s : shards_) {
+      for (std::size_t b = 0; b < kBuckets; ++b) out.counts[b] += s.counts[b].load(std::memory_order_relaxed);
+      out.sumNs += s.sumNs.load(std::memory_order_relaxed);
+    }
+    for (auto c : out.counts) out.count += c;
+    return out;
+  }
+};
+
+/**
+ * Misst die Lebensdauer des Objekts in ein Histogramm (auch bei Exceptions).
+ */
+class ScopedTimer {
+  LatencyHistogram& histogram_;
+  std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now();
+public:
+  explicit ScopedTimer(LatencyHistogram& h) noexcept : histogram_(h) {}
+  ~ScopedTimer() { histogram_.observe(std::chrono::steady_clock::now() - start_); }
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+}
@@ -0,0 +1,377 @@
+#ifndef COMPACTSTUDENT_HPP
+#define COMPACTSTUDENT_HPP
+
+#include "Student.hpp"
+#include "SymbolTable.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace model {
+
+/**
+ * CompactStudent - Student in genau einer Cache-Line (64 Byte), Speicher über std::pmr
+ *
+ * - Bytes 0-31: was Scans lesen (gpa, id, Universität, Alter, Kursanzahl) → Filtern ohne weiteren Speicherzugriff
+ * - Vor- und Nachname in EINEM Block aus dem memory_resource (hintereinander, ohne Trenner) statt zwei std::string
+ * - Kurse: sortierte SymbolIds, die ersten kInlineCourses direkt im Objekt; erst darüber ein Block aus dem Resource
+ * - allocator-aware (allocator_type + Konstruktoren mit Allocator am Ende) → std::pmr::vector<CompactStudent>
+ *   reicht seinen Resource an die Elemente weiter
+ * - Kopieren allokiert im Resource des Ziels; Verschieben bei gleichem Resource klaut nur Zeiger
+ * - Grenzen: Namen je höchstens kMaxNameLength Zeichen (sonst std::length_error), Alter wird auf 0..kMaxAge begrenzt
+ * - kein Logging, keine Smart Pointer: gedacht für Massendaten, model::Student bleibt die Lehrbeispiel-Klasse
+ */
+class alignas(64) CompactStudent {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    static constexpr std::size_t kInlineCourses = 4;
+    static constexpr std::size_t kMaxNameLength = UINT16_MAX;
+    static constexpr std::size_t kMaxCourses = UINT16_MAX;
+    static constexpr int kMaxAge = UINT16_MAX;
+
+    /**
+     * Sicht auf die Kurs-IDs (sortiert); ungültig nach addCourse/removeCourse.
+     */
+    struct Courses {
+        const SymbolId* first;
+        const SymbolId* last;
+
+        const SymbolId* begin() const { return first; }
+        const SymbolId* end() const { return last; }
+        std::size_t size() const { return (std::size_t) (last - first); }
+        bool empty() const { return first == last; }
+    };
+
+private:
+    // heiß: von Scans gelesen
+    double gpa = 0.0;
+    std::int32_t id = 0;
+    SymbolId university = kNoSymbol;
+    std::uint16_t age = 0;
+    std::uint16_t courseCount = 0;
+    std::uint16_t courseCapacity = kInlineCourses; // > kInlineCourses → heapCourses
+    std::uint16_t firstLength = 0;
+    std::uint16_t lastLength = 0;
+    // kalt: Namen, Kurse, Resource
+    char* names = nullptr;
+    union {
+        SymbolId inlineCourses[kInlineCourses];
+        SymbolId* heapCourses;
+    };
+    std::pmr::memory_resource* resource;
+
+    bool coursesInline() const { return courseCapacity == kInlineCourses; }
+    SymbolId* courseData() { return coursesInline() ? inlineCourses : heapCourses; }
+    const SymbolId* courseData() const { return coursesInline() ? inlineCourses : heapCourses; }
+
+    static std::uint16_t checkedLength(std::string_view s) {
+        if (s.size() > kMaxNameLength) throw std::length_error("CompactStudent: name too long");
+        return (std::uint16_t) s.size();
+    }
+
+    /**
+     * Neuer Block wird vor dem Freigeben des alten gefüllt → first/last dürfen auf die eigenen Namen zeigen.
+     */
+    void assignNames(std::string_view first, std::string_view last) {
+        const auto firstLen = checkedLength(first);
+        const auto lastLen = checkedLength(last);
+        char* block = nullptr;
+        if (firstLen + lastLen > 0) {
+            block = (char*) resource->allocate(firstLen + lastLen, 1);
+            std::memcpy(block, first.data(), firstLen);
+            std::memcpy(block + firstLen, last.data(), lastLen);
+        }
+        releaseNames();
+        names = block;
+        firstLength = firstLen;
+        lastLength = lastLen;
+    }
+
+    void releaseNames() {
+        if (names) resource->deallocate(names, firstLength + lastLength, 1);
+        names = nullptr;
+        firstLength = lastLength = 0;
+    }
+
+    void releaseCourses() {
+        if (!coursesInline()) {
+            resource->deallocate(heapCourses, courseCapacity * sizeof(SymbolId), alignof(SymbolId));
+            courseCapacity = kInlineCourses;
+        }
+        courseCount = 0;
+    }
+
+    /**
+     * Werte und Kurse von other übernehmen, Namen und Kursblock neu in resource anlegen.
+     */
+    void copyFrom(const CompactStudent& other) {
+        gpa = other.gpa;
+        id = other.id;
+        university = other.university;
+        age = other.age;
+        assignNames(other.getFirstName(), other.getLastName());
+        releaseCourses();
+        if (other.courseCount > kInlineCourses) {
+            heapCourses = (SymbolId*) resource->allocate(other.courseCount * sizeof(SymbolId), alignof(SymbolId));
+            courseCapacity = other.courseCount;
+        }
+        std::copy_n(other.courseData(), other.courseCount, courseData());
+        courseCount = other.courseCount;
+    }
+
+    /**
+     * Speicher von other übernehmen (gleicher Resource), other bleibt leer zurück.
+     */
+    void stealFrom(CompactStudent& other) noexcept {
+        gpa = other.gpa;
+        id = other.id;
+        university = other.university;
+        age = other.age;
+        names = std::exchange(other.names, nullptr);
+        firstLength = std::exchange(other.firstLength, 0);
+        lastLength = std::exchange(other.lastLength, 0);
+        courseCount = std::exchange(other.courseCount, 0);
+        courseCapacity = std::exchange(other.courseCapacity, (std::uint16_t) kInlineCourses);
+        std::memcpy(inlineCourses, other.inlineCourses, sizeof(inlineCourses)); // kopiert auch heapCourses
+    }
+
+public:
+    explicit CompactStudent(const allocator_type& alloc = {})
+        : resource(alloc.resource()) {}
+
+    CompactStudent(std::int32_t id, std::string_view firstName, std::string_view lastName,
+                   int age, double gpa, const allocator_type& alloc = {})
+        : gpa(gpa), id(id), resource(alloc.resource()) {
+        setAge(age);
+        assignNames(firstName, lastName);
+    }
+
+    /**
+     * Kopie im Default-Resource (wie std::pmr-Container); mit alloc im angegebenen Resource.
+     */
+    CompactStudent(const CompactStudent& other)
+        : CompactStudent(other, allocator_type{}) {}
+
+    CompactStudent(const CompactStudent& other, const allocator_type& alloc)
+        : resource(alloc.resource()) {
+        copyFrom(other);
+    }
+
+    CompactStudent(CompactStudent&& other) noexcept
+        : resource(other.resource) {
+        stealFrom(other);
+    }
+
+    CompactStudent(CompactStudent&& other, const allocator_type& alloc)
+        : resource(alloc.resource()) {
+        if (resource->is_equal(*other.resource)) stealFrom(other);
+        else copyFrom(other);
+    }
+
+    CompactStudent& operator=(const CompactStudent& other) {
+        if (this != &other) copyFrom(other);
+        return *this;
+    }
+
+    /**
+     * Resource bleibt (keine Propagation wie bei polymorphic_allocator); fremder Resource → Kopie.
+     */
+    CompactStudent& operator=(CompactStudent&& other) {
+        if (this == &other) return *this;
+        if (resource->is_equal(*other.resource)) {
+            releaseNames();
+            releaseCourses();
+            stealFrom(other);
+        } else {
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    ~CompactStudent() {
+        releaseNames();
+        releaseCourses();
+    }
+
+    allocator_type get_allocator() const { return allocator_type(resource); }
+
+    // Getter
+    std::int32_t getId() const { return id; }
+    std::string_view getFirstName() const { return {names, firstLength}; }
+    std::string_view getLastName() const { return {names + firstLength, lastLength}; }
+    int getAge() const { return age; }
+    double getGpa() const { return gpa; }
+    SymbolId getUniversityId() const { return university; }
+    Courses getCourseIds() const { return {courseData(), courseData() + courseCount}; }
+    std::size_t getCourseCount() const { return courseCount; }
+
+    /**
+     * Wie Student::getFullName() ("Vorname Nachname"); baut einen String, für Vergleiche compareFullName().
+     */
+    std::string getFullName() const {
+        std::string full;
+        full.reserve(firstLength + 1 + lastLength);
+        full.append(getFirstName()).append(1, ' ').append(getLastName());
+        return full;
+    }
+
+    int compareFullName(const CompactStudent& other) const {
+        return Student::compareFullName(getFirstName(), getLastName(), other.getFirstName(), other.getLastName());
+    }
+
+    // Setter
+    void setId(std::int32_t newId) { id = newId; }
+    void setGpa(double newGpa) { gpa = newGpa; }
+    void setAge(int newAge) { age = (std::uint16_t) std::clamp(newAge, 0, kMaxAge); }
+    void setName(std::string_view first, std::string_view last) { assignNames(first, last); }
+    void setFirstName(std::string_view first) { assignNames(first, getLastName()); }
+    void setLastName(std::string_view last) { assignNames(getFirstName(), last); }
+    void setUniversity(SymbolId universityId) { university = universityId; }
+
+    /**
+     * Universität über SymbolTable::global(); Tabelle voll → false, Universität bleibt unverändert.
+     */
+    bool setUniversity(std::string_view universityName) {
+        const auto symbol = SymbolTable::global().intern(universityName);
+        if (symbol == kNoSymbol) return false;
+        university = symbol;
+        return true;
+    }
+
+    // Kurse (sortiert, ohne Duplikate)
+    bool hasCourse(SymbolId courseId) const {
+        return std::binary_search(courseData(), courseData() + courseCount, courseId);
+    }
+
+    bool hasCourse(std::string_view courseName) const {
+        const auto symbol = SymbolTable::global().find(courseName);
+        return symbol != kNoSymbol && hasCourse(symbol);
+    }
+
+    /**
+     * @return false, wenn schon enthalten; mehr als kMaxCourses → std::length_error
+     */
+    bool addCourse(SymbolId courseId) {
+        auto* data = courseData();
+        auto* pos = std::lower_bound(data, data + courseCount, courseId);
+        if (pos != data + courseCount && *pos == courseId) return false;
+        if (courseCount == courseCapacity) {
+            if (courseCount == kMaxCourses) throw std::length_error("CompactStudent: too many courses");
+            const auto capacity = (std::uint16_t) std::min<std::size_t>(courseCapacity * 2u, kMaxCourses);
+            auto* grown = (SymbolId*) resource->allocate(capacity * sizeof(SymbolId), alignof(SymbolId));
+            const auto at = pos - data;
+            std::copy_n(data, courseCount, grown);
+            const auto count = courseCount;
+            releaseCourses();
+            heapCourses = grown;
+            courseCapacity = capacity;
+            courseCount = count;
+            data = grown;
+            pos = grown + at;
+        }
+        std::copy_backward(pos, data + courseCount, data + courseCount + 1);
+        *pos = courseId;
+        ++courseCount;
+        return true;
+    }
+
+    /**
+     * Kurs über SymbolTable::global(); Tabelle voll → false.
+     */
+    bool addCourse(std::string_view courseName) {
+        const auto symbol = SymbolTable::global().intern(courseName);
+        return symbol != kNoSymbol && addCourse(symbol);
+    }
+
+    /**
+     * @return false, wenn nicht enthalten (ein Kursblock bleibt bis zum Destruktor bestehen)
+     */
+    bool removeCourse(SymbolId courseId) {
+        auto* data = courseData();
+        auto* pos = std::lower_bound(data, data + courseCount, courseId);
+        if (pos == data + courseCount || *pos != courseId) return false;
+        std::copy(pos + 1, data + courseCount, pos);
+        --courseCount;
+        return true;
+    }
+
+    bool removeCourse(std::string_view courseName) {
+        const auto symbol = SymbolTable::global().find(courseName);
+        return symbol != kNoSymbol && removeCourse(symbol);
+    }
+};
+
+static_assert(sizeof(CompactStudent) == 64, "CompactStudent soll genau eine Cache-Line belegen");
+
+/**
+ * StudentArena - viele CompactStudents mit einem gemeinsamen Speicher (Massenimport, Snapshots)
+ *
+ * - monotonic_buffer_resource holt große Blöcke vom Upstream und gibt sie erst im Destruktor zurück
+ *   → ein Import mit 1M Datensätzen kostet einige Dutzend malloc statt mehrerer Millionen
+ * - darauf ein unsynchronized_pool_resource: Namen und Kursblöcke geänderter oder gelöschter Datensätze
+ *   landen in Größenklassen und werden wiederverwendet, statt im Arena-Block liegen zu bleiben
+ * - Datensätze dicht in einem std::pmr::vector aus demselben Pool (reserve() vor dem Import: beim Wachsen
+ *   bleiben die alten Vektorblöcke sonst bis zum Destruktor liegen)
+ * - remove() tauscht den letzten Datensatz ins Loch (O(1), Positionen ändern sich)
+ * - nicht thread-sicher: ein Importer oder eine äußere Sperre
+ */
+class StudentArena {
+private:
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::vector<CompactStudent> records;
+
+public:
+    /**
+     * @param blockBytes - Größe des ersten Arena-Blocks (weitere wachsen geometrisch)
+     * @param upstream - woher die Arena ihre Blöcke holt
+     */
+    explicit StudentArena(std::size_t blockBytes = 1u << 16,
+                          std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : arena(blockBytes, upstream)
+        , pool(&arena)
+        , records(&pool) {}
+
+    StudentArena(const StudentArena&) = delete;
+    StudentArena& operator=(const StudentArena&) = delete;
+
+    void reserve(std::size_t n) { records.reserve(n); }
+
+    CompactStudent& add(std::int32_t id, std::string_view firstName, std::string_view lastName, int age, double gpa) {
+        return records.emplace_back(id, firstName, lastName, age, gpa);
+    }
+
+    /**
+     * Kopie eines Datensatzes aus einem anderen Resource in die Arena.
+     */
+    CompactStudent& add(const CompactStudent& student) {
+        return records.emplace_back(student);
+    }
+
+    void remove(std::size_t position) {
+        if (position + 1 != records.size()) records[position] = std::move(records.back());
+        records.pop_back();
+    }
+
+    CompactStudent& operator[](std::size_t position) { return records[position]; }
+    const CompactStudent& operator[](std::size_t position) const { return records[position]; }
+
+    std::pmr::vector<CompactStudent>::const_iterator begin() const { return records.begin(); }
+    std::pmr::vector<CompactStudent>::const_iterator end() const { return records.end(); }
+    std::size_t size() const { return records.size(); }
+
+    std::pmr::memory_resource* resource() { return &pool; }
+};
+
+} // namespace model
+
+#endif // COMPACTSTUDENT_HPP
@@ -0,0 +1,102 @@
+#ifndef IDINDEX_HPP
+#define IDINDEX_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace model {
+
+/**
+ * IdIndex - id → Position im Datensatz-Array
+ * - Open Addressing mit linearem Sondieren in einem flachen Array (8 Byte pro Eintrag, keine Knoten)
+ * - Fibonacci-Hashing: fortlaufende IDs verteilen sich gleichmäßig über die Tabelle
+ * - Löschen per Backward Shift statt Tombstones → Sondierketten bleiben kurz, auch nach vielen Löschungen
+ * - Tabellengröße 2^n, wächst ab 70 % Füllgrad auf das Doppelte
+ */
+class IdIndex {
+public:
+    static constexpr std::uint32_t kNone = UINT32_MAX;
+
+private:
+    struct Entry {
+        std::int32_t id;
+        std::uint32_t slot; // kNone = frei
+    };
+
+    std::vector<Entry> table;
+    std::size_t count = 0;
+    unsigned shift = 64;
+
+    std::size_t home(std::int32_t id) const {
+        return (std::size_t) (((std::uint64_t) (std::uint32_t) id * 0x9E3779B97F4A7C15ull) >> shift);
+    }
+
+    std::size_t mask() const { return table.size() - 1; }
+
+    void rehash(std::size_t capacity) {
+        std::vector<Entry> old(capacity, Entry{0, kNone});
+        old.swap(table);
+        shift = 64;
+        for (std::size_t c = capacity; c > 1; c >>= 1) --shift;
+        for (const auto& e : old) {
+            if (e.slot == kNone) continue;
+            auto i = home(e.id);
+            while (table[i].slot != kNone) i = (i + 1) & mask();
+            table[i] = e;
+        }
+    }
+
+    std::size_t position(std::int32_t id) const {
+        if (table.empty()) return SIZE_MAX;
+        for (auto i = home(id);; i = (i + 1) & mask()) {
+            if (table[i].slot == kNone) return SIZE_MAX;
+            if (table[i].id == id) return i;
+        }
+    }
+
+public:
+    std::size_t size() const { return count; }
+
+    void reserve(std::size_t n) {
+        std::size_t capacity = 16;
+        while (capacity * 7 < n * 10) capacity <<= 1;
+        if (capacity > table.size()) rehash(capacity);
+    }
+
+    std::uint32_t find(std::int32_t id) const {
+        const auto i = position(id);
+        return i == SIZE_MAX ? kNone : table[i].slot;
+    }
+
+    /**
+     * Setzt id → slot (neu oder überschreiben).
+     */
+    void put(std::int32_t id, std::uint32_t slot) {
+        if ((count + 1) * 10 > table.size() * 7) rehash(std::max<std::size_t>(16, table.size() * 2));
+        auto i = home(id);
+        while (table[i].slot != kNone && table[i].id != id) i = (i + 1) & mask();
+        if (table[i].slot == kNone) ++count;
+        table[i] = Entry{id, slot};
+    }
+
+    bool erase(std::int32_t id) {
+        auto hole = position(id);
+        if (hole == SIZE_MAX) return false;
+        // Nachfolger der Kette rücken nach, wenn ihre Heimat nicht zwischen Loch und ihrer Position liegt
+        for (auto j = (hole + 1) & mask(); table[j].slot != kNone; j = (j + 1) & mask()) {
+            const auto distance = (j - home(table[j].id)) & mask();
+            if (distance >= ((j - hole) & mask())) {
+                table[hole] = table[j];
+                hole = j;
+            }
+        }
+        table[hole].slot = kNone;
+        --count;
+        return true;
+    }
+};
+
+} // namespace model
+
+#endif // IDINDEX_HPP
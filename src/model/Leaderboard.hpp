@@ -0,0 +1,235 @@
+#ifndef LEADERBOARD_HPP
+#define LEADERBOARD_HPP
+
+#include "IdIndex.hpp"
+#include "util/WorkerPool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace model {
+
+/**
+ * Leaderboard - Rangliste nach GPA (absteigend), dann Name (aufsteigend), dann id
+ *
+ * - gepackter 64-Bit-Schlüssel pro Student: (GPA absteigend << 32) | Namens-Ordinal
+ *   → ein Vergleich ist ein Integer-Vergleich, kein String, keine Allokation
+ * - GPA auf 1/10000 gerundet; Namens-Ordinal: Label mit Lücken in alphabetischer Reihenfolge
+ *   (neuer Name bekommt die Mitte zwischen seinen Nachbarn; ist keine Lücke mehr frei, wird nur ein dünn besetzter
+ *   Block um die Einfügestelle neu verteilt → amortisiert polylogarithmisch, auch bei sortierten Importen)
+ * - geordneter Index (std::set) über alle Mitglieder; der Vergleich liest das aktuelle Label des Namens, Neuverteilen
+ *   erhält die Reihenfolge → kein Umsortieren. top(k) läuft die ersten k Knoten ab: O(k), ohne Nachfüllen
+ * - ranking(): vollständige Rangliste, Schlüssel unter der Sperre kopiert und außerhalb parallel über den WorkerPool sortiert
+ * - Thread-sicher über einen Mutex (Updates O(log n), Abfragen O(k))
+ */
+class Leaderboard {
+public:
+    struct Entry {
+        std::uint64_t key;
+        std::int32_t id;
+
+        bool operator<(const Entry& other) const {
+            return key != other.key ? key < other.key : id < other.id;
+        }
+    };
+
+    static constexpr std::size_t kDefaultCapacity = 1024;
+
+    static std::uint32_t gpaKey(double gpa) {
+        const double scaled = gpa > 0 ? std::min(std::round(gpa * 10000.0), 4294967295.0) : 0.0;
+        return UINT32_MAX - (std::uint32_t) scaled; // höhere GPA → kleinerer Schlüssel
+    }
+
+    /**
+     * Sortiert `entries` aufsteigend; mit Pool in Teilstücken parallel, danach paarweise parallel gemergt.
+     */
+    static void parallelSort(std::vector<Entry>& entries, WorkerPool* pool) {
+        constexpr std::size_t kMinChunk = 1 << 14;
+        const std::size_t parts = pool ? std::min(pool->size() + 1, entries.size() / kMinChunk) : 1;
+        if (parts < 2) {
+            std::sort(entries.begin(), entries.end());
+            return;
+        }
+        std::vector<std::size_t> bounds(parts + 1);
+        for (std::size_t i = 0; i <= parts; ++i) bounds[i] = entries.size() * i / parts;
+        pool->parallelFor(parts, [&](std::size_t i) {
+            std::sort(entries.begin() + bounds[i], entries.begin() + bounds[i + 1]);
+        });
+
+        std::vector<Entry> buffer(entries.size());
+        auto* from = &entries;
+        auto* to = &buffer;
+        for (std::size_t width = 1; width < parts; width *= 2) {
+            pool->parallelFor((parts + 2 * width - 1) / (2 * width), [&](std::size_t p) {
+                const auto lo = bounds[p * 2 * width];
+                const auto mid = bounds[std::min(parts, p * 2 * width + width)];
+                const auto hi = bounds[std::min(parts, p * 2 * width + 2 * width)];
+                std::merge(from->begin() + lo, from->begin() + mid, from->begin() + mid, from->begin() + hi,
+                           to->begin() + lo);
+            });
+            std::swap(from, to);
+        }
+        if (from != &entries) entries.swap(buffer);
+    }
+
+private:
+    struct NameSlot {
+        std::uint32_t label;
+        std::uint32_t refs;
+    };
+    using Names = std::map<std::string, NameSlot, std::less<>>;
+
+    struct Rank {
+        std::uint32_t gpa; // gpaKey()
+        std::int32_t id;
+        Names::iterator name;
+
+        std::uint64_t key() const { return ((std::uint64_t) gpa << 32) | name->second.label; }
+    };
+
+    struct ByRank {
+        bool operator()(const Rank& a, const Rank& b) const {
+            if (a.gpa != b.gpa) return a.gpa < b.gpa;
+            if (a.name != b.name) return a.name->second.label < b.name->second.label;
+            return a.id < b.id;
+        }
+    };
+    using Ranked = std::set<Rank, ByRank>;
+
+    mutable std::mutex mutex;
+    std::size_t capacity;
+    Names names;
+    Ranked ranked;
+    std::vector<Ranked::iterator> members; // dicht, Position über IdIndex
+    IdIndex positions;
+
+    /**
+     * Neuer Name `it` hat keine freie Lücke: kleinsten ausgerichteten Label-Block um den linken Nachbarn suchen,
+     * der dünn genug besetzt ist (Schwelle fällt von fast 1 bei kleinen Blöcken auf 1/2 beim ganzen Labelraum),
+     * und nur die Namen darin gleichmäßig verteilen. Amortisiert O(log² U) Labels pro Einfügen, auch bei
+     * sortiert eingefügten Namen (Order-Maintenance wie bei Packed-Memory-Arrays).
+     */
+    void relabelAround(Names::iterator it) {
+        const std::uint64_t anchor = it == names.begin() ? 0 : std::prev(it)->second.label;
+        auto first = it;
+        auto last = std::next(it);
+        std::uint64_t count = 1;
+        for (unsigned level = 1; level <= 32; ++level) {
+            const std::uint64_t size = 1ull << level;
+            const std::uint64_t begin = anchor & ~(size - 1);
+            while (first != names.begin() && std::prev(first)->second.label >= begin) { --first; ++count; }
+            while (last != names.end() && last->second.label < begin + size) { ++last; ++count; }
+            if (count * 64 <= size * (64 - level)) {
+                std::uint64_t j = 0;
+                for (auto n = first; n != last; ++n) n->second.label = (std::uint32_t) (begin + ++j * size / (count + 1));
+                return;
+            }
+        }
+    }
+
+    /**
+     * Name eintragen bzw. Referenz zählen. Labels liegen in [1, 2^32); 0 und 2^32 sind die Ränder.
+     */
+    Names::iterator acquireName(std::string&& fullName) {
+        auto it = names.lower_bound(fullName);
+        if (it != names.end() && it->first == fullName) {
+            ++it->second.refs;
+            return it;
+        }
+        const std::uint64_t hi = it == names.end() ? (1ull << 32) : it->second.label;
+        const std::uint64_t lo = it == names.begin() ? 0 : std::prev(it)->second.label;
+        it = names.emplace_hint(it, std::move(fullName), NameSlot{(std::uint32_t) (lo + (hi - lo) / 2), 1});
+        if (hi - lo < 2) relabelAround(it);
+        return it;
+    }
+
+    void releaseName(Names::iterator it) {
+        if (--it->second.refs == 0) names.erase(it);
+    }
+
+public:
+    /**
+     * @param capacity - größtes k für top(k)
+     */
+    explicit Leaderboard(std::size_t capacity = kDefaultCapacity) : capacity(std::max<std::size_t>(1, capacity)) {}
+
+    /**
+     * Student eintragen oder aktualisieren. fullName wie Student::getFullName() ("Vorname Nachname").
+     */
+    void upsert(std::int32_t id, double gpa, std::string fullName) {
+        std::lock_guard lock(mutex);
+        const auto name = acquireName(std::move(fullName)); // vor dem Freigeben des alten: gleicher Name bleibt erhalten
+        const Rank rank{gpaKey(gpa), id, name};
+        const auto pos = positions.find(id);
+        if (pos == IdIndex::kNone) {
+            positions.put(id, (std::uint32_t) members.size());
+            members.push_back(ranked.insert(rank).first);
+        } else {
+            const auto old = members[pos]->name;
+            ranked.erase(members[pos]);
+            releaseName(old);
+            members[pos] = ranked.insert(rank).first;
+        }
+    }
+
+    bool remove(std::int32_t id) {
+        std::lock_guard lock(mutex);
+        const auto pos = positions.find(id);
+        if (pos == IdIndex::kNone) return false;
+        const auto name = members[pos]->name;
+        ranked.erase(members[pos]);
+        releaseName(name);
+        positions.erase(id);
+        if (pos + 1 != members.size()) {
+            members[pos] = members.back();
+            positions.put(members[pos]->id, pos);
+        }
+        members.pop_back();
+        return true;
+    }
+
+    /**
+     * IDs der besten k Studenten (k > capacity wird auf capacity gekürzt).
+     */
+    std::vector<std::int32_t> top(std::size_t k) const {
+        std::lock_guard lock(mutex);
+        k = std::min({k, capacity, ranked.size()});
+        std::vector<std::int32_t> ids;
+        ids.reserve(k);
+        for (auto it = ranked.begin(); ids.size() < k; ++it) ids.push_back(it->id);
+        return ids;
+    }
+
+    /**
+     * Vollständige Rangliste (IDs); sortiert außerhalb der Sperre, parallel wenn pool gesetzt ist.
+     */
+    std::vector<std::int32_t> ranking(WorkerPool* pool = nullptr) const {
+        std::vector<Entry> all;
+        {
+            std::lock_guard lock(mutex);
+            all.reserve(members.size());
+            for (const auto& m : members) all.push_back({m->key(), m->id});
+        }
+        parallelSort(all, pool);
+        std::vector<std::int32_t> ids;
+        ids.reserve(all.size());
+        for (const auto& e : all) ids.push_back(e.id);
+        return ids;
+    }
+
+    std::size_t size() const {
+        std::lock_guard lock(mutex);
+        return members.size();
+    }
+};
+
+} // namespace model
+
+#endif // LEADERBOARD_HPP
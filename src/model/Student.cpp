@@ -7,8 +7,7 @@ namespace model {
 // Default Konstruktor
 Student::Student() 
     : id(0), firstName(""), lastName(""), age(0), gpa(0.0),
-      courses(std::make_unique<std::vector<std::string>>()),
-      universityName(nullptr) {
+      courses(), university(kNoSymbol) {
     std::cout << "Student Default Konstruktor aufgerufen für ID: " << id << std::endl;
 }
 
@@ -16,8 +15,7 @@ Student::Student()
 Student::Student(int id, const std::string& firstName, const std::string& lastName, 
                 int age, double gpa)
     : id(id), firstName(firstName), lastName(lastName), age(age), gpa(gpa),
-      courses(std::make_unique<std::vector<std::string>>()),
-      universityName(nullptr) {
+      courses(), university(kNoSymbol) {
     std::cout << "Student Parameter Konstruktor aufgerufen für: " << getFullName() << std::endl;
 }
 
@@ -25,8 +23,8 @@ Student::Student(int id, const std::string& firstName, const std::string& lastNa
 Student::Student(const Student& other)
     : id(other.id), firstName(other.firstName), lastName(other.lastName),
       age(other.age), gpa(other.gpa),
-      courses(std::make_unique<std::vector<std::string>>(*other.courses)),
-      universityName(other.universityName) { // Shared pointer wird geteilt
+      courses(other.courses), // nur IDs kopieren
+      university(other.university) {
     std::cout << "Student Copy Konstruktor aufgerufen für: " << getFullName() << std::endl;
 }
 
@@ -35,10 +33,12 @@ Student::Student(Student&& other) noexcept
     : id(other.id), firstName(std::move(other.firstName)), lastName(std::move(other.lastName)),
       age(other.age), gpa(other.gpa),
       courses(std::move(other.courses)),
-      universityName(std::move(other.universityName)) {
+      university(other.university) {
     
     // Other objekt in validen aber undefinierten Zustand versetzen
     other.id = 0;
+    other.courses.clear();
+    other.university = kNoSymbol;
     other.age = 0;
     other.gpa = 0.0;
     
@@ -60,11 +60,9 @@ Student& Student::operator=(const Student& other) {
         age = other.age;
         gpa = other.gpa;
         
-        // Deep copy für courses
-        courses = std::make_unique<std::vector<std::string>>(*other.courses);
-        
-        // Shared pointer wird geteilt
-        universityName = other.universityName;
+        // Kurse und Universität sind IDs → einfache Kopie
+        courses = other.courses;
+        university = other.university;
         
         std::cout << "Student Copy Assignment für: " << getFullName() << std::endl;
     }
@@ -81,10 +79,12 @@ Student& Student::operator=(Student&& other) noexcept {
         gpa = other.gpa;
         
         courses = std::move(other.courses);
-        universityName = std::move(other.universityName);
+        university = other.university;
         
         // Other objekt zurücksetzen
         other.id = 0;
+        other.courses.clear();
+        other.university = kNoSymbol;
         other.age = 0;
         other.gpa = 0.0;
         
@@ -94,54 +94,57 @@ Student& Student::operator=(Student&& other) noexcept {
 }
 
 // Course Management Methoden
-void Student::addCourse(const std::string& courseName) {
-    if (courses) {
-        // Prüfen ob Kurs bereits existiert
-        auto it = std::find(courses->begin(), courses->end(), courseName);
-        if (it == courses->end()) {
-            courses->push_back(courseName);
-            std::cout << "Kurs '" << courseName << "' hinzugefügt für " << getFullName() << std::endl;
-        } else {
-            std::cout << "Kurs '" << courseName << "' bereits vorhanden für " << getFullName() << std::endl;
-        }
+void Student::addCourse(std::string_view courseName) {
+    const auto courseId = SymbolTable::global().intern(courseName);
+    if (courseId == kNoSymbol) {
+        std::cout << "Kurs '" << courseName << "' nicht angelegt (Symboltabelle voll) für " << getFullName() << std::endl;
+    } else if (courses.add(courseId)) {
+        std::cout << "Kurs '" << courseName << "' hinzugefügt für " << getFullName() << std::endl;
+    } else {
+        std::cout << "Kurs '" << courseName << "' bereits vorhanden für " << getFullName() << std::endl;
     }
 }
 
-void Student::removeCourse(const std::string& courseName) {
-    if (courses) {
-        auto it = std::find(courses->begin(), courses->end(), courseName);
-        if (it != courses->end()) {
-            courses->erase(it);
-            std::cout << "Kurs '" << courseName << "' entfernt für " << getFullName() << std::endl;
-        } else {
-            std::cout << "Kurs '" << courseName << "' nicht gefunden für " << getFullName() << std::endl;
-        }
+void Student::removeCourse(std::string_view courseName) {
+    // find() statt intern(): unbekannte Namen landen nicht in der Tabelle
+    const auto courseId = SymbolTable::global().find(courseName);
+    if (courseId != kNoSymbol && courses.remove(courseId)) {
+        std::cout << "Kurs '" << courseName << "' entfernt für " << getFullName() << std::endl;
+    } else {
+        std::cout << "Kurs '" << courseName << "' nicht gefunden für " << getFullName() << std::endl;
     }
 }
 
+bool Student::hasCourse(std::string_view courseName) const {
+    const auto courseId = SymbolTable::global().find(courseName);
+    return courseId != kNoSymbol && courses.contains(courseId);
+}
+
 std::vector<std::string> Student::getCourses() const {
-    if (courses) {
-        return *courses; // Copy der Kurse zurückgeben
+    std::vector<std::string> names;
+    names.reserve(courses.size());
+    for (auto courseId : courses) {
+        names.push_back(SymbolTable::global().name(courseId));
     }
-    return std::vector<std::string>(); // Leeren Vector zurückgeben
+    return names;
 }
 
 size_t Student::getCourseCount() const {
-    return courses ? courses->size() : 0;
+    return courses.size();
 }
 
 // University Management
-void Student::setUniversity(std::shared_ptr<std::string> university) {
-    universityName = university;
+void Student::setUniversity(std::string_view universityName) {
+    university = universityName.empty() ? kNoSymbol : SymbolTable::global().intern(universityName);
     std::cout << "Universität gesetzt für " << getFullName();
-    if (university) {
-        std::cout << ": " << *university;
+    if (university != kNoSymbol) {
+        std::cout << ": " << universityName;
     }
     std::cout << std::endl;
 }
 
 std::string Student::getUniversity() const {
-    return universityName ? *universityName : "Keine Universität";
+    return university != kNoSymbol ? SymbolTable::global().name(university) : "Keine Universität";
 }
 
 // Utility Methoden
@@ -158,9 +161,9 @@ void Student::printStudentInfo() const {
     std::cout << "Universität: " << getUniversity() << std::endl;
     std::cout << "Kurse (" << getCourseCount() << "):" << std::endl;
     
-    if (courses && !courses->empty()) {
-        for (const auto& course : *courses) {
-            std::cout << "  - " << course << std::endl;
+    if (!courses.empty()) {
+        for (auto courseId : courses) {
+            std::cout << "  - " << SymbolTable::global().name(courseId) << std::endl;
         }
     } else {
         std::cout << "  Keine Kurse eingetragen" << std::endl;
@@ -178,7 +181,28 @@ bool Student::operator<(const Student& other) const {
     if (gpa != other.gpa) {
         return gpa > other.gpa; // Höhere GPA zuerst
     }
-    return getFullName() < other.getFullName();
+    return compareFullName(other) < 0;
+}
+
+int Student::compareFullName(const Student& other) const {
+    return compareFullName(firstName, lastName, other.firstName, other.lastName);
+}
+
+int Student::compareFullName(std::string_view firstA, std::string_view lastA,
+                             std::string_view firstB, std::string_view lastB) {
+    // wie (firstA + " " + lastA).compare(firstB + " " + lastB), aber ohne die Strings zusammenzubauen
+    const std::string_view a[] = {firstA, " ", lastA};
+    const std::string_view b[] = {firstB, " ", lastB};
+    std::size_t i = 0, j = 0, pi = 0, pj = 0;
+    for (;;) {
+        while (i < 3 && pi == a[i].size()) { ++i; pi = 0; }
+        while (j < 3 && pj == b[j].size()) { ++j; pj = 0; }
+        if (i == 3 || j == 3) return (i == 3 ? 0 : 1) - (j == 3 ? 0 : 1);
+        const auto n = std::min(a[i].size() - pi, b[j].size() - pj);
+        if (const int c = a[i].compare(pi, n, b[j].substr(pj, n)); c != 0) return c;
+        pi += n;
+        pj += n;
+    }
 }
 
 // Stream Output Operator
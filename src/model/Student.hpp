@@ -1,7 +1,10 @@
 #ifndef STUDENT_HPP
 #define STUDENT_HPP
 
+#include "SymbolTable.hpp"
+
 #include <string>
+#include <string_view>
 #include <memory>
 #include <vector>
 #include <iostream>
@@ -16,7 +19,7 @@ namespace model {
  * - Destruktor
  * - Getter/Setter
  * - Rule of Five
- * - Smart Pointers
+ * - Interning: Kurse und Universität sind IDs aus SymbolTable::global() statt eigener Strings
  */
 class Student {
 private:
@@ -27,9 +30,9 @@ private:
     int age;
     double gpa; // Grade Point Average
     
-    // Zeiger auf Zusatzdaten (demonstriert Pointer Management)
-    std::unique_ptr<std::vector<std::string>> courses;
-    std::shared_ptr<std::string> universityName;
+    // Zusatzdaten als interne IDs: Kursmenge sortiert (Mitgliedschaft per binärer Suche) plus Einfügereihenfolge, Universität geteilt
+    SymbolSet courses;
+    SymbolId university;
 
 public:
     // Konstruktoren
@@ -84,14 +87,18 @@ public:
     void setAge(int newAge) { age = newAge; }
     void setGpa(double newGpa) { gpa = newGpa; }
     
-    // Methoden für Course Management (Smart Pointer Demonstration)
-    void addCourse(const std::string& courseName);
-    void removeCourse(const std::string& courseName);
+    // Course Management (Namen werden interniert, Vergleiche nur über IDs)
+    void addCourse(std::string_view courseName);
+    void removeCourse(std::string_view courseName);
+    bool hasCourse(std::string_view courseName) const;
+    bool hasCourse(SymbolId courseId) const { return courses.contains(courseId); }
+    const SymbolSet& getCourseIds() const { return courses; }
     std::vector<std::string> getCourses() const;
     size_t getCourseCount() const;
     
-    // University Management (Shared Pointer Demonstration)
-    void setUniversity(std::shared_ptr<std::string> university);
+    // University Management (alle Studenten einer Universität teilen dieselbe ID)
+    void setUniversity(std::string_view universityName);
+    SymbolId getUniversityId() const { return university; }
     std::string getUniversity() const;
     
     // Utility-Methoden
@@ -100,7 +107,14 @@ public:
     
     // Operator Overloading für Vergleiche
     bool operator==(const Student& other) const;
-    bool operator<(const Student& other) const; // Für Sortierung
+    bool operator<(const Student& other) const; // Für Sortierung (ohne Allokation)
+    
+    /**
+     * Vergleicht die vollen Namen wie getFullName().compare(), ohne Strings zu bauen (<0, 0, >0).
+     */
+    int compareFullName(const Student& other) const;
+    static int compareFullName(std::string_view firstA, std::string_view lastA,
+                               std::string_view firstB, std::string_view lastB);
     
     // Friend-Funktion für Stream-Output
     friend std::ostream& operator<<(std::ostream& os, const Student& student);
@@ -0,0 +1,208 @@
+#ifndef STUDENTREPOSITORY_HPP
+#define STUDENTREPOSITORY_HPP
+
+#include "IdIndex.hpp"
+#include "Leaderboard.hpp"
+#include "SymbolTable.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace model {
+
+/**
+ * Datensatz im StudentRepository
+ * - flacher Wert (keine unique_ptr/shared_ptr): kopierbar, verschiebbar, ohne Logging
+ * - Universität und Kurse als IDs aus SymbolTable::global() → keine doppelten Strings über Millionen Datensätze
+ * - id 0 beim Anlegen = Repository vergibt die nächste freie ID
+ */
+struct StudentRecord {
+    std::int32_t id = 0;
+    std::int32_t age = 0;
+    double gpa = 0.0;
+    std::string firstName;
+    std::string lastName;
+    SymbolId university = kNoSymbol;
+    SymbolSet courses;
+};
+
+/**
+ * Ergebnis von StudentRepository::create
+ * - Created: id ist die gespeicherte ID; IdTaken: ID schon vergeben
+ * - Full: maxRecords erreicht oder keine automatische ID mehr frei (Speicherdeckel, kein Konflikt)
+ * - bool/operator* wie bei optional<int32_t>
+ */
+struct CreateResult {
+    enum class Status { Created, IdTaken, Full };
+
+    Status status = Status::Created;
+    std::int32_t id = 0;
+
+    explicit operator bool() const { return status == Status::Created; }
+    std::int32_t operator*() const { return id; }
+};
+
+/**
+ * StudentRepository - In-Memory-Datenhaltung für den Student-Service
+ *
+ * - Datensätze liegen dicht in einem std::vector (ein Block, gute Lokalität beim Durchlaufen)
+ * - Lookup per id in O(1) über IdIndex; Löschen tauscht den letzten Datensatz ins Loch (O(1), bleibt dicht)
+ * - Thread-sicher per std::shared_mutex: beliebig viele Leser parallel, Schreiber exklusiv
+ * - read()/page() reichen Datensätze unter der Lesesperre an einen Callback → keine Kopie pro Zugriff;
+ *   der Callback darf das Repository nicht erneut sperren
+ * - Reihenfolge von page() ist die Speicherreihenfolge (Einfügereihenfolge, bis gelöscht wird)
+ * - optionales Leaderboard wird unter der Schreibsperre mitgeführt → gleiche Reihenfolge der Änderungen
+ * - create()/update() rufen optional prepare(StudentRecord&) unter der Schreibsperre, erst wenn der Schreibzugriff
+ *   gelingt (ID frei bzw. vorhanden, Platz da) → z.B. Namen erst dann internieren; wirft prepare, bleibt alles unverändert
+ * - höchstens maxRecords Datensätze; automatische IDs zählen nur nextId hoch und überspringen vom Client
+ *   gewählte IDs → eine Client-ID nahe INT32_MAX verbraucht den ID-Raum nicht
+ */
+class StudentRepository {
+public:
+    static constexpr std::size_t kDefaultMaxRecords = std::size_t(1) << 22;
+private:
+    mutable std::shared_mutex mutex;
+    std::vector<StudentRecord> records;
+    IdIndex index;
+    std::size_t maxRecords;
+    std::int32_t nextId = 1;
+    std::shared_ptr<Leaderboard> leaderboard;
+
+    void rank(const StudentRecord& record) {
+        if (leaderboard) leaderboard->upsert(record.id, record.gpa, record.firstName + " " + record.lastName);
+    }
+
+public:
+    /**
+     * @param maxRecords - Obergrenze der Datensätze (Speicherdeckel), höchstens IdIndex::kNone - 1
+     */
+    explicit StudentRepository(std::size_t maxRecords = kDefaultMaxRecords)
+        : maxRecords(std::min<std::size_t>(maxRecords, IdIndex::kNone - 1))
+    {}
+
+    /**
+     * Leaderboard anhängen; übernimmt alle vorhandenen Datensätze.
+     */
+    void setLeaderboard(std::shared_ptr<Leaderboard> board) {
+        std::unique_lock lock(mutex);
+        leaderboard = std::move(board);
+        for (const auto& r : records) rank(r);
+    }
+
+    void reserve(std::size_t n) {
+        std::unique_lock lock(mutex);
+        records.reserve(n);
+        index.reserve(n);
+    }
+
+    /**
+     * Legt einen Datensatz an. id <= 0 → nächste freie ID (überspringt vom Client belegte IDs).
+     * @param prepare - void(StudentRecord&), vor dem Einfügen mit vergebener ID; darf werfen
+     * @return Created mit ID, IdTaken bei vergebener ID, Full bei maxRecords oder erschöpften IDs
+     */
+    template<typename F>
+    CreateResult create(StudentRecord record, F&& prepare) {
+        std::unique_lock lock(mutex);
+        if (records.size() >= maxRecords) return {CreateResult::Status::Full};
+        if (record.id <= 0) {
+            // jede belegte ID wird höchstens einmal übersprungen, nextId läuft nur vorwärts
+            while (nextId != INT32_MAX && index.find(nextId) != IdIndex::kNone) ++nextId;
+            if (nextId == INT32_MAX) return {CreateResult::Status::Full};
+            record.id = nextId;
+        } else if (index.find(record.id) != IdIndex::kNone) {
+            return {CreateResult::Status::IdTaken};
+        }
+        prepare(record);
+        if (record.id == nextId) ++nextId;
+        index.put(record.id, (std::uint32_t) records.size());
+        records.push_back(std::move(record));
+        rank(records.back());
+        return {CreateResult::Status::Created, records.back().id};
+    }
+
+    CreateResult create(StudentRecord record) {
+        return create(std::move(record), [](StudentRecord&) {});
+    }
+
+    std::optional<StudentRecord> find(std::int32_t id) const {
+        std::shared_lock lock(mutex);
+        const auto slot = index.find(id);
+        if (slot == IdIndex::kNone) return std::nullopt;
+        return records[slot];
+    }
+
+    /**
+     * Ruft f(const StudentRecord&) unter der Lesesperre auf.
+     * @return false, wenn die ID nicht existiert
+     */
+    template<typename F>
+    bool read(std::int32_t id, F&& f) const {
+        std::shared_lock lock(mutex);
+        const auto slot = index.find(id);
+        if (slot == IdIndex::kNone) return false;
+        f(records[slot]);
+        return true;
+    }
+
+    /**
+     * Ersetzt den Datensatz mit record.id vollständig.
+     * @param prepare - void(StudentRecord&), vor dem Ersetzen; darf werfen
+     * @return false, wenn die ID nicht existiert
+     */
+    template<typename F>
+    bool update(StudentRecord record, F&& prepare) {
+        std::unique_lock lock(mutex);
+        const auto slot = index.find(record.id);
+        if (slot == IdIndex::kNone) return false;
+        prepare(record);
+        records[slot] = std::move(record);
+        rank(records[slot]);
+        return true;
+    }
+
+    bool update(StudentRecord record) {
+        return update(std::move(record), [](StudentRecord&) {});
+    }
+
+    bool remove(std::int32_t id) {
+        std::unique_lock lock(mutex);
+        const auto slot = index.find(id);
+        if (slot == IdIndex::kNone) return false;
+        index.erase(id);
+        if (leaderboard) leaderboard->remove(id);
+        if (slot + 1 != records.size()) {
+            records[slot] = std::move(records.back());
+            index.put(records[slot].id, slot);
+        }
+        records.pop_back();
+        return true;
+    }
+
+    /**
+     * Ruft f(const StudentRecord&) für höchstens `limit` Datensätze ab `offset` auf.
+     * @return Gesamtzahl der Datensätze (für die Pagination)
+     */
+    template<typename F>
+    std::size_t page(std::size_t offset, std::size_t limit, F&& f) const {
+        std::shared_lock lock(mutex);
+        const auto end = offset + std::min(limit, records.size() - std::min(offset, records.size()));
+        for (auto i = offset; i < end; ++i) f(records[i]);
+        return records.size();
+    }
+
+    std::size_t size() const {
+        std::shared_lock lock(mutex);
+        return records.size();
+    }
+};
+
+} // namespace model
+
+#endif // STUDENTREPOSITORY_HPP
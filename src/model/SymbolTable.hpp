@@ -0,0 +1,194 @@
+#ifndef SYMBOLTABLE_HPP
+#define SYMBOLTABLE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace model {
+
+using SymbolId = std::uint32_t;
+constexpr SymbolId kNoSymbol = UINT32_MAX;
+
+/**
+ * SymbolTable - String-Interning für wiederkehrende Namen (Kurse, Universitäten)
+ *
+ * - jeder Name liegt genau einmal im Speicher, Datensätze halten nur eine 4-Byte-ID
+ * - IDs sind dicht (0, 1, 2, ...) und bleiben für die Lebensdauer der Tabelle gültig; nichts wird entfernt
+ * - Namen liegen in einer std::deque → Referenzen aus name() bleiben beim Wachsen gültig,
+ *   der Index (string_view → ID) zeigt direkt auf diese Strings
+ * - Thread-sicher: find()/name() unter Lesesperre; intern() prüft erst lesend, schreibt nur für neue Namen
+ * - maxSymbols und maxBytes (Summe der Namenslängen) deckeln den Speicher gegen beliebig viele bzw. beliebig
+ *   lange Namen aus Requests (voll → kNoSymbol)
+ */
+class SymbolTable {
+private:
+    mutable std::shared_mutex mutex;
+    std::deque<std::string> names;
+    std::unordered_map<std::string_view, SymbolId> ids;
+    std::size_t maxSymbols;
+    std::size_t maxBytes;
+    std::size_t bytes = 0;
+
+public:
+    explicit SymbolTable(std::size_t maxSymbols = 1u << 20, std::size_t maxBytes = 64u << 20)
+        : maxSymbols(maxSymbols)
+        , maxBytes(maxBytes)
+    {}
+
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    /**
+     * Prozessweite Tabelle für Kurs- und Universitätsnamen.
+     */
+    static SymbolTable& global() {
+        static SymbolTable table;
+        return table;
+    }
+
+    /**
+     * ID des Namens, ohne ihn anzulegen; unbekannt → kNoSymbol.
+     */
+    SymbolId find(std::string_view name) const {
+        std::shared_lock lock(mutex);
+        auto it = ids.find(name);
+        return it == ids.end() ? kNoSymbol : it->second;
+    }
+
+    /**
+     * ID des Namens, legt ihn bei Bedarf an; Tabelle voll → kNoSymbol.
+     */
+    SymbolId intern(std::string_view name) {
+        if (const auto id = find(name); id != kNoSymbol) return id;
+        std::unique_lock lock(mutex);
+        if (auto it = ids.find(name); it != ids.end()) return it->second; // inzwischen angelegt
+        if (names.size() >= maxSymbols || name.size() > maxBytes - bytes) return kNoSymbol;
+        const auto id = (SymbolId) names.size();
+        bytes += name.size();
+        names.emplace_back(name);
+        ids.emplace(names.back(), id);
+        return id;
+    }
+
+    /**
+     * Alle Namen auf einmal internieren: entweder alle (IDs in out, gleiche Reihenfolge) oder keiner.
+     * Reicht der Platz nicht für alle neuen Namen, bleibt die Tabelle unverändert → false.
+     */
+    bool internAll(const std::vector<std::string_view>& batch, std::vector<SymbolId>& out) {
+        out.clear();
+        out.reserve(batch.size());
+        {
+            std::shared_lock lock(mutex);
+            for (auto name : batch) {
+                auto it = ids.find(name);
+                if (it == ids.end()) break;
+                out.push_back(it->second);
+            }
+            if (out.size() == batch.size()) return true; // alle schon bekannt
+        }
+        out.clear();
+        std::unique_lock lock(mutex);
+        std::vector<std::string_view> fresh;
+        std::size_t freshBytes = 0;
+        for (auto name : batch) {
+            if (ids.count(name) || std::find(fresh.begin(), fresh.end(), name) != fresh.end()) continue;
+            fresh.push_back(name);
+            freshBytes += name.size();
+        }
+        if (fresh.size() > maxSymbols - names.size() || freshBytes > maxBytes - bytes) return false;
+        for (auto name : batch) {
+            auto it = ids.find(name);
+            if (it == ids.end()) {
+                const auto id = (SymbolId) names.size();
+                bytes += name.size();
+                names.emplace_back(name);
+                it = ids.emplace(names.back(), id).first;
+            }
+            out.push_back(it->second);
+        }
+        return true;
+    }
+
+    /**
+     * Name zur ID (Referenz bleibt gültig); unbekannte ID → leerer String.
+     */
+    const std::string& name(SymbolId id) const {
+        static const std::string empty;
+        std::shared_lock lock(mutex);
+        return id < names.size() ? names[id] : empty;
+    }
+
+    std::size_t size() const {
+        std::shared_lock lock(mutex);
+        return names.size();
+    }
+};
+
+/**
+ * SymbolSet - Menge interner IDs: sortiertes Array für die Mitgliedschaft, zweites Array für die Reihenfolge
+ * - contains() per binärer Suche, add() verschiebt nur ein paar 4-Byte-Werte
+ * - Iteration in Einfügereihenfolge → getCourses()/DTOs geben Kurse so zurück, wie sie angelegt wurden
+ * - remove() sucht im Reihenfolge-Array linear (selten, die übrigen behalten ihre Reihenfolge)
+ * - keine String-Vergleiche, keine String-Allokationen; == vergleicht als Menge (sortierte Arrays)
+ */
+class SymbolSet {
+private:
+    std::vector<SymbolId> sorted;
+    std::vector<SymbolId> ordered;
+
+public:
+    bool contains(SymbolId id) const {
+        return std::binary_search(sorted.begin(), sorted.end(), id);
+    }
+
+    /**
+     * @return false, wenn schon enthalten
+     */
+    bool add(SymbolId id) {
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), id);
+        if (it != sorted.end() && *it == id) return false;
+        sorted.insert(it, id);
+        ordered.push_back(id);
+        return true;
+    }
+
+    /**
+     * @return false, wenn nicht enthalten
+     */
+    bool remove(SymbolId id) {
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), id);
+        if (it == sorted.end() || *it != id) return false;
+        sorted.erase(it);
+        ordered.erase(std::find(ordered.begin(), ordered.end(), id));
+        return true;
+    }
+
+    std::size_t size() const { return sorted.size(); }
+    bool empty() const { return sorted.empty(); }
+
+    void clear() {
+        sorted.clear();
+        ordered.clear();
+    }
+
+    void reserve(std::size_t n) {
+        sorted.reserve(n);
+        ordered.reserve(n);
+    }
+
+    std::vector<SymbolId>::const_iterator begin() const { return ordered.begin(); }
+    std::vector<SymbolId>::const_iterator end() const { return ordered.end(); }
+
+    bool operator==(const SymbolSet& other) const { return sorted == other.sorted; }
+};
+
+} // namespace model
+
+#endif // SYMBOLTABLE_HPP
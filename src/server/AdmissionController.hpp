@@ -0,0 +1,271 @@
+#pragma once
+#include "auth/RouteMatcher.hpp"
+#include "metrics/Sharded.hpp"
+
+#include "oatpp/web/server/interceptor/RequestInterceptor.hpp"
+#include "oatpp/web/server/interceptor/ResponseInterceptor.hpp"
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * AdaptiveLimit
+ * - Concurrency-Limit, das sich an der beobachteten Latenz ausrichtet (Gradient wie bei Netflix concurrency-limits)
+ * - pro Fenster (Default 100 ms): Ø-Latenz des Fensters gegen den langsamen Mittelwert (EMA) vergleichen;
+ *   steigt sie über tolerance × EMA (Requests stauen sich), schrumpft das Limit, sonst wächst es um √limit
+ * - optional targetNs: Ø-Latenz über dem Ziel drückt das Limit zusätzlich
+ * - wächst nur, wenn das Limit im Fenster annähernd ausgeschöpft war (sonst Wachstum ohne Belege)
+ * - Hot Path: observe() schreibt in Sharded-Zähler; das Fenster schließt der erste Thread danach (try_lock)
+ */
+class AdaptiveLimit {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Options {
+    std::size_t initial = 256;
+    std::size_t min = 16;
+    std::size_t max = 1024;
+    std::chrono::milliseconds window{100};
+    double tolerance = 1.5;
+    std::int64_t targetNs = 0;   // 0 = nur Gradient
+    std::int64_t minSamples = 16; // Fenster mit weniger Samples ändern nichts
+  };
+
+private:
+  Options options_;
+  std::atomic<std::size_t> limit_;
+  std::atomic<std::size_t> peak_{0};
+  std::atomic<Clock::rep> windowEnd_;
+  metrics::ShardedCounter sumNs_;
+  metrics::ShardedCounter count_;
+
+  std::mutex update_;       // nur der schließende Thread
+  std::int64_t lastSum_ = 0;
+  std::int64_t lastCount_ = 0;
+  double longAvg_ = 0;
+  double smoothed_;
+
+  void closeWindow(Clock::time_point now) {
+    std::unique_lock<std::mutex> lock(update_, std::try_to_lock);
+    if (!lock.owns_lock()) return;
+    if (now.time_since_epoch().count() < windowEnd_.load(std::memory_order_relaxed)) return;
+    windowEnd_.store((now + options_.window).time_since_epoch().count(), std::memory_order_relaxed);
+
+    const auto sum = sumNs_.value();
+    const auto count = count_.value();
+    const auto samples = count - lastCount_;
+    if (samples < options_.minSamples) return; // Summen laufen weiter, nächstes Fenster wird größer
+    const double avg = (double) (sum - lastSum_) / (double) samples;
+    lastSum_ = sum;
+    lastCount_ = count;
+    const auto peak = peak_.exchange(0, std::memory_order_relaxed);
+
+    longAvg_ = longAvg_ == 0 ? avg : longAvg_ * 0.95 + avg * 0.05;
+    double gradient = std::clamp(options_.tolerance * longAvg_ / avg, 0.5, 1.0);
+    if (options_.targetNs > 0 && avg > (double) options_.targetNs) {
+      gradient = std::min(gradient, std::max(0.5, (double) options_.targetNs / avg));
+    }
+
+    const double current = smoothed_;
+    double next = current * gradient + std::sqrt(current);
+    if (next > current && (double) peak < current * 0.75) next = current; // Limit gar nicht genutzt
+    smoothed_ = std::clamp(current * 0.8 + next * 0.2, (double) options_.min, (double) options_.max);
+    limit_.store((std::size_t) smoothed_, std::memory_order_relaxed);
+  }
+
+public:
+  explicit AdaptiveLimit(Options options)
+    : options_(options)
+    , limit_(std::clamp(options.initial, options.min, options.max))
+    , windowEnd_((Clock::now() + options.window).time_since_epoch().count())
+    , smoothed_((double) limit_.load())
+  {}
+
+  std::size_t limit() const noexcept {
+    return limit_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Beim Zulassen: höchste gleichzeitige Last im Fenster merken (nur schreiben, wenn größer).
+   */
+  void onAdmit(std::size_t inflight) noexcept {
+    auto peak = peak_.load(std::memory_order_relaxed);
+    while (inflight > peak && !peak_.compare_exchange_weak(peak, inflight, std::memory_order_relaxed)) {}
+  }
+
+  void observe(std::int64_t latencyNs, Clock::time_point now = Clock::now()) {
+    sumNs_.add(latencyNs);
+    count_.add();
+    if (now.time_since_epoch().count() >= windowEnd_.load(std::memory_order_relaxed)) closeWindow(now);
+  }
+};
+
+/**
+ * AdmissionController
+ * - erster Request-Interceptor nach der Metrik-Zeitmarke, also vor AuthInterceptor: unter Überlast wird
+ *   abgelehnt, bevor ein Token dekodiert oder eine Signatur geprüft wird
+ * - zählt Requests in Bearbeitung (Request- bis Response-Interceptor); über dem Limit sofort 503 + Retry-After
+ *   (Body und Header einmal vorbereitet, keine Serialisierung)
+ * - Limit: fest (Static) oder AdaptiveLimit (Latenz von Zulassung bis Response = Auth + Handler)
+ * - Prioritäten pro Pfad-Präfix: critical wird nie abgelehnt, high darf das ganze Limit nutzen,
+ *   normal 90 %, low 60 % → bei steigender Last fällt zuerst low weg; jede Priorität bekommt mindestens
+ *   einen Slot (sonst sperrt ein kleines Limit low komplett aus)
+ * - als erster Response-Interceptor registrieren: wirft ein späterer (Pretty-Print, Kompression), ist der
+ *   Slot schon freigegeben
+ * - Zuordnung Request → Response wie MetricsInterceptor: thread_local, im Async-Modus zusätzlich im Bundle
+ */
+class AdmissionController
+  : public oatpp::web::server::interceptor::RequestInterceptor
+  , public oatpp::web::server::interceptor::ResponseInterceptor
+{
+public:
+  enum class Priority : std::uint8_t { Critical, High, Normal, Low };
+  static constexpr std::size_t kPriorities = 4;
+
+  static const char* priorityName(Priority p) {
+    switch (p) {
+      case Priority::Critical: return "critical";
+      case Priority::High: return "high";
+      case Priority::Low: return "low";
+      default: return "normal";
+    }
+  }
+
+  static Priority parsePriority(std::string_view name) {
+    for (std::size_t i = 0; i < kPriorities; ++i) {
+      if (name == priorityName((Priority) i)) return (Priority) i;
+    }
+    throw std::runtime_error("unknown admission priority '" + std::string(name) + "'");
+  }
+
+  struct Options {
+    bool adaptive = true;
+    AdaptiveLimit::Options limit;                              // bei !adaptive gilt limit.initial fest
+    int retryAfterSec = 1;
+    std::vector<std::pair<std::string, Priority>> routes;      // Pfad-Präfix → Priorität, Rest normal
+    bool crossThread = false;                                  // Async-Modus: Response auf anderem Thread möglich
+  };
+
+private:
+  using Request = oatpp::web::protocol::http::incoming::Request;
+  using Response = oatpp::web::protocol::http::outgoing::Response;
+  using Clock = AdaptiveLimit::Clock;
+
+  static constexpr std::array<double, kPriorities> kShare = {0.0, 1.0, 0.9, 0.6}; // Anteil am Limit
+
+  struct Admitted {
+    const Request* request = nullptr;
+    Clock::time_point at;
+  };
+  static Admitted& admitted() {
+    thread_local Admitted a;
+    return a;
+  }
+
+  bool adaptive_;
+  bool crossThread_;
+  std::size_t staticLimit_;
+  AdaptiveLimit limit_;
+  std::array<RouteMatcher, kPriorities> routes_;
+  std::array<bool, kPriorities> hasRoutes_{};
+  std::atomic<std::size_t> inflight_{0};
+  std::array<metrics::ShardedCounter, kPriorities> admittedCount_;
+  std::array<metrics::ShardedCounter, kPriorities> rejectedCount_;
+  oatpp::String rejectBody_ = "Server overloaded, retry later";
+  oatpp::String retryAfter_;
+
+  static std::string_view view(const oatpp::data::share::StringKeyLabel& l) {
+    return std::string_view(static_cast<const char*>(l.getData()), (std::size_t) l.getSize());
+  }
+
+  std::shared_ptr<Response> reject() const {
+    auto r = Response::createShared(oatpp::web::protocol::http::Status::CODE_503,
+      oatpp::web::protocol::http::outgoing::BufferBody::createShared(rejectBody_, "text/plain"));
+    r->putHeader("Retry-After", retryAfter_);
+    return r;
+  }
+
+public:
+  explicit AdmissionController(const Options& options)
+    : adaptive_(options.adaptive)
+    , crossThread_(options.crossThread)
+    , staticLimit_(std::max<std::size_t>(1, options.limit.initial))
+    , limit_(options.limit)
+    , retryAfter_(std::to_string(std::max(1, options.retryAfterSec)))
+  {
+    for (const auto& [prefix, priority] : options.routes) {
+      routes_[(std::size_t) priority].addPrefix(prefix);
+      hasRoutes_[(std::size_t) priority] = true;
+    }
+  }
+
+  Priority priorityOf(std::string_view path) const {
+    for (auto p : {Priority::Critical, Priority::High, Priority::Low}) {
+      if (hasRoutes_[(std::size_t) p] && routes_[(std::size_t) p].matches(path)) return p;
+    }
+    return Priority::Normal;
+  }
+
+  std::size_t limit() const noexcept {
+    return adaptive_ ? limit_.limit() : staticLimit_;
+  }
+
+  std::size_t inflight() const noexcept {
+    return inflight_.load(std::memory_order_relaxed);
+  }
+
+  std::int64_t admittedCount(Priority p) const noexcept { return admittedCount_[(std::size_t) p].value(); }
+  std::int64_t rejectedCount(Priority p) const noexcept { return rejectedCount_[(std::size_t) p].value(); }
+
+  std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req) override {
+    const auto priority = priorityOf(view(req->getStartingLine().path));
+    const auto i = (std::size_t) priority;
+    const auto now = inflight_.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (priority != Priority::Critical && (double) now > std::max(1.0, (double) limit() * kShare[i])) {
+      inflight_.fetch_sub(1, std::memory_order_relaxed);
+      admitted().request = nullptr;
+      rejectedCount_[i].add();
+      return reject();
+    }
+    admittedCount_[i].add();
+    if (adaptive_) limit_.onAdmit(now);
+    const auto at = Clock::now();
+    admitted() = {req.get(), at};
+    if (crossThread_) {
+      req->putBundleData("admission.start", oatpp::Int64((v_int64) at.time_since_epoch().count()));
+    }
+    return nullptr;
+  }
+
+  std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req,
+                                      const std::shared_ptr<Response>& res) override {
+    if (!req) return res;
+    auto& a = admitted();
+    Clock::time_point at;
+    if (a.request == req.get()) {
+      at = a.at;
+    } else if (crossThread_) {
+      const auto stored = req->getBundleData<oatpp::Int64>("admission.start");
+      if (!stored) return res; // abgelehnt (oder nie hier vorbeigekommen)
+      at = Clock::time_point(Clock::duration(*stored));
+    } else {
+      return res;
+    }
+    a.request = nullptr;
+    inflight_.fetch_sub(1, std::memory_order_relaxed);
+    if (adaptive_) {
+      const auto now = Clock::now();
+      limit_.observe(std::chrono::duration_cast<std::chrono::nanoseconds>(now - at).count(), now);
+    }
+    return res;
+  }
+};
@@ -0,0 +1,253 @@
+#pragma once
+#include <zlib.h>
+#ifdef MY_PROJECT_BROTLI
+#include <brotli/encode.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Content-Encoding für Responses (ohne oatpp-Abhängigkeit, Einbindung: CompressionInterceptor).
+ * - Encoding: identity, gzip, deflate (zlib-Format, wie HTTP "deflate" es meint), br (nur mit MY_PROJECT_BROTLI)
+ * - negotiate(): Accept-Encoding mit q-Werten (RFC 9110 §12.5.3); höchstes q gewinnt, bei Gleichstand
+ *   die Reihenfolge des Servers; "*" deckt alles nicht Genannte ab, q=0 schließt aus
+ * - StreamEncoder: inkrementell (Eingabe stückweise, Ausgabe in fremden Puffer), nie der ganze Body im Speicher
+ */
+namespace compression {
+
+enum class Encoding : std::uint8_t { Identity, Gzip, Deflate, Brotli };
+
+inline const char* name(Encoding e) {
+  switch (e) {
+    case Encoding::Gzip: return "gzip";
+    case Encoding::Deflate: return "deflate";
+    case Encoding::Brotli: return "br";
+    default: return "identity";
+  }
+}
+
+inline bool available(Encoding e) {
+#ifdef MY_PROJECT_BROTLI
+  (void) e;
+  return true;
+#else
+  return e != Encoding::Brotli;
+#endif
+}
+
+/**
+ * "gzip" / "x-gzip" / "deflate" / "br" / "identity" (Groß-/Kleinschreibung egal); unbekannt → false.
+ */
+inline bool parse(std::string_view token, Encoding& out) {
+  auto eq = [&](const char* s) {
+    const std::string_view v(s);
+    return token.size() == v.size() && std::equal(token.begin(), token.end(), v.begin(), [](char a, char b) {
+      return (a >= 'A' && a <= 'Z' ? char(a - 'A' + 'a') : a) == b;
+    });
+  };
+  if (eq("gzip") || eq("x-gzip")) { out = Encoding::Gzip; return true; }
+  if (eq("deflate")) { out = Encoding::Deflate; return true; }
+  if (eq("br")) { out = Encoding::Brotli; return true; }
+  if (eq("identity")) { out = Encoding::Identity; return true; }
+  return false;
+}
+
+namespace detail {
+
+inline std::string_view trim(std::string_view v) {
+  while (!v.empty() && (v.front() == ' ' || v.front() == '\t')) v.remove_prefix(1);
+  while (!v.empty() && (v.back() == ' ' || v.back() == '\t')) v.remove_suffix(1);
+  return v;
+}
+
+/**
+ * q-Wert in Tausendsteln; fehlend = 1000, unlesbar = 0.
+ */
+inline int qOf(std::string_view params) {
+  while (!params.empty()) {
+    const auto semi = params.find(';');
+    auto p = trim(params.substr(0, semi));
+    const auto rest = p.empty() ? p : trim(p.substr(1));
+    if (!p.empty() && (p[0] == 'q' || p[0] == 'Q') && !rest.empty() && rest[0] == '=') {
+      auto v = trim(rest.substr(1));
+      if (v.empty() || (v[0] != '0' && v[0] != '1')) return 0;
+      int q = v[0] == '1' ? 1000 : 0;
+      if (v.size() > 2 && v[1] == '.' && v[0] == '0') {
+        int scale = 100;
+        for (std::size_t i = 2; i < v.size() && i < 5 && v[i] >= '0' && v[i] <= '9'; ++i, scale /= 10) {
+          q += (v[i] - '0') * scale;
+        }
+      }
+      return q;
+    }
+    if (semi == std::string_view::npos) break;
+    params.remove_prefix(semi + 1);
+  }
+  return 1000;
+}
+
+}
+
+/**
+ * Bestes Encoding aus `offered` (Server-Präferenz, vorne = bevorzugt) für den Accept-Encoding-Header.
+ * Kein Header oder nichts Passendes → Identity.
+ */
+inline Encoding negotiate(std::string_view acceptEncoding, const std::vector<Encoding>& offered) {
+  constexpr int kUnset = -1;
+  int q[4] = {kUnset, kUnset, kUnset, kUnset};
+  int wildcard = kUnset;
+
+  while (!acceptEncoding.empty()) {
+    const auto comma = acceptEncoding.find(',');
+    const auto item = detail::trim(acceptEncoding.substr(0, comma));
+    const auto semi = item.find(';');
+    const auto token = detail::trim(item.substr(0, semi));
+    const int value = semi == std::string_view::npos ? 1000 : detail::qOf(item.substr(semi + 1));
+    Encoding e;
+    if (token == "*") {
+      wildcard = value;
+    } else if (parse(token, e)) {
+      q[(std::size_t) e] = std::max(q[(std::size_t) e], value);
+    }
+    if (comma == std::string_view::npos) break;
+    acceptEncoding.remove_prefix(comma + 1);
+  }
+
+  Encoding best = Encoding::Identity;
+  int bestQ = 0;
+  for (auto e : offered) {
+    int v = q[(std::size_t) e];
+    if (v == kUnset) v = wildcard == kUnset ? 0 : wildcard;
+    if (v > bestQ) {
+      best = e;
+      bestQ = v;
+    }
+  }
+  return best;
+}
+
+/**
+ * Lohnt Kompression für diesen Content-Type? Text, JSON, XML, JavaScript; Bilder, Archive usw. nicht.
+ */
+inline bool compressible(std::string_view contentType) {
+  const auto semi = contentType.find(';');
+  const auto type = detail::trim(contentType.substr(0, semi));
+  auto has = [&](std::string_view s) { return type.find(s) != std::string_view::npos; };
+  return type.substr(0, 5) == "text/" || has("json") || has("xml") || has("javascript");
+}
+
+class StreamEncoder {
+public:
+  struct Progress {
+    std::size_t consumed = 0;
+    std::size_t produced = 0;
+    bool finished = false;  // Stream inkl. Trailer vollständig ausgegeben
+  };
+
+  virtual ~StreamEncoder() = default;
+
+  /**
+   * Nimmt so viel von `in` wie möglich, schreibt höchstens `outSize` Bytes.
+   * finish = true: `in` ist der Rest der Eingabe; so lange wiederholen, bis finished.
+   */
+  virtual Progress encode(const void* in, std::size_t inSize, void* out, std::size_t outSize, bool finish) = 0;
+};
+
+class ZlibEncoder : public StreamEncoder {
+  z_stream z_{};
+public:
+  /**
+   * @param level 1 (schnell) … 9 (klein), Z_DEFAULT_COMPRESSION = 6
+   */
+  ZlibEncoder(Encoding format, int level) {
+    const int windowBits = format == Encoding::Gzip ? 15 + 16 : 15; // +16: gzip-Header/Trailer
+    if (deflateInit2(&z_, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+      throw std::runtime_error("deflateInit2 failed");
+    }
+  }
+
+  ~ZlibEncoder() override {
+    deflateEnd(&z_);
+  }
+
+  ZlibEncoder(const ZlibEncoder&) = delete;
+  ZlibEncoder& operator=(const ZlibEncoder&) = delete;
+
+  Progress encode(const void* in, std::size_t inSize, void* out, std::size_t outSize, bool finish) override {
+    z_.next_in = static_cast<Bytef*>(const_cast<void*>(in));
+    z_.avail_in = (uInt) std::min<std::size_t>(inSize, UINT32_MAX);
+    z_.next_out = static_cast<Bytef*>(out);
+    z_.avail_out = (uInt) std::min<std::size_t>(outSize, UINT32_MAX);
+    const auto availIn = z_.avail_in;
+    const auto availOut = z_.avail_out;
+    const int rc = deflate(&z_, finish && z_.avail_in == inSize ? Z_FINISH : Z_NO_FLUSH);
+    if (rc == Z_STREAM_ERROR) throw std::runtime_error("deflate failed");
+    return {availIn - z_.avail_in, availOut - z_.avail_out, rc == Z_STREAM_END};
+  }
+};
+
+#ifdef MY_PROJECT_BROTLI
+class BrotliEncoder : public StreamEncoder {
+  BrotliEncoderState* s_;
+public:
+  /**
+   * @param quality 0 … 11; für dynamische Antworten sind 4–5 üblich, 11 nur für Vorkomprimiertes
+   */
+  explicit BrotliEncoder(int quality)
+    : s_(BrotliEncoderCreateInstance(nullptr, nullptr, nullptr))
+  {
+    if (!s_) throw std::runtime_error("BrotliEncoderCreateInstance failed");
+    BrotliEncoderSetParameter(s_, BROTLI_PARAM_QUALITY, (std::uint32_t) std::clamp(quality, 0, 11));
+    BrotliEncoderSetParameter(s_, BROTLI_PARAM_LGWIN, 18); // 256 KiB Fenster statt 4 MiB pro Response
+  }
+
+  ~BrotliEncoder() override {
+    BrotliEncoderDestroyInstance(s_);
+  }
+
+  BrotliEncoder(const BrotliEncoder&) = delete;
+  BrotliEncoder& operator=(const BrotliEncoder&) = delete;
+
+  Progress encode(const void* in, std::size_t inSize, void* out, std::size_t outSize, bool finish) override {
+    auto nextIn = static_cast<const std::uint8_t*>(in);
+    auto nextOut = static_cast<std::uint8_t*>(out);
+    std::size_t availIn = inSize;
+    std::size_t availOut = outSize;
+    if (!BrotliEncoderCompressStream(s_, finish ? BROTLI_OPERATION_FINISH : BROTLI_OPERATION_PROCESS,
+                                     &availIn, &nextIn, &availOut, &nextOut, nullptr)) {
+      throw std::runtime_error("BrotliEncoderCompressStream failed");
+    }
+    return {inSize - availIn, outSize - availOut, BrotliEncoderIsFinished(s_) == BROTLI_TRUE};
+  }
+};
+#endif
+
+struct Options {
+  std::vector<Encoding> encodings;  // angeboten, in Server-Präferenz
+  std::size_t minSize = 1024;       // kleinere Bodies (bekannte Größe) bleiben unkomprimiert
+  int level = 6;                    // gzip/deflate
+  int brotliQuality = 4;            // br
+};
+
+inline std::unique_ptr<StreamEncoder> makeEncoder(Encoding e, const Options& options) {
+  switch (e) {
+    case Encoding::Gzip:
+    case Encoding::Deflate:
+      return std::make_unique<ZlibEncoder>(e, options.level);
+#ifdef MY_PROJECT_BROTLI
+    case Encoding::Brotli:
+      return std::make_unique<BrotliEncoder>(options.brotliQuality);
+#endif
+    default:
+      return nullptr;
+  }
+}
+
+}
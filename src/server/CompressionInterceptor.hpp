@@ -0,0 +1,148 @@
+#pragma once
+#include "Compression.hpp"
+
+#include "oatpp/web/server/interceptor/ResponseInterceptor.hpp"
+#include "oatpp/web/protocol/http/outgoing/Body.hpp"
+
+#include <string_view>
+
+/**
+ * CompressedBody
+ * - umhüllt den fertigen Body und komprimiert beim Senden: read() zieht Eingabe vom inneren Body, gibt
+ *   komprimierte Bytes direkt in den Sendepuffer von oatpp → kein Zwischenpuffer für den ganzen Body
+ * - Größe unbekannt → oatpp sendet chunked (kein Content-Length)
+ * - BufferBody & Co. (bekannte Daten) werden ohne Kopie gelesen, sonst über einen 16-KiB-Eingabepuffer
+ */
+class CompressedBody : public oatpp::web::protocol::http::outgoing::Body {
+  static constexpr std::size_t kInputBuffer = 16 * 1024;
+
+  std::shared_ptr<Body> inner_;
+  std::unique_ptr<compression::StreamEncoder> encoder_;
+  std::unique_ptr<std::uint8_t[]> buffer_;
+  const std::uint8_t* in_ = nullptr;
+  std::size_t inSize_ = 0;
+  std::size_t inPos_ = 0;
+  bool innerDone_ = false;
+  bool finished_ = false;
+
+public:
+  CompressedBody(std::shared_ptr<Body> inner, std::unique_ptr<compression::StreamEncoder> encoder)
+    : inner_(std::move(inner))
+    , encoder_(std::move(encoder))
+  {
+    if (inner_->getKnownData()) {
+      in_ = inner_->getKnownData();
+      inSize_ = (std::size_t) inner_->getKnownSize();
+      innerDone_ = true;
+    } else {
+      buffer_.reset(new std::uint8_t[kInputBuffer]);
+      in_ = buffer_.get();
+    }
+  }
+
+  oatpp::v_io_size read(void* buffer, v_buff_size count, oatpp::async::Action& action) override {
+    if (finished_ || count <= 0) return 0;
+    auto* out = static_cast<std::uint8_t*>(buffer);
+    std::size_t produced = 0;
+    while (produced == 0) {
+      if (inPos_ == inSize_ && !innerDone_) {
+        const auto n = inner_->read(buffer_.get(), (v_buff_size) kInputBuffer, action);
+        if (n < 0) return n; // RETRY/Fehler des inneren Bodys durchreichen (async: action gesetzt)
+        innerDone_ = n == 0;
+        inSize_ = (std::size_t) n;
+        inPos_ = 0;
+      }
+      const auto p = encoder_->encode(in_ + inPos_, inSize_ - inPos_, out, (std::size_t) count, innerDone_);
+      inPos_ += p.consumed;
+      produced = p.produced;
+      if (p.finished) {
+        finished_ = true;
+        break;
+      }
+    }
+    return (oatpp::v_io_size) produced;
+  }
+
+  void declareHeaders(Headers& headers) override {
+    inner_->declareHeaders(headers); // Content-Type des Originals
+  }
+
+  p_char8 getKnownData() override {
+    return nullptr;
+  }
+
+  v_int64 getKnownSize() override {
+    return -1;
+  }
+};
+
+/**
+ * CompressionInterceptor
+ * - Response-Interceptor: wählt per Accept-Encoding ein Encoding und ersetzt den Body durch CompressedBody,
+ *   Status und Header bleiben, dazu Content-Encoding und Vary: Accept-Encoding
+ * - nicht komprimiert: HEAD, 1xx/204/304, schon kodierte Bodies, nicht komprimierbare Content-Types,
+ *   Bodies bekannter Größe unter minSize
+ * - die eigentliche Arbeit fällt erst beim Senden an (nach allen Interceptors, außerhalb von Server-Timing)
+ */
+class CompressionInterceptor : public oatpp::web::server::interceptor::ResponseInterceptor {
+  using Request = oatpp::web::protocol::http::incoming::Request;
+  using Response = oatpp::web::protocol::http::outgoing::Response;
+  using Headers = oatpp::web::protocol::http::Headers;
+
+  compression::Options options_;
+
+  static std::string_view view(const oatpp::data::share::MemoryLabel& l) {
+    return std::string_view(static_cast<const char*>(l.getData()), (std::size_t) l.getSize());
+  }
+
+  static void addVary(Response& res) {
+    auto vary = res.getHeader("Vary");
+    if (!vary) {
+      res.putHeader("Vary", "Accept-Encoding");
+    } else if (vary->find("Accept-Encoding") == std::string::npos && *vary != "*") {
+      res.putOrReplaceHeader("Vary", *vary + ", Accept-Encoding");
+    }
+  }
+
+public:
+  explicit CompressionInterceptor(compression::Options options)
+    : options_(std::move(options))
+  {}
+
+  const compression::Options& options() const noexcept { return options_; }
+
+  std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req,
+                                      const std::shared_ptr<Response>& res) override {
+    if (!req || !res) return res;
+    const auto status = res->getStatus().code;
+    if (status < 200 || status == 204 || status == 304) return res;
+    if (view(req->getStartingLine().method) == "HEAD") return res;
+
+    const auto& body = res->getBody();
+    if (!body || res->getHeader("Content-Encoding")) return res;
+    const auto size = body->getKnownSize();
+    if (size >= 0 && (std::size_t) size < options_.minSize) return res;
+
+    Headers bodyHeaders;
+    body->declareHeaders(bodyHeaders);
+    auto contentType = res->getHeader("Content-Type");
+    if (!contentType) contentType = bodyHeaders.get("Content-Type");
+    if (!contentType || !compression::compressible(*contentType)) return res;
+
+    // ab hier hängt die Antwort vom Accept-Encoding ab, auch wenn am Ende nicht komprimiert wird
+    addVary(*res);
+    const auto& headers = req->getHeaders().getAll_Unsafe();
+    auto accept = headers.find("Accept-Encoding");
+    if (accept == headers.end()) return res;
+    const auto encoding = compression::negotiate(view(accept->second), options_.encodings);
+    if (encoding == compression::Encoding::Identity) return res;
+
+    auto compressed = Response::createShared(res->getStatus(),
+      std::make_shared<CompressedBody>(body, compression::makeEncoder(encoding, options_)));
+    for (const auto& h : res->getHeaders().getAll()) {
+      compressed->putHeader(h.first.toString(), h.second.toString());
+    }
+    compressed->putHeader("Content-Encoding", compression::name(encoding));
+    return compressed;
+  }
+};
@@ -0,0 +1,21 @@
+#pragma once
+#include "StaticResponse.hpp"
+#include "dto/DTOs.hpp"
+
+/**
+ * HelloResponse
+ * - {"statusCode":200,"message":"Hello World!"} der Root- und Ping-Endpoints aller Controller
+ * - create() liefert sie als StaticResponse (einmal beim Start serialisiert)
+ */
+struct HelloResponse {
+  static oatpp::Object<MyDto> dto() {
+    auto dto = MyDto::createShared();
+    dto->statusCode = 200;
+    dto->message = "Hello World!";
+    return dto;
+  }
+
+  static StaticResponse create(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& mapper) {
+    return StaticResponse(oatpp::web::protocol::http::Status::CODE_200, dto(), mapper);
+  }
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include "oatpp/network/Server.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * MultiAcceptorServer
+ * - ein oatpp::network::Server (= eine Accept-Schleife) pro Connection-Provider
+ * - alle teilen sich denselben ConnectionHandler (Thread- oder Async-Modus)
+ * - run() blockiert: Shard 0 läuft im aufrufenden Thread, die übrigen in eigenen Threads
+ */
+class MultiAcceptorServer {
+  std::vector<std::shared_ptr<oatpp::network::ServerConnectionProvider>> providers_;
+  std::vector<std::shared_ptr<oatpp::network::Server>> servers_;
+
+public:
+  MultiAcceptorServer(std::vector<std::shared_ptr<oatpp::network::ServerConnectionProvider>> providers,
+                      const std::shared_ptr<oatpp::network::ConnectionHandler>& handler)
+    : providers_(std::move(providers))
+  {
+    servers_.reserve(providers_.size());
+    for (const auto& p : providers_) {
+      servers_.push_back(std::make_shared<oatpp::network::Server>(p, handler));
+    }
+  }
+
+  std::size_t acceptors() const noexcept { return servers_.size(); }
+
+  void run() {
+    std::vector<std::thread> threads;
+    threads.reserve(servers_.size());
+    for (std::size_t i = 1; i < servers_.size(); ++i) {
+      threads.emplace_back([server = servers_[i]] { server->run(); });
+    }
+    if (!servers_.empty()) servers_[0]->run();
+    for (auto& t : threads) t.join();
+  }
+
+  void stop() {
+    for (const auto& s : servers_) s->stop();
+    for (const auto& p : providers_) p->stop();
+  }
+};
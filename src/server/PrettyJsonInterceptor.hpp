@@ -0,0 +1,106 @@
+#pragma once
+#include "oatpp/web/server/interceptor/RequestInterceptor.hpp"
+#include "oatpp/web/server/interceptor/ResponseInterceptor.hpp"
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+#include "oatpp/json/Beautifier.hpp"
+#include "oatpp/data/stream/BufferStream.hpp"
+
+#include <string_view>
+
+/**
+ * PrettyJsonInterceptor
+ * - JSON wird kompakt serialisiert (Default); formatiert nur auf Wunsch pro Request:
+ *   Query-Parameter ?pretty (bzw. pretty=true/1) oder Accept-Parameter, z.B. "Accept: application/json; pretty=true"
+ * - Response-Interceptor formatiert den fertigen JSON-Body nachträglich (json::Beautifier), Status und Header bleiben
+ * - Normalfall (kein pretty): ein Substring-Test auf dem Pfad + ein Header-Lookup, keine Allokation
+ */
+class PrettyJsonInterceptor : public oatpp::web::server::interceptor::ResponseInterceptor {
+  using Request = oatpp::web::protocol::http::incoming::Request;
+  using Response = oatpp::web::protocol::http::outgoing::Response;
+  using Headers = oatpp::web::protocol::http::Headers;
+
+  static std::string_view view(const oatpp::data::share::MemoryLabel& l) {
+    return std::string_view(static_cast<const char*>(l.getData()), (std::size_t) l.getSize());
+  }
+
+  static bool truthy(std::string_view v) {
+    return v.empty() || v == "true" || v == "1";
+  }
+
+  static std::string_view trim(std::string_view v) {
+    while (!v.empty() && (v.front() == ' ' || v.front() == '\t')) v.remove_prefix(1);
+    while (!v.empty() && (v.back() == ' ' || v.back() == '\t')) v.remove_suffix(1);
+    return v;
+  }
+
+public:
+  /**
+   * "?pretty", "?a=1&pretty=true" → true; "?pretty=false", "?prettyx" → false.
+   */
+  static bool prettyQuery(std::string_view path) {
+    const auto q = path.find('?');
+    if (q == std::string_view::npos) return false;
+    auto query = path.substr(q + 1);
+    while (!query.empty()) {
+      const auto amp = query.find('&');
+      const auto param = query.substr(0, amp);
+      const auto eq = param.find('=');
+      if (param.substr(0, eq) == "pretty") {
+        return truthy(eq == std::string_view::npos ? std::string_view() : param.substr(eq + 1));
+      }
+      if (amp == std::string_view::npos) break;
+      query.remove_prefix(amp + 1);
+    }
+    return false;
+  }
+
+  /**
+   * Media-Range-Parameter "pretty" im Accept-Header, z.B. "application/json; pretty=true" oder "application/json;pretty".
+   */
+  static bool prettyAccept(std::string_view accept) {
+    std::size_t pos = 0;
+    while ((pos = accept.find(';', pos)) != std::string_view::npos) {
+      ++pos;
+      auto end = accept.find_first_of(";,", pos);
+      auto param = trim(accept.substr(pos, end == std::string_view::npos ? std::string_view::npos : end - pos));
+      const auto eq = param.find('=');
+      if (trim(param.substr(0, eq)) == "pretty") {
+        return truthy(eq == std::string_view::npos ? std::string_view() : trim(param.substr(eq + 1)));
+      }
+    }
+    return false;
+  }
+
+  static bool wantsPretty(const Request& req) {
+    const auto path = view(req.getStartingLine().path);
+    if (path.find("pretty") != std::string_view::npos && prettyQuery(path)) return true;
+    const auto& headers = req.getHeaders().getAll_Unsafe();
+    auto h = headers.find("Accept");
+    return h != headers.end() && prettyAccept(view(h->second));
+  }
+
+  std::shared_ptr<Response> intercept(const std::shared_ptr<Request>& req,
+                                      const std::shared_ptr<Response>& res) override {
+    if (!req || !res || !wantsPretty(*req)) return res;
+
+    const auto& body = res->getBody();
+    if (!body || !body->getKnownData()) return res; // Streaming-Body → unverändert
+    Headers bodyHeaders;
+    body->declareHeaders(bodyHeaders);
+    const auto contentType = bodyHeaders.get("Content-Type");
+    if (!contentType || contentType->find("json") == std::string::npos) return res;
+
+    oatpp::data::stream::BufferOutputStream out;
+    {
+      oatpp::json::Beautifier beautifier(&out, "  ", "\n");
+      beautifier.writeSimple(body->getKnownData(), body->getKnownSize());
+    }
+
+    auto pretty = Response::createShared(res->getStatus(),
+      oatpp::web::protocol::http::outgoing::BufferBody::createShared(out.toString(), contentType));
+    for (const auto& h : res->getHeaders().getAll()) {
+      pretty->putHeader(h.first.toString(), h.second.toString());
+    }
+    return pretty;
+  }
+};
@@ -0,0 +1,202 @@
+#pragma once
+#include "ServerConfig.hpp"
+
+#include "oatpp/network/ConnectionProvider.hpp"
+#include "oatpp/network/tcp/Connection.hpp"
+#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/**
+ * ReusePortConnectionProvider
+ * - ein Listen-Socket (POSIX) mit konfigurierbarem Backlog, Bind-Adresse und IPv6-Dual-Stack
+ * - SO_REUSEPORT bei mehreren Acceptors: jeder Provider hat seinen eigenen Socket auf demselben Port,
+ *   der Kernel verteilt neue Verbindungen, jeder Socket bekommt seine eigene Accept-Schleife
+ *   (siehe MultiAcceptorServer)
+ * - liefert tcp::Connection mit Peer-Adresse wie der Standard-Provider mit useExtendedConnections
+ *   (Properties "peer_address", "peer_address_format", "peer_port"; z.B. für das IP-Rate-Limit)
+ */
+class ReusePortConnectionProvider : public oatpp::network::ServerConnectionProvider {
+private:
+
+  class ConnectionInvalidator : public oatpp::provider::Invalidator<oatpp::data::stream::IOStream> {
+  public:
+    void invalidate(const std::shared_ptr<oatpp::data::stream::IOStream>& connection) override {
+      auto c = std::static_pointer_cast<oatpp::network::tcp::Connection>(connection);
+      ::shutdown(c->getHandle(), SHUT_RDWR); // schließen übernimmt der Destruktor der Connection
+    }
+  };
+
+  using ExtendedConnection = oatpp::network::tcp::server::ConnectionProvider::ExtendedConnection;
+
+  static oatpp::data::stream::Context::Properties peerProperties(const sockaddr_storage& peer) {
+    char address[INET6_ADDRSTRLEN] = {0};
+    std::uint16_t port = 0;
+    const char* format = "ipv4";
+    if (peer.ss_family == AF_INET6) {
+      const auto& a = reinterpret_cast<const sockaddr_in6&>(peer);
+      ::inet_ntop(AF_INET6, &a.sin6_addr, address, sizeof(address));
+      port = ntohs(a.sin6_port);
+      format = "ipv6";
+    } else if (peer.ss_family == AF_INET) {
+      const auto& a = reinterpret_cast<const sockaddr_in&>(peer);
+      ::inet_ntop(AF_INET, &a.sin_addr, address, sizeof(address));
+      port = ntohs(a.sin_port);
+    }
+    oatpp::data::stream::Context::Properties properties;
+    properties.put_LockFree(ExtendedConnection::PROPERTY_PEER_ADDRESS, oatpp::String(address));
+    properties.put_LockFree(ExtendedConnection::PROPERTY_PEER_ADDRESS_FORMAT, format);
+    properties.put_LockFree(ExtendedConnection::PROPERTY_PEER_PORT, oatpp::String(std::to_string(port)));
+    return properties;
+  }
+
+  std::shared_ptr<ConnectionInvalidator> m_invalidator;
+  std::atomic<bool> m_closed{false};
+  int m_handle = -1;
+  std::uint16_t m_port = 0;
+
+  static void fail(const char* what, int fd) {
+    const std::string msg = std::string("[ReusePortConnectionProvider]: ") + what + ": " + std::strerror(errno);
+    if (fd >= 0) ::close(fd);
+    throw std::runtime_error(msg);
+  }
+
+  void listenOn(const ServerConfig& cfg, std::uint16_t port, bool reusePort) {
+    std::string host = cfg.host;
+    if (cfg.dualStack && (host.empty() || host == "0.0.0.0")) host = "::";
+
+    addrinfo hints{};
+    hints.ai_family = cfg.dualStack ? AF_INET6 : AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE | AI_NUMERICSERV;
+    addrinfo* result = nullptr;
+    const auto portStr = std::to_string(port);
+    if (::getaddrinfo(host.empty() ? nullptr : host.c_str(), portStr.c_str(), &hints, &result) != 0 || !result) {
+      throw std::runtime_error("[ReusePortConnectionProvider]: can't resolve bind address '" + host + "'");
+    }
+    std::unique_ptr<addrinfo, decltype(&::freeaddrinfo)> guard(result, ::freeaddrinfo);
+
+    const int fd = ::socket(result->ai_family, result->ai_socktype | SOCK_CLOEXEC, result->ai_protocol);
+    if (fd < 0) fail("socket()", fd);
+
+    const int yes = 1;
+    if (::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes)) != 0) fail("SO_REUSEADDR", fd);
+    if (reusePort && ::setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes)) != 0) fail("SO_REUSEPORT", fd);
+    if (result->ai_family == AF_INET6) {
+      const int v6only = cfg.dualStack ? 0 : 1;
+      if (::setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &v6only, sizeof(v6only)) != 0) fail("IPV6_V6ONLY", fd);
+    }
+    if (::bind(fd, result->ai_addr, result->ai_addrlen) != 0) fail("bind()", fd);
+    if (::listen(fd, cfg.backlog) != 0) fail("listen()", fd);
+
+    // tatsächlichen Port lesen (Port 0 → vom Kernel vergeben, weitere Shards binden denselben)
+    sockaddr_storage bound{};
+    socklen_t len = sizeof(bound);
+    if (::getsockname(fd, reinterpret_cast<sockaddr*>(&bound), &len) != 0) fail("getsockname()", fd);
+    m_port = ntohs(bound.ss_family == AF_INET6
+      ? reinterpret_cast<sockaddr_in6*>(&bound)->sin6_port
+      : reinterpret_cast<sockaddr_in*>(&bound)->sin_port);
+    m_handle = fd;
+
+    setProperty(PROPERTY_HOST, host);
+    setProperty(PROPERTY_PORT, std::to_string(m_port));
+  }
+
+public:
+
+  /**
+   * @param port - überschreibt cfg.port (z.B. den tatsächlichen Port des ersten Shards)
+   * @param reusePort - SO_REUSEPORT setzen (Pflicht für alle Shards, wenn mehr als einer bindet)
+   */
+  ReusePortConnectionProvider(const ServerConfig& cfg, std::uint16_t port, bool reusePort)
+    : m_invalidator(std::make_shared<ConnectionInvalidator>())
+  {
+    listenOn(cfg, port, reusePort);
+  }
+
+  static std::shared_ptr<ReusePortConnectionProvider> createShared(const ServerConfig& cfg) {
+    return std::make_shared<ReusePortConnectionProvider>(cfg, cfg.port, cfg.acceptorCount() > 1);
+  }
+
+  /**
+   * Weiterer Shard auf demselben Port wie `first` (SO_REUSEPORT).
+   */
+  static std::shared_ptr<ReusePortConnectionProvider> createShard(const ServerConfig& cfg,
+                                                                  const ReusePortConnectionProvider& first) {
+    return std::make_shared<ReusePortConnectionProvider>(cfg, first.port(), true);
+  }
+
+  /**
+   * Alle Listener für cfg.acceptorCount(): `first` und weitere Shards auf dessen Port.
+   * Wirft, wenn mehrere Acceptors verlangt sind, `first` aber kein ReusePortConnectionProvider ist.
+   */
+  static std::vector<std::shared_ptr<oatpp::network::ServerConnectionProvider>>
+  withShards(const ServerConfig& cfg, const std::shared_ptr<oatpp::network::ServerConnectionProvider>& first) {
+    std::vector<std::shared_ptr<oatpp::network::ServerConnectionProvider>> providers{first};
+    if (cfg.acceptorCount() <= 1) return providers;
+    const auto reusePort = std::dynamic_pointer_cast<ReusePortConnectionProvider>(first);
+    if (!reusePort) {
+      throw std::runtime_error("[ReusePortConnectionProvider]: SERVER_ACCEPTORS > 1 needs a ReusePortConnectionProvider");
+    }
+    for (std::size_t i = 1; i < cfg.acceptorCount(); ++i) {
+      providers.push_back(createShard(cfg, *reusePort));
+    }
+    return providers;
+  }
+
+  ~ReusePortConnectionProvider() override {
+    stop();
+  }
+
+  std::uint16_t port() const noexcept { return m_port; }
+
+  void stop() override {
+    if (!m_closed.exchange(true) && m_handle >= 0) {
+      ::shutdown(m_handle, SHUT_RDWR);
+      ::close(m_handle);
+    }
+  }
+
+  /**
+   * Blockiert bis eine Verbindung da ist; prüft jede Sekunde, ob stop() gerufen wurde.
+   */
+  oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream> get() override {
+    pollfd p{m_handle, POLLIN, 0};
+    while (!m_closed.load(std::memory_order_relaxed)) {
+      const int r = ::poll(&p, 1, 1000);
+      if (r <= 0) continue; // Timeout oder EINTR
+      sockaddr_storage peer{};
+      socklen_t peerLen = sizeof(peer);
+      const int fd = ::accept4(m_handle, reinterpret_cast<sockaddr*>(&peer), &peerLen, SOCK_CLOEXEC);
+      if (fd < 0) {
+        // Verbindungs-/Deskriptor-Limit: kurz warten statt heiß zu pollen; sonst (ECONNABORTED, ...) weiter
+        if (errno == EMFILE || errno == ENFILE) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        continue;
+      }
+      return oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>(
+        std::make_shared<ExtendedConnection>(fd, peerProperties(peer)), m_invalidator);
+    }
+    return nullptr;
+  }
+
+  oatpp::async::CoroutineStarterForResult<const oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>&>
+  getAsync() override {
+    // wie beim Standard-TCP-Provider: Server akzeptieren synchron, auch im Async-Modus
+    throw std::runtime_error("[ReusePortConnectionProvider::getAsync()]: Error. Not implemented.");
+  }
+
+};
@@ -0,0 +1,192 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * Server-Konfiguration (ENV-getrieben).
+ * - mode: "threaded" (HttpConnectionHandler, ein Thread pro Verbindung, Default),
+ *   "pool" (WorkerPoolConnectionHandler, feste Worker + begrenzte Queue, synchrone ENDPOINTs)
+ *   oder "async" (AsyncHttpConnectionHandler + oatpp::async::Executor, ENDPOINT_ASYNC-Controller)
+ * - poolWorkers / poolQueueDepth / poolPinCpus / poolIdleTimeoutMs: Pool-Modus (poolWorkers 0 = 4 × CPU-Kerne)
+ * - asyncDataThreads / asyncIoThreads / asyncTimerThreads: Executor-Größen im Async-Modus
+ *   (asyncDataThreads 0 = CPU-Kerne)
+ * - host / port: Bind-Adresse (Default 0.0.0.0:8000)
+ * - dualStack: IPv6-Socket, der auch IPv4 annimmt (0.0.0.0 wird dann zu ::)
+ * - backlog: listen()-Backlog
+ * - acceptors: Anzahl Listen-Sockets mit SO_REUSEPORT, je eine Accept-Schleife (1 = klassisch, 0 = CPU-Kerne)
+ * - virtualHost: statt TCP auf dem oatpp-virtual_::Interface dieses Namens lauschen (In-Process, z.B. Lastgenerator);
+ *   leer = TCP, host/port/acceptors werden dann ignoriert
+ * - serverTiming: Server-Timing-Header mit Stage-Zeiten; "off" (Interceptor gar nicht installiert, Default),
+ *   "request" (nur Requests mit Header X-Server-Timing) oder "always"
+ * - compression: angebotene Content-Encodings in Server-Präferenz ("br", "gzip", "deflate"; br nur mit
+ *   MY_PROJECT_BROTLI), leer = aus; compressionMinSize / compressionLevel (gzip/deflate) / compressionBrotliQuality
+ * - admission: Lastabwurf vor Auth; "off" (Default), "static" (festes admissionLimit) oder "adaptive"
+ *   (Start bei admissionLimit, zwischen admissionMinLimit und admissionMaxLimit nach Latenz, optional
+ *   admissionTargetLatencyMs); admissionRetryAfterSec für 503; admissionPriorities: Pfad-Präfix → Priorität
+ *   (critical | high | normal | low)
+ * - studentMaxRecords: Obergrenze des StudentRepository (darüber POST /api/students → 507)
+ * - metrics: /metrics "protected" (nur mit Bearer Token, Default), "public" oder "off" (Endpoint nicht registriert)
+ */
+struct ServerConfig {
+  enum class Mode { Threaded, Pool, Async };
+  enum class Timing { Off, OnRequest, Always };
+  enum class Admission { Off, Static, Adaptive };
+  enum class Metrics { Off, Public, Protected };
+
+  Mode mode = Mode::Threaded;
+  std::size_t asyncDataThreads = 0;
+  std::size_t asyncIoThreads = 1;
+  std::size_t asyncTimerThreads = 1;
+  std::size_t poolWorkers = 0;
+  std::size_t poolQueueDepth = 1024;
+  bool poolPinCpus = false;
+  int poolIdleTimeoutMs = 5000;
+  std::string host = "0.0.0.0";
+  std::uint16_t port = 8000;
+  bool dualStack = false;
+  int backlog = 1024;
+  std::size_t acceptors = 1;
+  std::string virtualHost;
+  Timing serverTiming = Timing::Off;
+  std::vector<std::string> compression;
+  std::size_t compressionMinSize = 1024;
+  int compressionLevel = 6;
+  int compressionBrotliQuality = 4;
+  Admission admission = Admission::Off;
+  std::size_t admissionLimit = 256;
+  std::size_t admissionMinLimit = 16;
+  std::size_t admissionMaxLimit = 1024;
+  int admissionTargetLatencyMs = 0;
+  int admissionRetryAfterSec = 1;
+  std::vector<std::pair<std::string, std::string>> admissionPriorities;
+  std::size_t studentMaxRecords = std::size_t(1) << 22;
+  Metrics metrics = Metrics::Protected;
+
+  const char* modeName() const {
+    switch (mode) {
+      case Mode::Pool: return "pool";
+      case Mode::Async: return "async";
+      default: return "threaded";
+    }
+  }
+
+  std::size_t dataThreads() const {
+    return asyncDataThreads > 0 ? asyncDataThreads : std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  std::size_t acceptorCount() const {
+    if (!virtualHost.empty()) return 1;
+    return acceptors > 0 ? acceptors : std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  static std::shared_ptr<ServerConfig> fromEnv() {
+    auto get = [](const char* k, const char* def = "") {
+      const char* v = std::getenv(k);
+      return std::string(v ? v : def);
+    };
+    auto geti = [](const char* k, int def) {
+      const char* v = std::getenv(k);
+      return v ? std::atoi(v) : def;
+    };
+
+    auto c = std::make_shared<ServerConfig>();
+    const auto mode = get("SERVER_MODE", "threaded");
+    if (mode == "async") {
+      c->mode = Mode::Async;
+    } else if (mode == "pool") {
+      c->mode = Mode::Pool;
+    } else if (mode != "threaded") {
+      throw std::runtime_error("SERVER_MODE must be 'threaded', 'pool' or 'async'");
+    }
+    c->asyncDataThreads  = (std::size_t) std::max(0, geti("ASYNC_DATA_THREADS", 0));
+    c->asyncIoThreads    = (std::size_t) std::max(1, geti("ASYNC_IO_THREADS", 1));
+    c->asyncTimerThreads = (std::size_t) std::max(1, geti("ASYNC_TIMER_THREADS", 1));
+    c->poolWorkers       = (std::size_t) std::max(0, geti("SERVER_POOL_WORKERS", 0));
+    c->poolQueueDepth    = (std::size_t) std::max(1, geti("SERVER_POOL_QUEUE_DEPTH", 1024));
+    c->poolPinCpus       = get("SERVER_POOL_PIN_CPUS", "false") == "true";
+    c->poolIdleTimeoutMs = std::max(0, geti("SERVER_POOL_IDLE_TIMEOUT_MS", 5000));
+    c->host              = get("SERVER_HOST", "0.0.0.0");
+    c->port              = (std::uint16_t) std::clamp(geti("SERVER_PORT", 8000), 0, 65535);
+    c->dualStack         = get("SERVER_DUAL_STACK", "false") == "true";
+    c->backlog           = std::max(1, geti("SERVER_BACKLOG", 1024));
+    c->acceptors         = (std::size_t) std::max(0, geti("SERVER_ACCEPTORS", 1));
+    c->virtualHost       = get("SERVER_VIRTUAL_HOST");
+    const auto timing = get("SERVER_TIMING", "off");
+    if (timing == "request") {
+      c->serverTiming = Timing::OnRequest;
+    } else if (timing == "always") {
+      c->serverTiming = Timing::Always;
+    } else if (timing != "off") {
+      throw std::runtime_error("SERVER_TIMING must be 'off', 'request' or 'always'");
+    }
+#ifdef MY_PROJECT_BROTLI
+    const auto encodings = get("COMPRESSION", "br,gzip,deflate");
+#else
+    const auto encodings = get("COMPRESSION", "gzip,deflate");
+#endif
+    if (encodings != "off") {
+      std::size_t pos = 0;
+      while (pos <= encodings.size()) {
+        const auto end = std::min(encodings.find(',', pos), encodings.size());
+        const auto e = encodings.substr(pos, end - pos);
+        pos = end + 1;
+        if (e.empty()) continue;
+#ifndef MY_PROJECT_BROTLI
+        if (e == "br") throw std::runtime_error("COMPRESSION=br needs a build with brotli (MY_PROJECT_BROTLI)");
+#endif
+        if (e != "br" && e != "gzip" && e != "deflate") {
+          throw std::runtime_error("COMPRESSION must be 'off' or a list of 'br', 'gzip', 'deflate'");
+        }
+        c->compression.push_back(e);
+      }
+    }
+    c->compressionMinSize       = (std::size_t) std::max(0, geti("COMPRESSION_MIN_SIZE", 1024));
+    c->compressionLevel         = std::clamp(geti("COMPRESSION_LEVEL", 6), 1, 9);
+    c->compressionBrotliQuality = std::clamp(geti("COMPRESSION_BROTLI_QUALITY", 4), 0, 11);
+    const auto admission = get("ADMISSION", "off");
+    if (admission == "static") {
+      c->admission = Admission::Static;
+    } else if (admission == "adaptive") {
+      c->admission = Admission::Adaptive;
+    } else if (admission != "off") {
+      throw std::runtime_error("ADMISSION must be 'off', 'static' or 'adaptive'");
+    }
+    c->admissionMinLimit        = (std::size_t) std::max(1, geti("ADMISSION_MIN_LIMIT", 16));
+    c->admissionMaxLimit        = std::max(c->admissionMinLimit, (std::size_t) std::max(1, geti("ADMISSION_MAX_LIMIT", 1024)));
+    c->admissionLimit           = (std::size_t) std::max(1, geti("ADMISSION_LIMIT", 256));
+    c->admissionTargetLatencyMs = std::max(0, geti("ADMISSION_TARGET_LATENCY_MS", 0));
+    c->admissionRetryAfterSec   = std::max(1, geti("ADMISSION_RETRY_AFTER_S", 1));
+    // "/metrics=critical,/api/public/=low"
+    const auto priorities = get("ADMISSION_PRIORITIES", "/metrics=critical");
+    std::size_t at = 0;
+    while (at < priorities.size()) {
+      const auto end = std::min(priorities.find(',', at), priorities.size());
+      const auto entry = priorities.substr(at, end - at);
+      at = end + 1;
+      if (entry.empty()) continue;
+      const auto eq = entry.find('=');
+      const auto level = eq == std::string::npos ? std::string() : entry.substr(eq + 1);
+      if (eq == 0 || (level != "critical" && level != "high" && level != "normal" && level != "low")) {
+        throw std::runtime_error("ADMISSION_PRIORITIES entries must be '<path prefix>=critical|high|normal|low'");
+      }
+      c->admissionPriorities.emplace_back(entry.substr(0, eq), level);
+    }
+    c->studentMaxRecords = (std::size_t) std::max(1, geti("STUDENT_MAX_RECORDS", 1 << 22));
+    const auto metrics = get("METRICS", "protected");
+    if (metrics == "public") {
+      c->metrics = Metrics::Public;
+    } else if (metrics == "off") {
+      c->metrics = Metrics::Off;
+    } else if (metrics != "protected") {
+      throw std::runtime_error("METRICS must be 'protected', 'public' or 'off'");
+    }
+    return c;
+  }
+};
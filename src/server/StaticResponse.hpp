@@ -0,0 +1,34 @@
+#pragma once
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+#include "oatpp/web/protocol/http/outgoing/Response.hpp"
+#include "oatpp/data/mapping/ObjectMapper.hpp"
+
+/**
+ * StaticResponse
+ * - Antwort, deren Body sich nie ändert: DTO wird einmal beim Start (Controller-Konstruktor) serialisiert
+ * - respond() teilt den unveränderlichen Puffer (oatpp::String ist ein shared_ptr) → pro Request weder
+ *   DTO-Aufbau noch Serialisierung noch Kopie, nur das Response-Objekt selbst (Interceptors dürfen Header setzen)
+ */
+class StaticResponse {
+  using Status = oatpp::web::protocol::http::Status;
+  using Response = oatpp::web::protocol::http::outgoing::Response;
+  using BufferBody = oatpp::web::protocol::http::outgoing::BufferBody;
+
+  Status status_;
+  oatpp::String body_;
+  oatpp::String contentType_;
+
+public:
+  StaticResponse(const Status& status, const oatpp::Void& dto,
+                 const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& mapper)
+    : status_(status)
+    , body_(mapper->writeToString(dto))
+    , contentType_(mapper->getInfo().httpContentType)
+  {}
+
+  std::shared_ptr<Response> respond() const {
+    return Response::createShared(status_, BufferBody::createShared(body_, contentType_));
+  }
+
+  const oatpp::String& body() const noexcept { return body_; }
+};
@@ -0,0 +1,247 @@
+#pragma once
+#include "oatpp/web/server/HttpProcessor.hpp"
+#include "oatpp/web/server/HttpRouter.hpp"
+#include "oatpp/network/ConnectionHandler.hpp"
+#include "oatpp/network/tcp/Connection.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+/**
+ * WorkerPoolConnectionHandler
+ * - Alternative zu HttpConnectionHandler (ein Thread pro Verbindung): feste Anzahl Worker-Threads,
+ *   angenommene Verbindungen landen in einer begrenzten Queue
+ * - ein Worker bedient eine Verbindung bis zu deren Ende (HttpProcessor::Task, synchrone ENDPOINTs
+ *   bleiben unverändert); idleTimeoutMs gibt Worker frei, wenn ein Keep-Alive-Client schweigt
+ *   (SO_RCVTIMEO; ein abgelaufenes Lesen beendet die Verbindung statt als RETRY_READ erneut zu lesen)
+ * - Queue voll → sofort 503 + Connection: close (kein unbegrenztes Wachstum unter Last); der Acceptor schreibt
+ *   die Antwort nicht-blockierend mit einem einzigen Versuch und schließt, ein langsamer Client hält ihn nicht auf
+ * - optional CPU-Pinning: Worker i läuft auf Kern i % Kerne
+ * - Interceptors wie bei HttpConnectionHandler über addRequestInterceptor/addResponseInterceptor
+ */
+class WorkerPoolConnectionHandler
+  : public oatpp::network::ConnectionHandler
+  , public oatpp::web::server::HttpProcessor::TaskProcessingListener
+{
+public:
+  using Connection = oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>;
+
+  struct Config {
+    std::size_t workers = 0;      // 0 = 4 × CPU-Kerne
+    std::size_t queueDepth = 1024;
+    bool pinCpus = false;
+    int idleTimeoutMs = 5000;     // 0 = aus
+  };
+
+private:
+
+  /*
+   * tcp::Connection mit SO_RCVTIMEO: oatpp meldet den Timeout (EAGAIN im Blocking-Modus) als RETRY_READ,
+   * worauf HttpProcessor sofort wieder liest - der Worker käme nie frei. Hier wird daraus ein Verbindungsende.
+   */
+  class IdleTimeoutStream : public oatpp::data::stream::IOStream {
+  private:
+    Connection m_inner;
+  public:
+    explicit IdleTimeoutStream(Connection inner) : m_inner(std::move(inner)) {}
+
+    const Connection& inner() const noexcept { return m_inner; }
+
+    oatpp::v_io_size write(const void* data, v_buff_size count, oatpp::async::Action& action) override {
+      return m_inner.object->write(data, count, action);
+    }
+
+    oatpp::v_io_size read(void* buffer, v_buff_size count, oatpp::async::Action& action) override {
+      const auto result = m_inner.object->read(buffer, count, action);
+      if (result == oatpp::IOError::RETRY_READ && (errno == EAGAIN || errno == EWOULDBLOCK)
+          && m_inner.object->getInputStreamIOMode() == oatpp::data::stream::IOMode::BLOCKING) {
+        return oatpp::IOError::BROKEN_PIPE; // Idle-Timeout
+      }
+      return result;
+    }
+
+    void setOutputStreamIOMode(oatpp::data::stream::IOMode mode) override { m_inner.object->setOutputStreamIOMode(mode); }
+    oatpp::data::stream::IOMode getOutputStreamIOMode() override { return m_inner.object->getOutputStreamIOMode(); }
+    oatpp::data::stream::Context& getOutputStreamContext() override { return m_inner.object->getOutputStreamContext(); }
+
+    void setInputStreamIOMode(oatpp::data::stream::IOMode mode) override { m_inner.object->setInputStreamIOMode(mode); }
+    oatpp::data::stream::IOMode getInputStreamIOMode() override { return m_inner.object->getInputStreamIOMode(); }
+    oatpp::data::stream::Context& getInputStreamContext() override { return m_inner.object->getInputStreamContext(); }
+  };
+
+  class IdleTimeoutInvalidator : public oatpp::provider::Invalidator<oatpp::data::stream::IOStream> {
+  public:
+    void invalidate(const std::shared_ptr<oatpp::data::stream::IOStream>& connection) override {
+      const auto& inner = std::static_pointer_cast<IdleTimeoutStream>(connection)->inner();
+      inner.invalidator->invalidate(inner.object);
+    }
+  };
+
+  std::shared_ptr<oatpp::web::server::HttpProcessor::Components> m_components;
+  Config m_config;
+  std::shared_ptr<IdleTimeoutInvalidator> m_idleInvalidator;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<Connection> m_queue;
+  bool m_stopping = false;
+
+  std::mutex m_activeMutex;
+  std::vector<Connection> m_activeHandles; // Verbindungen, die gerade ein Worker hält (für stop())
+
+  std::vector<std::thread> m_workers;
+  std::atomic<std::uint64_t> m_rejected{0};
+
+  static void pinToCpu(std::size_t index) {
+#ifdef __linux__
+    const auto cores = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET((int) (index % cores), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set); // Fehler → ungepinnt weiterlaufen
+#else
+    (void) index;
+#endif
+  }
+
+  Connection withIdleTimeout(const Connection& connection) const {
+    if (m_config.idleTimeoutMs <= 0) return connection;
+    auto tcp = std::dynamic_pointer_cast<oatpp::network::tcp::Connection>(connection.object);
+    if (!tcp) return connection;
+    timeval tv{};
+    tv.tv_sec = m_config.idleTimeoutMs / 1000;
+    tv.tv_usec = (m_config.idleTimeoutMs % 1000) * 1000;
+    if (::setsockopt(tcp->getHandle(), SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) != 0) return connection;
+    return Connection(std::make_shared<IdleTimeoutStream>(connection), m_idleInvalidator);
+  }
+
+  static void reject(const Connection& connection) {
+    static constexpr char response[] =
+      "HTTP/1.1 503 Service Unavailable\r\n"
+      "Retry-After: 1\r\n"
+      "Content-Length: 0\r\n"
+      "Connection: close\r\n\r\n";
+    // läuft auf dem Acceptor-Thread: ein nicht-blockierender Versuch (passt in den leeren Sendepuffer), dann zu
+    connection.object->setOutputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+    connection.object->writeSimple(response, sizeof(response) - 1);
+    connection.invalidator->invalidate(connection.object);
+  }
+
+  void workerLoop(std::size_t index) {
+    if (m_config.pinCpus) pinToCpu(index);
+    for (;;) {
+      Connection connection(nullptr);
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+        if (m_stopping) return;
+        connection = std::move(m_queue.front());
+        m_queue.pop_front();
+      }
+      oatpp::web::server::HttpProcessor::Task(m_components, withIdleTimeout(connection), this).run();
+    }
+  }
+
+public:
+
+  WorkerPoolConnectionHandler(const std::shared_ptr<oatpp::web::server::HttpRouter>& router, const Config& config)
+    : m_components(std::make_shared<oatpp::web::server::HttpProcessor::Components>(router))
+    , m_config(config)
+    , m_idleInvalidator(std::make_shared<IdleTimeoutInvalidator>())
+  {
+    const auto cores = std::max(1u, std::thread::hardware_concurrency());
+    const auto workers = m_config.workers > 0 ? m_config.workers : 4 * (std::size_t) cores;
+    m_config.queueDepth = std::max<std::size_t>(1, m_config.queueDepth);
+    m_workers.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) {
+      m_workers.emplace_back([this, i] { workerLoop(i); });
+    }
+  }
+
+  static std::shared_ptr<WorkerPoolConnectionHandler>
+  createShared(const std::shared_ptr<oatpp::web::server::HttpRouter>& router, const Config& config) {
+    return std::make_shared<WorkerPoolConnectionHandler>(router, config);
+  }
+
+  ~WorkerPoolConnectionHandler() override {
+    stop();
+  }
+
+  void addRequestInterceptor(const std::shared_ptr<oatpp::web::server::interceptor::RequestInterceptor>& interceptor) {
+    m_components->requestInterceptors.push_back(interceptor);
+  }
+
+  void addResponseInterceptor(const std::shared_ptr<oatpp::web::server::interceptor::ResponseInterceptor>& interceptor) {
+    m_components->responseInterceptors.push_back(interceptor);
+  }
+
+  std::size_t workers() const noexcept { return m_workers.size(); }
+
+  std::uint64_t rejectedConnections() const noexcept { return m_rejected.load(std::memory_order_relaxed); }
+
+  void handleConnection(const Connection& connection,
+                        const std::shared_ptr<const ParameterMap>& params) override {
+    (void) params;
+    connection.object->setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+    connection.object->setInputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_stopping && m_queue.size() < m_config.queueDepth) {
+        m_queue.push_back(connection);
+        m_cv.notify_one();
+        return;
+      }
+    }
+    ++m_rejected;
+    reject(connection);
+  }
+
+  void onTaskStart(const Connection& connection) override {
+    std::lock_guard<std::mutex> lock(m_activeMutex);
+    m_activeHandles.push_back(connection);
+  }
+
+  void onTaskEnd(const Connection& connection) override {
+    std::lock_guard<std::mutex> lock(m_activeMutex);
+    for (auto it = m_activeHandles.begin(); it != m_activeHandles.end(); ++it) {
+      if (it->object == connection.object) {
+        *it = std::move(m_activeHandles.back());
+        m_activeHandles.pop_back();
+        break;
+      }
+    }
+  }
+
+  /**
+   * Nimmt nichts mehr an, schließt wartende und laufende Verbindungen, wartet auf alle Worker.
+   */
+  void stop() override {
+    std::deque<Connection> queued;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_stopping) return;
+      m_stopping = true;
+      queued.swap(m_queue);
+    }
+    m_cv.notify_all();
+    for (auto& c : queued) c.invalidator->invalidate(c.object);
+    {
+      std::lock_guard<std::mutex> lock(m_activeMutex);
+      for (auto& c : m_activeHandles) c.invalidator->invalidate(c.object);
+    }
+    for (auto& w : m_workers) {
+      if (w.joinable()) w.join();
+    }
+  }
+};
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * ScratchArena
+ * - Bump-Allocator für Zwischenergebnisse eines Requests: std::pmr::vector/string mit &arena anlegen
+ * - die ersten Bytes liegen im Objekt selbst (auf dem Stack des Handlers) → kein malloc, solange Bytes reicht;
+ *   darüber holt monotonic_buffer_resource weitere Blöcke vom Upstream (Default: Heap)
+ * - deallocate ist ein No-op, alles wird mit dem Destruktor (Ende des Requests) auf einmal frei
+ * - nicht thread-sicher, nicht zwischen Requests teilen; Container müssen vor der Arena enden
+ */
+template<std::size_t Bytes>
+class ScratchArena : public std::pmr::monotonic_buffer_resource {
+  // Basisklasse merkt sich nur die Adresse, der Puffer wird erst beim ersten allocate beschrieben
+  alignas(std::max_align_t) std::byte buffer_[Bytes];
+
+public:
+  explicit ScratchArena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+    : std::pmr::monotonic_buffer_resource(buffer_, Bytes, upstream)
+  {}
+
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+
+  static constexpr std::size_t inlineBytes() noexcept { return Bytes; }
+};
@@ -0,0 +1,110 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * WorkerPool
+ * - feste Anzahl Threads, gestartet im Konstruktor, beendet im Destruktor
+ * - parallelFor(n, fn): fn(0..n-1) verteilt auf Pool + aufrufenden Thread, blockiert bis alle fertig
+ * - der Aufrufer arbeitet selbst mit, ist der Pool ausgelastet läuft alles im Aufrufer (kein Deadlock)
+ * - fn darf nicht werfen (Fehler pro Index selbst abfangen)
+ */
+class WorkerPool {
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> jobs_;
+  std::vector<std::thread> threads_;
+  bool stopping_ = false;
+
+  void workerLoop() {
+    for (;;) {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+        if (jobs_.empty()) return; // stopping_
+        job = std::move(jobs_.front());
+        jobs_.pop_front();
+      }
+      job();
+    }
+  }
+
+  /*
+   * Gemeinsamer Zustand eines parallelFor. Helfer, die erst nach dem Ende starten,
+   * finden next >= n vor und rühren fn nicht mehr an (fn lebt nur bis zur Rückkehr des Aufrufers).
+   */
+  struct ForState {
+    std::size_t n;
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> done{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+    const std::function<void(std::size_t)>* fn;
+
+    void work() {
+      std::size_t finished = 0;
+      for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < n; ++finished) {
+        (*fn)(i);
+      }
+      if (finished > 0 && done.fetch_add(finished, std::memory_order_acq_rel) + finished == n) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_all();
+      }
+    }
+  };
+
+public:
+  explicit WorkerPool(std::size_t threads = std::thread::hardware_concurrency()) {
+    threads = std::max<std::size_t>(1, threads);
+    threads_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+      threads_.emplace_back([this] { workerLoop(); });
+    }
+  }
+
+  ~WorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto& t : threads_) t.join();
+  }
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  std::size_t size() const noexcept { return threads_.size(); }
+
+  void parallelFor(std::size_t n, const std::function<void(std::size_t)>& fn) {
+    if (n == 0) return;
+    if (n == 1) { fn(0); return; }
+
+    auto state = std::make_shared<ForState>();
+    state->n = n;
+    state->fn = &fn;
+
+    const auto helpers = std::min(n - 1, threads_.size());
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (std::size_t i = 0; i < helpers; ++i) {
+        jobs_.emplace_back([state] { state->work(); });
+      }
+    }
+    if (helpers == 1) cv_.notify_one(); else cv_.notify_all();
+
+    state->work();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&] { return state->done.load(std::memory_order_acquire) == n; });
+  }
+};
@@ -0,0 +1,87 @@
+#include "AcceptorTest.hpp"
+
+#include "server/MultiAcceptorServer.hpp"
+#include "server/ReusePortConnectionProvider.hpp"
+#include "app/RawHttpClient.hpp"
+
+#include "oatpp/web/server/HttpConnectionHandler.hpp"
+#include "oatpp/network/virtual_/server/ConnectionProvider.hpp"
+
+#include <string>
+#include <thread>
+
+void AcceptorTest::onRun() {
+  testShardsShareKernelPort();
+  testWrongProviderFailsLoudly();
+}
+
+/**
+ * Test 1: Port 0 → vom Kernel vergebener Port wird gelesen, alle Shards binden ihn und nehmen Verbindungen an
+ */
+void AcceptorTest::testShardsShareKernelPort() {
+  ServerConfig cfg;
+  cfg.host = "127.0.0.1";
+  cfg.port = 0;
+  cfg.acceptors = 3;
+
+  auto first = ReusePortConnectionProvider::createShared(cfg);
+  OATPP_ASSERT(first->port() != 0);
+  OATPP_ASSERT(first->getProperty("port").toString() == std::to_string(first->port()));
+
+  auto providers = ReusePortConnectionProvider::withShards(cfg, first);
+  OATPP_ASSERT(providers.size() == 3);
+  for (const auto& p : providers) {
+    OATPP_ASSERT(p->getProperty("port").toString() == std::to_string(first->port()));
+  }
+
+  // leerer Router → 404, es geht nur darum, dass jede Verbindung von irgendeinem Shard bedient wird
+  auto handler = oatpp::web::server::HttpConnectionHandler::createShared(oatpp::web::server::HttpRouter::createShared());
+  MultiAcceptorServer server(providers, handler);
+  std::thread thread([&server] { server.run(); });
+
+  for (int i = 0; i < 24; ++i) {
+    RawHttpClient client(first->port());
+    OATPP_ASSERT(client.sendGet("/"));
+    OATPP_ASSERT(RawHttpClient::hasStatus(client.readResponse(), "404"));
+  }
+
+  server.stop();
+  handler->stop();
+  thread.join();
+}
+
+/**
+ * Test 2: mehrere Acceptors mit einem anderen Provider → Exception statt undefiniertem Cast;
+ *         zweiter Socket ohne SO_REUSEPORT auf belegtem Port → bind()-Fehler
+ */
+void AcceptorTest::testWrongProviderFailsLoudly() {
+  ServerConfig cfg;
+  cfg.acceptors = 2;
+  auto iface = oatpp::network::virtual_::Interface::obtainShared("acceptor-test");
+  std::shared_ptr<oatpp::network::ServerConnectionProvider> virtualProvider =
+    oatpp::network::virtual_::server::ConnectionProvider::createShared(iface);
+
+  bool thrown = false;
+  try {
+    ReusePortConnectionProvider::withShards(cfg, virtualProvider);
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  OATPP_ASSERT(thrown);
+
+  cfg.acceptors = 1;
+  OATPP_ASSERT(ReusePortConnectionProvider::withShards(cfg, virtualProvider).size() == 1);
+  virtualProvider->stop();
+
+  ServerConfig tcp;
+  tcp.host = "127.0.0.1";
+  tcp.port = 0;
+  ReusePortConnectionProvider exclusive(tcp, 0, false);
+  thrown = false;
+  try {
+    ReusePortConnectionProvider second(tcp, exclusive.port(), false);
+  } catch (const std::runtime_error& e) {
+    thrown = std::string(e.what()).find("bind()") != std::string::npos;
+  }
+  OATPP_ASSERT(thrown);
+}
@@ -0,0 +1,17 @@
+#ifndef AcceptorTest_hpp
+#define AcceptorTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class AcceptorTest : public oatpp::test::UnitTest {
+public:
+  AcceptorTest() : UnitTest("TEST[AcceptorTest]") {}
+
+  void onRun() override;
+
+private:
+  void testShardsShareKernelPort();
+  void testWrongProviderFailsLoudly();
+};
+
+#endif // AcceptorTest_hpp
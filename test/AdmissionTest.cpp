@@ -0,0 +1,152 @@
+#include "AdmissionTest.hpp"
+
+#include "server/AdmissionController.hpp"
+#include "app/TestRequest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using Priority = AdmissionController::Priority;
+
+std::shared_ptr<oatpp::web::protocol::http::outgoing::Response> ok() {
+  using namespace oatpp::web::protocol::http;
+  return outgoing::ResponseFactory::createResponse(Status::CODE_200, "ok");
+}
+
+/**
+ * Synthetische Last: pro Fenster `samples` Requests mit `latencyNs`, Auslastung `inflight`.
+ */
+void drive(AdaptiveLimit& limit, AdaptiveLimit::Clock::time_point& t, int windows,
+           std::int64_t latencyNs, bool saturated) {
+  for (int w = 0; w < windows; ++w) {
+    t += std::chrono::milliseconds(101);
+    for (int i = 0; i < 64; ++i) {
+      limit.onAdmit(saturated ? limit.limit() : 1);
+      limit.observe(latencyNs, t);
+    }
+  }
+}
+
+}
+
+void AdmissionTest::onRun() {
+  testStaticLimitAndPriorities();
+  testAdaptiveLimit();
+  testSmallLimit();
+}
+
+/**
+ * Test 1: festes Limit 10; low ab 60 %, normal ab 90 %, critical nie; 503 + Retry-After, Slot nach Response frei
+ */
+void AdmissionTest::testStaticLimitAndPriorities() {
+  AdmissionController::Options options;
+  options.adaptive = false;
+  options.limit.initial = 10;
+  options.retryAfterSec = 2;
+  options.routes = {{"/metrics", Priority::Critical}, {"/api/admin/", Priority::High}, {"/api/public/", Priority::Low}};
+  AdmissionController admission(options);
+
+  OATPP_ASSERT(admission.priorityOf("/metrics") == Priority::Critical);
+  OATPP_ASSERT(admission.priorityOf("/api/public/ping?x=1") == Priority::Low);
+  OATPP_ASSERT(admission.priorityOf("/api/admin/x") == Priority::High);
+  OATPP_ASSERT(admission.priorityOf("/api/secure/ping") == Priority::Normal);
+
+  // 6 low zugelassen, der 7. abgelehnt (60 % von 10)
+  std::vector<std::shared_ptr<oatpp::web::protocol::http::incoming::Request>> held;
+  for (int i = 0; i < 6; ++i) {
+    held.push_back(makeRequest("GET", "/api/public/ping"));
+    OATPP_ASSERT(admission.intercept(held.back()) == nullptr);
+  }
+  auto low = makeRequest("GET", "/api/public/ping");
+  auto shed = admission.intercept(low);
+  OATPP_ASSERT(shed && shed->getStatus().code == 503);
+  OATPP_ASSERT(shed->getHeader("Retry-After") == "2");
+  OATPP_ASSERT(admission.intercept(low, shed) == shed); // abgelehnte Requests geben keinen Slot frei
+  OATPP_ASSERT(admission.inflight() == 6);
+
+  // normal bis 9, high bis 10, critical darüber hinaus
+  for (int i = 0; i < 3; ++i) {
+    held.push_back(makeRequest("GET", "/api/secure/ping"));
+    OATPP_ASSERT(admission.intercept(held.back()) == nullptr);
+  }
+  OATPP_ASSERT(admission.intercept(makeRequest("GET", "/api/secure/ping"))->getStatus().code == 503);
+  held.push_back(makeRequest("GET", "/api/admin/x"));
+  OATPP_ASSERT(admission.intercept(held.back()) == nullptr);
+  OATPP_ASSERT(admission.intercept(makeRequest("GET", "/api/admin/x"))->getStatus().code == 503);
+  auto metrics = makeRequest("GET", "/metrics");
+  OATPP_ASSERT(admission.intercept(metrics) == nullptr);
+  OATPP_ASSERT(admission.inflight() == 11);
+  admission.intercept(metrics, ok());
+
+  // Antworten geben Slots frei → wieder Platz für normal
+  admission.intercept(held[0], ok());
+  admission.intercept(held[1], ok());
+  OATPP_ASSERT(admission.inflight() == 8);
+  auto again = makeRequest("GET", "/api/secure/ping");
+  OATPP_ASSERT(admission.intercept(again) == nullptr);
+  admission.intercept(again, ok());
+
+  OATPP_ASSERT(admission.rejectedCount(Priority::Low) == 1);
+  OATPP_ASSERT(admission.rejectedCount(Priority::Normal) == 1);
+  OATPP_ASSERT(admission.rejectedCount(Priority::High) == 1);
+  OATPP_ASSERT(admission.rejectedCount(Priority::Critical) == 0);
+  OATPP_ASSERT(admission.admittedCount(Priority::Normal) == 4);
+}
+
+/**
+ * Test 2: adaptives Limit wächst bei stabiler Latenz unter Vollast, schrumpft bei Stau, wächst nicht ohne Last
+ */
+void AdmissionTest::testAdaptiveLimit() {
+  AdaptiveLimit::Options options;
+  options.initial = 100;
+  options.min = 10;
+  options.max = 1000;
+  AdaptiveLimit limit(options);
+  auto t = AdaptiveLimit::Clock::now();
+
+  drive(limit, t, 20, 1'000'000, true);
+  const auto grown = limit.limit();
+  OATPP_ASSERT(grown > 100);
+
+  drive(limit, t, 10, 8'000'000, true); // Latenz ×8: Requests stauen sich
+  const auto shrunk = limit.limit();
+  OATPP_ASSERT(shrunk < grown);
+
+  drive(limit, t, 20, 1'000'000, false); // kaum Last: kein Wachstum
+  OATPP_ASSERT(limit.limit() <= shrunk + 1);
+
+  options.targetNs = 2'000'000; // Zielwert drückt zusätzlich
+  AdaptiveLimit capped(options);
+  drive(capped, t, 20, 4'000'000, true);
+  OATPP_ASSERT(capped.limit() < 100);
+
+  std::cout << "adaptive limit: grown=" << grown << " shrunk=" << shrunk << " capped=" << capped.limit() << std::endl;
+}
+
+/**
+ * Test 3: kleines Limit - jede Priorität bekommt mindestens einen Slot
+ */
+void AdmissionTest::testSmallLimit() {
+  AdmissionController::Options options;
+  options.adaptive = false;
+  options.limit.initial = 1;
+  options.routes = {{"/api/public/", Priority::Low}};
+  AdmissionController admission(options);
+
+  auto low = makeRequest("GET", "/api/public/ping");
+  OATPP_ASSERT(admission.intercept(low) == nullptr); // 60 % von 1 → trotzdem ein Slot
+  OATPP_ASSERT(admission.intercept(makeRequest("GET", "/api/public/ping"))->getStatus().code == 503);
+  OATPP_ASSERT(admission.intercept(makeRequest("GET", "/api/secure/ping"))->getStatus().code == 503);
+  admission.intercept(low, ok());
+
+  auto normal = makeRequest("GET", "/api/secure/ping");
+  OATPP_ASSERT(admission.intercept(normal) == nullptr);
+  admission.intercept(normal, ok());
+  OATPP_ASSERT(admission.inflight() == 0);
+  OATPP_ASSERT(admission.admittedCount(Priority::Low) == 1);
+  OATPP_ASSERT(admission.rejectedCount(Priority::Low) == 1);
+}
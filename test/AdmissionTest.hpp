@@ -0,0 +1,18 @@
+#ifndef AdmissionTest_hpp
+#define AdmissionTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class AdmissionTest : public oatpp::test::UnitTest {
+public:
+  AdmissionTest() : UnitTest("TEST[AdmissionTest]") {}
+
+  void onRun() override;
+
+private:
+  void testStaticLimitAndPriorities();
+  void testAdaptiveLimit();
+  void testSmallLimit();
+};
+
+#endif // AdmissionTest_hpp
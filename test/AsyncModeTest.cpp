@@ -0,0 +1,119 @@
+#include "AsyncModeTest.hpp"
+
+#include "AppComponent.hpp"
+#include "AppControllers.hpp"
+
+#include "app/JwksStandIn.hpp"
+#include "app/MyApiTestClient.hpp"
+#include "app/TestKeys.hpp"
+
+#include "oatpp/network/virtual_/client/ConnectionProvider.hpp"
+#include "oatpp/network/Server.hpp"
+#include "oatpp/web/client/HttpRequestExecutor.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+
+constexpr const char* kVirtualHost = "async-mode-test";
+
+/**
+ * ENV für AppComponent (SERVER_MODE=async auf einem virtuellen Interface), beim Verlassen wieder entfernt.
+ */
+class AsyncEnv {
+private:
+  static constexpr const char* kNames[] = {
+    "KEYCLOAK_ISSUER", "KEYCLOAK_JWKS_URL", "KEYCLOAK_AUDIENCE", "SECURE_PATH_PREFIXES",
+    "SERVER_MODE", "SERVER_VIRTUAL_HOST", "ASYNC_DATA_THREADS"
+  };
+public:
+
+  explicit AsyncEnv(const AuthConfig& cfg) {
+    setenv("KEYCLOAK_ISSUER", cfg.issuer.c_str(), 1);
+    setenv("KEYCLOAK_JWKS_URL", cfg.jwksUrl.c_str(), 1);
+    setenv("KEYCLOAK_AUDIENCE", cfg.audience.c_str(), 1);
+    setenv("SECURE_PATH_PREFIXES", "/api/secure/", 1);
+    setenv("SERVER_MODE", "async", 1);
+    setenv("SERVER_VIRTUAL_HOST", kVirtualHost, 1);
+    setenv("ASYNC_DATA_THREADS", "2", 1);
+  }
+
+  ~AsyncEnv() {
+    for (const auto* name : kNames) unsetenv(name);
+  }
+
+};
+
+}
+
+void AsyncModeTest::onRun() {
+  testAuthenticatedRequest();
+}
+
+/**
+ * Test 1: AppComponent im Async-Modus - Async-Controller, AsyncAuthInterceptor, AsyncHttpConnectionHandler;
+ *         Request mit gültigem Token → 200, ohne/mit gefälschtem Token → 401
+ */
+void AsyncModeTest::testAuthenticatedRequest() {
+  TestKeys keys;
+  JwksStandIn idp(keys.jwks());
+  const auto authCfg = TestKeys::config(idp.url());
+  AsyncEnv env(*authCfg);
+  const oatpp::String token = "Bearer " + keys.sign(*authCfg, "async-user");
+
+  AppComponent components;
+  addAppControllers();
+
+  OATPP_COMPONENT(std::shared_ptr<ServerConfig>, serverConfig);
+  OATPP_COMPONENT(std::shared_ptr<oatpp::network::ServerConnectionProvider>, serverProvider);
+  OATPP_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, connectionHandler);
+  OATPP_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, mappers);
+  OATPP_COMPONENT(std::shared_ptr<oatpp::async::Executor>, executor);
+
+  OATPP_ASSERT(serverConfig->mode == ServerConfig::Mode::Async);
+  const auto& inner = std::static_pointer_cast<ConnectionMetricsHandler>(connectionHandler)->inner();
+  OATPP_ASSERT(std::dynamic_pointer_cast<oatpp::web::server::AsyncHttpConnectionHandler>(inner));
+
+  oatpp::network::Server server(serverProvider, connectionHandler);
+  std::thread serverThread([&server] { server.run(); });
+
+  {
+    auto clientProvider = oatpp::network::virtual_::client::ConnectionProvider::createShared(
+      oatpp::network::virtual_::Interface::obtainShared(kVirtualHost));
+    const auto mapper = mappers->getMapper("application/json");
+    auto client = MyApiTestClient::createShared(oatpp::web::client::HttpRequestExecutor::createShared(clientProvider), mapper);
+
+    // bis der Refresher den JWKS geladen hat, antwortet der Async-Interceptor mit 503
+    auto secure = client->getSecurePing(token);
+    for (int i = 0; i < 500 && secure->getStatusCode() == 503; ++i) {
+      secure->readBodyToString();
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      secure = client->getSecurePing(token);
+    }
+    OATPP_ASSERT(secure->getStatusCode() == 200);
+    const auto hello = secure->readBodyToDto<oatpp::Object<MyDto>>(mapper);
+    OATPP_ASSERT(hello && hello->message == "Hello World!");
+
+    auto anonymous = client->getSecurePingAnonymous();
+    OATPP_ASSERT(anonymous->getStatusCode() == 401);
+    anonymous->readBodyToString();
+
+    auto forged = client->getSecurePing("Bearer not-a-jwt");
+    OATPP_ASSERT(forged->getStatusCode() == 401);
+    forged->readBodyToString();
+
+    auto pub = client->getPublicPing();
+    OATPP_ASSERT(pub->getStatusCode() == 200);
+    pub->readBodyToString();
+  }
+
+  server.stop();
+  serverProvider->stop();
+  connectionHandler->stop();
+  serverThread.join();
+  executor->waitTasksFinished();
+  executor->stop();
+  executor->join();
+}
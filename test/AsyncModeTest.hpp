@@ -0,0 +1,16 @@
+#ifndef AsyncModeTest_hpp
+#define AsyncModeTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class AsyncModeTest : public oatpp::test::UnitTest {
+public:
+  AsyncModeTest() : UnitTest("TEST[AsyncModeTest]") {}
+
+  void onRun() override;
+
+private:
+  void testAuthenticatedRequest();
+};
+
+#endif // AsyncModeTest_hpp
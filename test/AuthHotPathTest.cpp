@@ -0,0 +1,92 @@
+#include "AuthHotPathTest.hpp"
+
+#include "auth/AuthInterceptor.hpp"
+#include "app/AllocationCounter.hpp"
+#include "app/TestKeys.hpp"
+#include "app/TestRequest.hpp"
+
+#include <iostream>
+
+void AuthHotPathTest::onRun() {
+  testExtractBearer();
+  testNoAllocationsAfterWarmup();
+  testInterceptNoAllocations();
+}
+
+/**
+ * Test 1: Bearer-Token aus dem Authorization-Header schneiden
+ */
+void AuthHotPathTest::testExtractBearer() {
+  OATPP_ASSERT(AuthInterceptor::extractBearer("Bearer abc.def.ghi") == "abc.def.ghi");
+  OATPP_ASSERT(AuthInterceptor::extractBearer("bEaReR  abc ") == "abc");
+  OATPP_ASSERT(AuthInterceptor::extractBearer("Basic dXNlcjpwdw==").empty());
+  OATPP_ASSERT(AuthInterceptor::extractBearer("Bearer").empty());
+  OATPP_ASSERT(AuthInterceptor::extractBearer("Bearerabc").empty());
+  OATPP_ASSERT(AuthInterceptor::extractBearer("").empty());
+}
+
+/**
+ * Test 2: Header → Token-View → verify (Cache-Treffer) ohne eine einzige Allokation
+ */
+void AuthHotPathTest::testNoAllocationsAfterWarmup() {
+  TestKeys keys;
+  auto cfg = TestKeys::config();
+
+  JwtVerifier verifier(cfg);
+  verifier.jwks().load(keys.jwks(), 15);
+
+  const std::string header = "Bearer " + keys.sign(*cfg, "alice");
+
+  // Warmup: erster Aufruf verifiziert die Signatur und füllt den TokenCache
+  auto warm = verifier.verify(AuthInterceptor::extractBearer(header));
+  OATPP_ASSERT(warm->subject == "alice");
+
+  const auto before = AllocationCounter::threadAllocations();
+  for (int i = 0; i < 1000; ++i) {
+    const auto tok = AuthInterceptor::extractBearer(header);
+    const auto claims = verifier.verify(tok);
+    OATPP_ASSERT(claims == warm);
+  }
+  const auto allocations = AllocationCounter::threadAllocations() - before;
+
+  std::cout << "Allokationen auf dem Happy Path: " << allocations << std::endl;
+  OATPP_ASSERT(allocations == 0);
+}
+
+/**
+ * Test 3: derselbe Happy Path über AuthInterceptor::intercept - Pfad-Trie, Header-Map, Cache-Treffer, Zähler
+ */
+void AuthHotPathTest::testInterceptNoAllocations() {
+  TestKeys keys;
+  auto cfg = TestKeys::config();
+  auto verifier = std::make_shared<JwtVerifier>(cfg);
+  verifier->jwks().load(keys.jwks(), 15);
+  AuthInterceptor auth(verifier);
+
+  const auto request = makeRequest("GET", "/api/secure/ping", {
+    {"Accept", "application/json"},
+    {"Authorization", oatpp::String("Bearer " + keys.sign(*cfg, "alice"))}
+  });
+  OATPP_ASSERT(auth.intercept(request) == nullptr); // Warmup: Signatur prüfen, TokenCache füllen
+
+  const auto before = AllocationCounter::threadAllocations();
+  for (int i = 0; i < 1000; ++i) {
+    OATPP_ASSERT(auth.intercept(request) == nullptr);
+  }
+  const auto allocations = AllocationCounter::threadAllocations() - before;
+
+  std::cout << "Allokationen in intercept(): " << allocations << std::endl;
+  OATPP_ASSERT(allocations == 0);
+  OATPP_ASSERT(auth.outcomeCount(AuthInterceptor::Outcome::Accepted) == 1001);
+
+  // gleicher Weg, andere Ausgänge
+  auto missing = auth.intercept(makeRequest("GET", "/api/secure/ping"));
+  OATPP_ASSERT(missing && missing->getStatus().code == 401);
+  auto basic = auth.intercept(makeRequest("GET", "/api/secure/ping", {{"Authorization", "Basic dXNlcjpwdw=="}}));
+  OATPP_ASSERT(basic && basic->getStatus().code == 401);
+  auto forged = auth.intercept(makeRequest("GET", "/api/secure/ping", {{"Authorization", "Bearer not-a-jwt"}}));
+  OATPP_ASSERT(forged && forged->getStatus().code == 401);
+  OATPP_ASSERT(auth.intercept(makeRequest("GET", "/api/public/ping")) == nullptr); // nicht geschützt
+  OATPP_ASSERT(auth.outcomeCount(AuthInterceptor::Outcome::MissingToken) == 2);
+  OATPP_ASSERT(auth.outcomeCount(AuthInterceptor::Outcome::InvalidToken) == 1);
+}
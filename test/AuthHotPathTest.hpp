@@ -0,0 +1,18 @@
+#ifndef AuthHotPathTest_hpp
+#define AuthHotPathTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class AuthHotPathTest : public oatpp::test::UnitTest {
+public:
+  AuthHotPathTest() : UnitTest("TEST[AuthHotPathTest]") {}
+
+  void onRun() override;
+
+private:
+  void testExtractBearer();
+  void testNoAllocationsAfterWarmup();
+  void testInterceptNoAllocations();
+};
+
+#endif // AuthHotPathTest_hpp
@@ -0,0 +1,214 @@
+#include "CompactStudentTest.hpp"
+
+#include "model/CompactStudent.hpp"
+#include "util/ScratchArena.hpp"
+#include "app/AllocationCounter.hpp"
+
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * Resource, der Allokationen und belegte Bytes mitzählt (Upstream: Heap).
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+  std::size_t allocations = 0;
+  std::size_t bytesInUse = 0;
+
+private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    bytesInUse += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+    bytesInUse -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+}
+
+void CompactStudentTest::onRun() {
+  testLayout();
+  testInlineCourses();
+  testAllocatorPropagation();
+  testArenaReuse();
+  testScratchArena();
+}
+
+/**
+ * Test 1: eine Cache-Line pro Datensatz, Namen in einem Block, Grenzen für Namen und Alter
+ */
+void CompactStudentTest::testLayout() {
+  OATPP_ASSERT(sizeof(model::CompactStudent) == 64);
+  OATPP_ASSERT(alignof(model::CompactStudent) == 64);
+
+  CountingResource resource;
+  {
+    model::CompactStudent s(7, "Anna", "Zeller", 21, 3.7, &resource);
+    OATPP_ASSERT(resource.allocations == 1 && resource.bytesInUse == 10);
+    OATPP_ASSERT(s.getId() == 7 && s.getAge() == 21 && s.getGpa() == 3.7);
+    OATPP_ASSERT(s.getFirstName() == "Anna" && s.getLastName() == "Zeller");
+    OATPP_ASSERT(s.getFullName() == "Anna Zeller");
+
+    s.setFirstName(s.getLastName()); // Quelle liegt im alten Block
+    OATPP_ASSERT(s.getFirstName() == "Zeller" && s.getLastName() == "Zeller");
+    OATPP_ASSERT(resource.bytesInUse == 12);
+
+    model::CompactStudent t(8, "Anna Z", "Zeller", 21, 3.7, &resource);
+    OATPP_ASSERT((s.compareFullName(t) < 0) == (s.getFullName() < t.getFullName()));
+    OATPP_ASSERT(s.compareFullName(s) == 0);
+
+    s.setAge(-3);
+    OATPP_ASSERT(s.getAge() == 0);
+    s.setAge(1 << 20);
+    OATPP_ASSERT(s.getAge() == model::CompactStudent::kMaxAge);
+
+    bool thrown = false;
+    try {
+      s.setLastName(std::string(model::CompactStudent::kMaxNameLength + 1, 'x'));
+    } catch (const std::length_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown && s.getLastName() == "Zeller"); // unverändert
+  }
+  OATPP_ASSERT(resource.bytesInUse == 0);
+}
+
+/**
+ * Test 2: Kurse bleiben bis kInlineCourses im Objekt, darüber ein Block; sortiert und ohne Duplikate
+ */
+void CompactStudentTest::testInlineCourses() {
+  CountingResource resource;
+  {
+    model::CompactStudent s(1, "", "", 20, 2.0, &resource);
+    OATPP_ASSERT(resource.allocations == 0); // leere Namen → kein Block
+
+    for (model::SymbolId c : {9u, 3u, 7u, 1u}) OATPP_ASSERT(s.addCourse(c));
+    OATPP_ASSERT(!s.addCourse(7u));
+    OATPP_ASSERT(resource.allocations == 0);
+
+    OATPP_ASSERT(s.addCourse(5u)); // fünfter Kurs → Block mit doppelter Kapazität
+    OATPP_ASSERT(resource.allocations == 1);
+    OATPP_ASSERT(std::vector<model::SymbolId>(s.getCourseIds().begin(), s.getCourseIds().end())
+                 == (std::vector<model::SymbolId>{1, 3, 5, 7, 9}));
+    OATPP_ASSERT(s.hasCourse(5u) && !s.hasCourse(4u));
+
+    OATPP_ASSERT(s.removeCourse(1u) && !s.removeCourse(1u));
+    OATPP_ASSERT(s.getCourseCount() == 4 && s.hasCourse(9u));
+
+    OATPP_ASSERT(s.addCourse(std::string_view("Compact Analysis")));
+    OATPP_ASSERT(s.hasCourse(std::string_view("Compact Analysis")));
+    OATPP_ASSERT(!s.hasCourse(std::string_view("Compact Unbekannt")));
+    OATPP_ASSERT(s.setUniversity(std::string_view("TU Compact")));
+    OATPP_ASSERT(s.getUniversityId() == model::SymbolTable::global().find("TU Compact"));
+  }
+  OATPP_ASSERT(resource.bytesInUse == 0);
+}
+
+/**
+ * Test 3: std::pmr::vector reicht seinen Resource an die Elemente; Move klaut nur bei gleichem Resource
+ */
+void CompactStudentTest::testAllocatorPropagation() {
+  CountingResource a;
+  CountingResource b;
+  {
+    std::pmr::vector<model::CompactStudent> students(&a);
+    students.reserve(100);
+    for (std::int32_t id = 0; id < 100; ++id) {
+      auto& s = students.emplace_back(id, "Vorname", "Nachname" + std::to_string(id), 20, 3.0);
+      for (model::SymbolId c = 0; c < 6; ++c) s.addCourse(c);
+      OATPP_ASSERT(s.get_allocator().resource() == &a);
+    }
+    const auto allocations = a.allocations;
+    OATPP_ASSERT(allocations == 1 + 100 * 2); // Vektor + je Namen und Kursblock
+
+    std::pmr::vector<model::CompactStudent> moved(std::move(students)); // übernimmt Vektor samt Resource
+    OATPP_ASSERT(a.allocations == allocations);
+
+    std::pmr::vector<model::CompactStudent> other(&b);
+    other.reserve(100);
+    for (auto& s : moved) other.push_back(std::move(s)); // fremder Resource → Kopie nach b
+    OATPP_ASSERT(b.allocations == 1 + 100 * 2 && a.allocations == allocations);
+    OATPP_ASSERT(other[42].getLastName() == "Nachname42" && other[42].getCourseCount() == 6);
+    OATPP_ASSERT(other[42].get_allocator().resource() == &b);
+
+    model::CompactStudent local(std::move(other[42])); // ohne Allocator → gleicher Resource, nur Zeiger
+    OATPP_ASSERT(b.allocations == 1 + 100 * 2);
+    OATPP_ASSERT(local.getLastName() == "Nachname42" && other[42].getLastName().empty());
+
+    other[0] = local; // Kopie im Resource des Ziels
+    OATPP_ASSERT(other[0].getLastName() == "Nachname42" && other[0].get_allocator().resource() == &b);
+  }
+  OATPP_ASSERT(a.bytesInUse == 0 && b.bytesInUse == 0);
+}
+
+/**
+ * Test 4: StudentArena holt wenige große Blöcke; Änderungen und Löschungen nutzen freigewordenen Speicher wieder
+ */
+void CompactStudentTest::testArenaReuse() {
+  CountingResource upstream;
+  {
+    model::StudentArena arena(1 << 16, &upstream);
+    arena.reserve(10000);
+    for (std::int32_t id = 0; id < 10000; ++id) {
+      auto& s = arena.add(id, "Vorname" + std::to_string(id % 100), "Nachname" + std::to_string(id % 1000), 20, 3.0);
+      s.addCourse((model::SymbolId) (id % 7));
+    }
+    OATPP_ASSERT(arena.size() == 10000);
+    OATPP_ASSERT(upstream.allocations < 40); // statt 10000 einzelner Namensblöcke
+
+    auto rename = [&](int round) {
+      for (std::size_t i = 0; i < arena.size(); ++i) arena[i].setLastName(round % 2 ? "Nachname-A" : "Nachname-B");
+    };
+    rename(0); // erste Runde darf neue Größenklassen anlegen
+    const auto bytes = upstream.bytesInUse;
+    for (int round = 1; round < 20; ++round) rename(round);
+    OATPP_ASSERT(upstream.bytesInUse == bytes); // alte Namensblöcke gehen zurück in den Pool
+
+    arena.remove(0);
+    OATPP_ASSERT(arena.size() == 9999 && arena[0].getId() == 9999);
+    arena.remove(arena.size() - 1);
+    OATPP_ASSERT(arena.size() == 9998);
+
+    auto& copy = arena.add(model::CompactStudent(5, "Extern", "Kopie", 30, 1.0));
+    OATPP_ASSERT(copy.get_allocator().resource() == arena.resource());
+  }
+  OATPP_ASSERT(upstream.bytesInUse == 0);
+}
+
+/**
+ * Test 5: ScratchArena bedient kleine Zwischenergebnisse ohne Heap, größere über den Upstream
+ */
+void CompactStudentTest::testScratchArena() {
+  {
+    ScratchArena<4096> scratch;
+    const auto before = AllocationCounter::threadAllocations();
+    std::pmr::vector<std::int32_t> ids(&scratch);
+    ids.reserve(256);
+    for (std::int32_t i = 0; i < 256; ++i) ids.push_back(i);
+    std::pmr::string name("ein Name, der nicht in die SSO passt", &scratch);
+    OATPP_ASSERT(AllocationCounter::threadAllocations() == before);
+    OATPP_ASSERT(ids.back() == 255 && name.size() > 15);
+  }
+  {
+    CountingResource upstream;
+    {
+      ScratchArena<256> scratch(&upstream);
+      std::pmr::vector<std::int32_t> ids(&scratch);
+      ids.reserve(1000); // größer als der Puffer → Block vom Upstream
+      OATPP_ASSERT(upstream.allocations == 1);
+    }
+    OATPP_ASSERT(upstream.bytesInUse == 0);
+  }
+}
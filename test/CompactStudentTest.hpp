@@ -0,0 +1,20 @@
+#ifndef CompactStudentTest_hpp
+#define CompactStudentTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class CompactStudentTest : public oatpp::test::UnitTest {
+public:
+  CompactStudentTest() : UnitTest("TEST[CompactStudentTest]") {}
+
+  void onRun() override;
+
+private:
+  void testLayout();
+  void testInlineCourses();
+  void testAllocatorPropagation();
+  void testArenaReuse();
+  void testScratchArena();
+};
+
+#endif // CompactStudentTest_hpp
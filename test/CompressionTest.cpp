@@ -0,0 +1,284 @@
+#include "CompressionTest.hpp"
+
+#include "server/CompressionInterceptor.hpp"
+#include "app/TestRequest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#ifdef MY_PROJECT_BROTLI_DECODER
+#include <brotli/decode.h>
+#endif
+
+namespace {
+
+using compression::Encoding;
+
+std::string payload() {
+  std::string json = "[";
+  for (int i = 0; i < 2000; ++i) {
+    json += "{\"id\":" + std::to_string(i) + ",\"name\":\"Student " + std::to_string(i) + "\",\"university\":\"TU\"},";
+  }
+  json.back() = ']';
+  return json;
+}
+
+std::shared_ptr<oatpp::web::protocol::http::outgoing::Response> jsonResponse(const std::string& body) {
+  using namespace oatpp::web::protocol::http;
+  return outgoing::Response::createShared(Status::CODE_200,
+    outgoing::BufferBody::createShared(oatpp::String(body), "application/json"));
+}
+
+/**
+ * Body unbekannter Größe (wie ein Stream oder Generator): liefert die Daten in wechselnd kleinen Stücken,
+ * meldet vor jedem Stück einmal RETRY_READ (wie ein Async-Body, der noch wartet).
+ */
+class StreamedBody : public oatpp::web::protocol::http::outgoing::Body {
+  std::string data_;
+  std::size_t pos_ = 0;
+  std::size_t piece_ = 1;
+  bool retried_ = false;
+
+public:
+  explicit StreamedBody(std::string data)
+    : data_(std::move(data))
+  {}
+
+  oatpp::v_io_size read(void* buffer, v_buff_size count, oatpp::async::Action&) override {
+    if (pos_ == data_.size()) return 0;
+    if (!retried_) {
+      retried_ = true;
+      return oatpp::IOError::RETRY_READ;
+    }
+    retried_ = false;
+    piece_ = piece_ % 997 + 13;
+    const auto n = std::min({piece_, data_.size() - pos_, (std::size_t) count});
+    std::memcpy(buffer, data_.data() + pos_, n);
+    pos_ += n;
+    return (oatpp::v_io_size) n;
+  }
+
+  void declareHeaders(Headers& headers) override {
+    headers.put("Content-Type", "application/json");
+  }
+
+  p_char8 getKnownData() override {
+    return nullptr;
+  }
+
+  v_int64 getKnownSize() override {
+    return -1;
+  }
+};
+
+/**
+ * Body wie beim Senden in kleinen Stücken lesen (oatpp ruft read() mit seinem Sendepuffer auf).
+ */
+std::string drain(oatpp::web::protocol::http::outgoing::Body& body, std::size_t chunk) {
+  std::string out;
+  std::string buf(chunk, '\0');
+  oatpp::async::Action action;
+  for (;;) {
+    const auto n = body.read(buf.data(), (v_buff_size) buf.size(), action);
+    if (n == oatpp::IOError::RETRY_READ) continue; // innerer Body noch nicht bereit
+    OATPP_ASSERT(n >= 0);
+    if (n == 0) break;
+    out.append(buf.data(), (std::size_t) n);
+  }
+  return out;
+}
+
+std::string inflateAll(const std::string& in, bool gzip) {
+  z_stream z{};
+  OATPP_ASSERT(inflateInit2(&z, gzip ? 15 + 16 : 15) == Z_OK);
+  std::string out;
+  char buf[4096];
+  z.next_in = (Bytef*) in.data();
+  z.avail_in = (uInt) in.size();
+  int rc = Z_OK;
+  while (rc == Z_OK) {
+    z.next_out = (Bytef*) buf;
+    z.avail_out = sizeof(buf);
+    rc = inflate(&z, Z_NO_FLUSH);
+    out.append(buf, sizeof(buf) - z.avail_out);
+  }
+  inflateEnd(&z);
+  OATPP_ASSERT(rc == Z_STREAM_END);
+  return out;
+}
+
+#ifdef MY_PROJECT_BROTLI_DECODER
+std::string brotliDecodeAll(const std::string& in) {
+  auto* state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+  OATPP_ASSERT(state);
+  std::string out;
+  std::uint8_t buf[4096];
+  auto* next = reinterpret_cast<const std::uint8_t*>(in.data());
+  std::size_t available = in.size();
+  auto rc = BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT;
+  while (rc == BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT) {
+    std::uint8_t* outNext = buf;
+    std::size_t outAvailable = sizeof(buf);
+    rc = BrotliDecoderDecompressStream(state, &available, &next, &outAvailable, &outNext, nullptr);
+    out.append(reinterpret_cast<const char*>(buf), sizeof(buf) - outAvailable);
+  }
+  BrotliDecoderDestroyInstance(state);
+  OATPP_ASSERT(rc == BROTLI_DECODER_RESULT_SUCCESS);
+  OATPP_ASSERT(available == 0);
+  return out;
+}
+#endif
+
+}
+
+void CompressionTest::onRun() {
+  testNegotiation();
+  testStreamingRoundTrip();
+  testInterceptor();
+  testStreamedInnerBody();
+  testBrotliRoundTrip();
+}
+
+/**
+ * Test 1: Accept-Encoding mit q-Werten, Wildcard, Ausschluss; Server-Präferenz bei Gleichstand
+ */
+void CompressionTest::testNegotiation() {
+  const std::vector<Encoding> offered = {Encoding::Gzip, Encoding::Deflate};
+
+  OATPP_ASSERT(compression::negotiate("", offered) == Encoding::Identity);
+  OATPP_ASSERT(compression::negotiate("deflate, gzip", offered) == Encoding::Gzip);
+  OATPP_ASSERT(compression::negotiate("gzip;q=0.5, deflate", offered) == Encoding::Deflate);
+  OATPP_ASSERT(compression::negotiate("GZIP;Q=0.8, br", offered) == Encoding::Gzip);
+  OATPP_ASSERT(compression::negotiate("gzip;q=0, *", offered) == Encoding::Deflate);
+  OATPP_ASSERT(compression::negotiate("*;q=0", offered) == Encoding::Identity);
+  OATPP_ASSERT(compression::negotiate("identity", offered) == Encoding::Identity);
+  OATPP_ASSERT(compression::negotiate("br", {Encoding::Brotli, Encoding::Gzip}) == Encoding::Brotli);
+
+  OATPP_ASSERT(compression::compressible("application/json"));
+  OATPP_ASSERT(compression::compressible("text/plain; version=0.0.4; charset=utf-8"));
+  OATPP_ASSERT(compression::compressible("application/problem+json"));
+  OATPP_ASSERT(!compression::compressible("image/png"));
+  OATPP_ASSERT(!compression::compressible("application/octet-stream"));
+}
+
+/**
+ * Test 2: CompressedBody liefert gzip/deflate in kleinen Stücken, Dekompression ergibt das Original
+ */
+void CompressionTest::testStreamingRoundTrip() {
+  using oatpp::web::protocol::http::outgoing::BufferBody;
+
+  const auto original = payload();
+  compression::Options options;
+  for (auto e : {Encoding::Gzip, Encoding::Deflate}) {
+    for (std::size_t chunk : {64, 4096}) {
+      CompressedBody body(BufferBody::createShared(oatpp::String(original), "application/json"),
+                          compression::makeEncoder(e, options));
+      OATPP_ASSERT(body.getKnownSize() == -1);
+      const auto compressed = drain(body, chunk);
+      OATPP_ASSERT(compressed.size() < original.size() / 4);
+      OATPP_ASSERT(inflateAll(compressed, e == Encoding::Gzip) == original);
+    }
+  }
+}
+
+/**
+ * Test 3: Interceptor komprimiert nur, wenn Client, Content-Type und Größe passen; Header bleiben erhalten
+ */
+void CompressionTest::testInterceptor() {
+  using oatpp::web::protocol::http::Status;
+  using oatpp::web::protocol::http::outgoing::ResponseFactory;
+
+  compression::Options options;
+  options.encodings = {Encoding::Gzip, Encoding::Deflate};
+  options.minSize = 256;
+  CompressionInterceptor interceptor(options);
+  const auto original = payload();
+
+  auto res = jsonResponse(original);
+  res->putHeader("X-Test", "kept");
+  auto gz = interceptor.intercept(makeRequest("GET", "/api/students", {{"Accept-Encoding", "gzip, deflate"}}), res);
+  OATPP_ASSERT(gz != res);
+  OATPP_ASSERT(gz->getStatus().code == 200);
+  OATPP_ASSERT(gz->getHeader("Content-Encoding") == "gzip");
+  OATPP_ASSERT(gz->getHeader("Vary") == "Accept-Encoding");
+  OATPP_ASSERT(gz->getHeader("X-Test") == "kept");
+  OATPP_ASSERT(inflateAll(drain(*gz->getBody(), 8192), true) == original);
+
+  // kein Accept-Encoding: unverändert, aber Vary
+  auto plain = jsonResponse(original);
+  OATPP_ASSERT(interceptor.intercept(makeRequest("GET", "/api/students"), plain) == plain);
+  OATPP_ASSERT(plain->getHeader("Vary") == "Accept-Encoding");
+  OATPP_ASSERT(!plain->getHeader("Content-Encoding"));
+
+  // zu klein, HEAD, 304, nicht komprimierbar
+  auto small = jsonResponse("{\"statusCode\":200}");
+  OATPP_ASSERT(interceptor.intercept(makeRequest("GET", "/api/students", {{"Accept-Encoding", "gzip"}}), small) == small);
+  auto head = jsonResponse(original);
+  OATPP_ASSERT(interceptor.intercept(makeRequest("HEAD", "/api/students", {{"Accept-Encoding", "gzip"}}), head) == head);
+  auto notModified = ResponseFactory::createResponse(Status::CODE_304, original);
+  OATPP_ASSERT(interceptor.intercept(makeRequest("GET", "/api/students", {{"Accept-Encoding", "gzip"}}), notModified) == notModified);
+  auto binary = ResponseFactory::createResponse(Status::CODE_200, original);
+  binary->putHeader("Content-Type", "image/png");
+  OATPP_ASSERT(interceptor.intercept(makeRequest("GET", "/api/students", {{"Accept-Encoding", "gzip"}}), binary) == binary);
+}
+
+/**
+ * Test 4: innerer Body unbekannter Größe (chunked, mit RETRY_READ) wird vollständig komprimiert;
+ * der Interceptor komprimiert ihn unabhängig von minSize
+ */
+void CompressionTest::testStreamedInnerBody() {
+  using oatpp::web::protocol::http::Status;
+  using oatpp::web::protocol::http::outgoing::Response;
+
+  const auto original = payload();
+  compression::Options options;
+  for (auto e : {Encoding::Gzip, Encoding::Deflate}) {
+    for (std::size_t chunk : {64, 4096}) {
+      CompressedBody body(std::make_shared<StreamedBody>(original), compression::makeEncoder(e, options));
+      const auto compressed = drain(body, chunk);
+      OATPP_ASSERT(compressed.size() < original.size() / 4);
+      OATPP_ASSERT(inflateAll(compressed, e == Encoding::Gzip) == original);
+    }
+  }
+
+  options.encodings = {Encoding::Gzip};
+  options.minSize = 1 << 20; // greift nur bei bekannter Größe
+  CompressionInterceptor interceptor(options);
+  const std::string small = "{\"statusCode\":200}";
+  auto res = Response::createShared(Status::CODE_200, std::make_shared<StreamedBody>(small));
+  auto gz = interceptor.intercept(makeRequest("GET", "/api/students", {{"Accept-Encoding", "gzip"}}), res);
+  OATPP_ASSERT(gz != res);
+  OATPP_ASSERT(gz->getHeader("Content-Encoding") == "gzip");
+  OATPP_ASSERT(gz->getBody()->getKnownSize() == -1);
+  OATPP_ASSERT(inflateAll(drain(*gz->getBody(), 8192), true) == small);
+}
+
+/**
+ * Test 5: br aus BufferBody und aus gestreamtem Body dekodiert wieder zum Original (nur mit libbrotlienc/-dec)
+ */
+void CompressionTest::testBrotliRoundTrip() {
+#ifdef MY_PROJECT_BROTLI
+  using oatpp::web::protocol::http::outgoing::BufferBody;
+
+  const auto original = payload();
+  compression::Options options;
+  for (std::size_t chunk : {64, 4096}) {
+    CompressedBody known(BufferBody::createShared(oatpp::String(original), "application/json"),
+                         compression::makeEncoder(Encoding::Brotli, options));
+    CompressedBody streamed(std::make_shared<StreamedBody>(original),
+                            compression::makeEncoder(Encoding::Brotli, options));
+    const auto fromKnown = drain(known, chunk);
+    const auto fromStreamed = drain(streamed, chunk);
+    OATPP_ASSERT(fromKnown.size() < original.size() / 4);
+    OATPP_ASSERT(fromStreamed.size() < original.size() / 4);
+#ifdef MY_PROJECT_BROTLI_DECODER
+    OATPP_ASSERT(brotliDecodeAll(fromKnown) == original);
+    OATPP_ASSERT(brotliDecodeAll(fromStreamed) == original);
+#endif
+  }
+#endif
+}
@@ -0,0 +1,20 @@
+#ifndef CompressionTest_hpp
+#define CompressionTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class CompressionTest : public oatpp::test::UnitTest {
+public:
+  CompressionTest() : UnitTest("TEST[CompressionTest]") {}
+
+  void onRun() override;
+
+private:
+  void testNegotiation();
+  void testStreamingRoundTrip();
+  void testInterceptor();
+  void testStreamedInnerBody();
+  void testBrotliRoundTrip();
+};
+
+#endif // CompressionTest_hpp
@@ -0,0 +1,227 @@
+#include "JwksCacheTest.hpp"
+
+#include "auth/JwtVerifier.hpp"
+#include "app/JwksStandIn.hpp"
+#include "app/TestKeys.hpp"
+
+#include <limits>
+#include <string>
+#include <thread>
+
+namespace {
+
+std::string errorOf(JwksCache& cache, const std::string& kid) {
+  try {
+    cache.getKey(kid, 15);
+  } catch (const std::exception& e) {
+    return e.what();
+  }
+  return "";
+}
+
+// tryGetKey wiederholen, bis ein anderes Ergebnis als Pending kommt (Refresher arbeitet im Hintergrund)
+JwksCache::KeyLookup awaitKey(JwksCache& cache, const std::string& kid) {
+  auto r = cache.tryGetKey(kid);
+  for (int i = 0; i < 200 && r.status == JwksCache::KeyStatus::Pending; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    r = cache.tryGetKey(kid);
+  }
+  return r;
+}
+
+}
+
+void JwksCacheTest::onRun() {
+  testPrebuiltKeys();
+  testUnknownKidIsRateLimited();
+  testConditionalReload();
+  testNonBlockingLookup();
+  testStaleLookupIsThrottled();
+  testUnknownKidFlood();
+  testMaxAgeIsBounded();
+  testAwaitedKidFlood();
+}
+
+/**
+ * Test 1: geladene Schlüssel werden ohne Fetch geliefert, Tokens verifizieren
+ */
+void JwksCacheTest::testPrebuiltKeys() {
+  TestKeys keys;
+  auto cfg = TestKeys::config(); // JWKS-URL zeigt ins Leere → jeder Fetch schlägt fehl
+
+  JwtVerifier verifier(cfg);
+  verifier.jwks().load(keys.jwks(), 15);
+
+  auto first = verifier.jwks().getKey(keys.kid(), 15);
+  auto second = verifier.jwks().getKey(keys.kid(), 15);
+  OATPP_ASSERT(first);
+  OATPP_ASSERT(first == second); // derselbe, einmal gebaute Schlüssel
+
+  auto claims = verifier.verify(keys.sign(*cfg, "alice"));
+  OATPP_ASSERT(claims->subject == "alice");
+  OATPP_ASSERT(claims->authorizedParty == "test-client");
+}
+
+/**
+ * Test 2: unbekannte kids lösen höchstens einen Reload pro Intervall aus
+ */
+void JwksCacheTest::testUnknownKidIsRateLimited() {
+  TestKeys keys;
+  auto cfg = TestKeys::config();
+  cfg->jwksMinRefreshSeconds = 3600;
+
+  JwksCache cache(cfg);
+  cache.load(keys.jwks(), 15);
+
+  // erster unbekannter kid → erzwungener Reload wird versucht (und scheitert hier)
+  OATPP_ASSERT(errorOf(cache, "unknown-1") == "fetch JWKS failed");
+  // weitere unbekannte kids → kein Fetch innerhalb des Intervalls
+  OATPP_ASSERT(errorOf(cache, "unknown-2") == "kid not found in JWKS");
+  OATPP_ASSERT(errorOf(cache, "unknown-2") == "kid not found in JWKS");
+  // bekannter kid bleibt unbeeinflusst
+  OATPP_ASSERT(cache.getKey(keys.kid(), 15));
+}
+
+/**
+ * Test 3: Reload über den lokalen JWKS-Server → 304 ohne Parsing, TTL aus max-age (oder bei 304 ohne max-age die bisherige)
+ */
+void JwksCacheTest::testConditionalReload() {
+  TestKeys keys;
+  JwksStandIn idp(keys.jwks());
+  idp.controller().maxAgeSeconds = 120;
+
+  auto cfg = TestKeys::config(idp.url());
+  cfg->jwksMinRefreshSeconds = 0;
+
+  JwksCache cache(cfg);
+  auto key = cache.getKey(keys.kid(), 15); // erster Fetch: 200 + ETag
+  OATPP_ASSERT(key);
+  OATPP_ASSERT(idp.controller().requests == 1);
+  OATPP_ASSERT(cache.keySetTtl() == std::chrono::seconds(120));
+
+  // unbekannter kid erzwingt Reload → If-None-Match → 304, Schlüssel bleiben dieselben Objekte
+  OATPP_ASSERT(errorOf(cache, "rotated-away") == "kid not found in JWKS");
+  OATPP_ASSERT(idp.controller().requests == 2);
+  OATPP_ASSERT(idp.controller().notModified == 1);
+  OATPP_ASSERT(cache.getKey(keys.kid(), 15) == key);
+
+  // 304 ohne Cache-Control: TTL des gespeicherten Satzes bleibt (nicht jwksCacheMinutes)
+  idp.controller().maxAgeSeconds = -1;
+  OATPP_ASSERT(errorOf(cache, "rotated-again") == "kid not found in JWKS");
+  OATPP_ASSERT(idp.controller().notModified == 2);
+  OATPP_ASSERT(cache.keySetTtl() == std::chrono::seconds(120));
+}
+
+/**
+ * Test 4: tryGetKey wartet nie auf einen Fetch, der Refresher lädt im Hintergrund nach
+ */
+void JwksCacheTest::testNonBlockingLookup() {
+  TestKeys keys;
+  JwksStandIn idp(keys.jwks());
+
+  auto cfg = TestKeys::config(idp.url());
+  cfg->jwksMinRefreshSeconds = 0;
+
+  JwksCache cache(cfg);
+  // noch kein Satz geladen → sofort Pending, Refresher wird angestoßen
+  OATPP_ASSERT(cache.tryGetKey(keys.kid()).status == JwksCache::KeyStatus::Pending);
+  const auto found = awaitKey(cache, keys.kid());
+  OATPP_ASSERT(found.status == JwksCache::KeyStatus::Found && found.key);
+
+  // unbekannter kid: erst Pending, nach dem nächsten (304-)Reload bestätigt unbekannt
+  OATPP_ASSERT(cache.tryGetKey("rotated-away").status == JwksCache::KeyStatus::Pending);
+  OATPP_ASSERT(awaitKey(cache, "rotated-away").status == JwksCache::KeyStatus::Unknown);
+
+  // danach Negativ-Cache: kein weiterer Fetch
+  const int requests = idp.controller().requests;
+  OATPP_ASSERT(cache.tryGetKey("rotated-away").status == JwksCache::KeyStatus::Unknown);
+  OATPP_ASSERT(idp.controller().requests == requests);
+  OATPP_ASSERT(cache.tryGetKey(keys.kid()).key == found.key);
+
+  cache.stopRefresher();
+}
+
+/**
+ * Test 5: abgelaufener, noch tolerierbarer Satz - getKey liefert weiter und stößt höchstens einen Reload pro Intervall an
+ */
+void JwksCacheTest::testStaleLookupIsThrottled() {
+  TestKeys keys;
+  auto cfg = TestKeys::config(); // IdP nicht erreichbar
+  cfg->jwksMinRefreshSeconds = 3600;
+
+  JwksCache cache(cfg);
+  cache.load(keys.jwks(), 0); // sofort abgelaufen, bis jwksMaxStaleMinutes weiter nutzbar
+  cache.startRefresher();    // erster Fetch schlägt fehl, nächster Versuch erst nach Backoff
+  for (int i = 0; i < 200; ++i) {
+    OATPP_ASSERT(cache.getKey(keys.kid(), 15));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  cache.stopRefresher();
+  const auto stats = cache.reloadStats();
+  OATPP_ASSERT(stats.reloads == 0 && stats.failures <= 2); // Start + ein gedrosselter Anstoß
+}
+
+/**
+ * Test 6: Flut unbekannter kids verdrängt nur die ältesten Einträge des Negativ-Caches, statt ihn zu leeren
+ */
+void JwksCacheTest::testUnknownKidFlood() {
+  TestKeys keys;
+  JwksStandIn idp(keys.jwks());
+
+  auto cfg = TestKeys::config(idp.url());
+  cfg->jwksMinRefreshSeconds = 0; // jeder neue unbekannte kid lädt (304) und landet im Negativ-Cache
+  cfg->jwksNegativeCacheSeconds = 3600;
+
+  JwksCache cache(cfg);
+  OATPP_ASSERT(cache.getKey(keys.kid(), 15));
+  for (int i = 0; i < 1100; ++i) OATPP_ASSERT(errorOf(cache, "flood-" + std::to_string(i)) == "kid not found in JWKS");
+
+  const int requests = idp.controller().requests;
+  OATPP_ASSERT(errorOf(cache, "flood-1099") == "kid not found in JWKS");
+  OATPP_ASSERT(errorOf(cache, "flood-100") == "kid not found in JWKS");
+  OATPP_ASSERT(idp.controller().requests == requests); // jüngere Einträge überleben die Flut
+  OATPP_ASSERT(errorOf(cache, "flood-0") == "kid not found in JWKS");
+  OATPP_ASSERT(idp.controller().requests == requests + 1); // ältester verdrängt → neuer Reload
+}
+
+/**
+ * Test 7: max-age des IdP wird nach oben begrenzt (kein Überlauf der Frist, Rotation spätestens nach einem Tag)
+ */
+void JwksCacheTest::testMaxAgeIsBounded() {
+  TestKeys keys;
+  JwksStandIn idp(keys.jwks());
+  idp.controller().maxAgeSeconds = std::numeric_limits<long>::max();
+
+  auto cfg = TestKeys::config(idp.url());
+  cfg->jwksMinRefreshSeconds = 0;
+  JwksCache cache(cfg);
+  OATPP_ASSERT(cache.getKey(keys.kid(), 15));
+  OATPP_ASSERT(cache.keySetTtl() == std::chrono::hours(24));
+  OATPP_ASSERT(cache.getKey(keys.kid(), 15)); // Frist gültig, kein weiterer Fetch
+  OATPP_ASSERT(idp.controller().requests == 1);
+
+  idp.controller().maxAgeSeconds = 0;
+  OATPP_ASSERT(errorOf(cache, "rotated-away") == "kid not found in JWKS"); // erzwungener Reload → 304
+  OATPP_ASSERT(cache.keySetTtl() == std::chrono::seconds(30));
+}
+
+/**
+ * Test 8: tryGetKey - Flut unbekannter kids verdrängt nur die ältesten wartenden Einträge, statt alle zu löschen
+ */
+void JwksCacheTest::testAwaitedKidFlood() {
+  TestKeys keys;
+  auto cfg = TestKeys::config(); // IdP nicht erreichbar → nur load() publiziert neue Sätze
+  cfg->jwksMinRefreshSeconds = 3600;
+
+  JwksCache cache(cfg);
+  cache.load(keys.jwks(), 15);
+  for (int i = 0; i < 1100; ++i) {
+    OATPP_ASSERT(cache.tryGetKey("flood-" + std::to_string(i)).status == JwksCache::KeyStatus::Pending);
+  }
+  cache.load(keys.jwks(), 15); // neuer Satz: wartende kids gelten jetzt als bestätigt unbekannt
+
+  OATPP_ASSERT(cache.tryGetKey("flood-1099").status == JwksCache::KeyStatus::Unknown);
+  OATPP_ASSERT(cache.tryGetKey("flood-100").status == JwksCache::KeyStatus::Unknown);
+  OATPP_ASSERT(cache.tryGetKey("flood-0").status == JwksCache::KeyStatus::Pending); // ältester verdrängt
+  cache.stopRefresher();
+}
@@ -0,0 +1,23 @@
+#ifndef JwksCacheTest_hpp
+#define JwksCacheTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class JwksCacheTest : public oatpp::test::UnitTest {
+public:
+  JwksCacheTest() : UnitTest("TEST[JwksCacheTest]") {}
+
+  void onRun() override;
+
+private:
+  void testPrebuiltKeys();
+  void testUnknownKidIsRateLimited();
+  void testConditionalReload();
+  void testNonBlockingLookup();
+  void testStaleLookupIsThrottled();
+  void testUnknownKidFlood();
+  void testMaxAgeIsBounded();
+  void testAwaitedKidFlood();
+};
+
+#endif // JwksCacheTest_hpp
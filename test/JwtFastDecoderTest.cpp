@@ -0,0 +1,147 @@
+#include "JwtFastDecoderTest.hpp"
+
+#include "auth/JwtVerifier.hpp"
+#include "app/TestKeys.hpp"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string b64(const std::string& in) {
+  static const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+  std::string out;
+  size_t i = 0;
+  for (; i + 2 < in.size(); i += 3) {
+    const unsigned v = ((unsigned char) in[i] << 16) | ((unsigned char) in[i + 1] << 8) | (unsigned char) in[i + 2];
+    out += alphabet[(v >> 18) & 63];
+    out += alphabet[(v >> 12) & 63];
+    out += alphabet[(v >> 6) & 63];
+    out += alphabet[v & 63];
+  }
+  if (i + 1 == in.size()) {
+    const unsigned v = (unsigned char) in[i] << 16;
+    out += alphabet[(v >> 18) & 63];
+    out += alphabet[(v >> 12) & 63];
+  } else if (i + 2 == in.size()) {
+    const unsigned v = ((unsigned char) in[i] << 16) | ((unsigned char) in[i + 1] << 8);
+    out += alphabet[(v >> 18) & 63];
+    out += alphabet[(v >> 12) & 63];
+    out += alphabet[(v >> 6) & 63];
+  }
+  return out;
+}
+
+std::string token(const std::string& header, const std::string& payload) {
+  return b64(header) + "." + b64(payload) + "." + b64("signature");
+}
+
+enum class Outcome { Ok, Rejected };
+
+Outcome run(JwtVerifier& v, const std::string& tok, JwtVerifier::DecodePath path) {
+  try {
+    v.verifyUncached(tok, path);
+    return Outcome::Ok;
+  } catch (const std::exception&) {
+    return Outcome::Rejected;
+  }
+}
+
+}
+
+void JwtFastDecoderTest::onRun() {
+  testBase64Url();
+  testClaimReader();
+  testPathsAgree();
+}
+
+/**
+ * Test 1: SIMD- und skalarer base64url-Pfad liefern dasselbe (alle Restlängen, Blockgrenzen)
+ */
+void JwtFastDecoderTest::testBase64Url() {
+  std::string raw;
+  for (int len = 0; len < 100; ++len) {
+    const auto enc = b64(raw);
+    std::vector<std::uint8_t> a(base64url::decodedSize(enc.size()) + 1), b(a.size());
+    std::size_t na = 0, nb = 0;
+    OATPP_ASSERT(base64url::decode(enc, a.data(), na));
+    OATPP_ASSERT(base64url::decodeScalar(enc, b.data(), nb));
+    OATPP_ASSERT(na == raw.size() && nb == raw.size());
+    OATPP_ASSERT(std::string(a.begin(), a.begin() + na) == raw);
+    raw += (char) (len * 37 + 11);
+  }
+
+  std::uint8_t out[64];
+  std::size_t n = 0;
+  OATPP_ASSERT(!base64url::decode("abc=", out, n));                     // Padding gehört nicht zu JWT
+  OATPP_ASSERT(!base64url::decode("abcd+fgh", out, n));                 // Standard-Alphabet
+  OATPP_ASSERT(!base64url::decode("abcdefghijklmnopqrstuv/x", out, n)); // ungültig im SIMD-Block
+  OATPP_ASSERT(!base64url::decode("abcde", out, n));                    // Rest 1 ist unmöglich
+}
+
+/**
+ * Test 2: Claim-Reader liest nur die benötigten Felder, überspringt Rest, fällt bei Escapes zurück
+ */
+void JwtFastDecoderTest::testClaimReader() {
+  FastJwt jwt;
+  OATPP_ASSERT(JwtFastDecoder::decode(token(
+    R"({"alg":"RS256","typ":"JWT","kid":"k1"})",
+    R"({"iss":"https://i","aud":["a","starter"],"exp":1700000000,"nbf":5,"x":{"y":[1,"}"]},"sub":"bob","azp":"cli","iat":-1})"), jwt));
+  OATPP_ASSERT(jwt.alg == "RS256" && jwt.kid == "k1");
+  OATPP_ASSERT(jwt.iss == "https://i" && jwt.sub == "bob" && jwt.azp == "cli");
+  OATPP_ASSERT(jwt.hasAudience("starter") && !jwt.hasAudience("star"));
+  OATPP_ASSERT(jwt.hasExp && jwt.exp == 1700000000);
+  OATPP_ASSERT(jwt.hasNbf && jwt.nbf == 5 && jwt.hasIat && jwt.iat == -1);
+  OATPP_ASSERT(jwt.signatureSize == 9);
+
+  OATPP_ASSERT(JwtFastDecoder::decode(token(R"({"alg":"RS256"})", R"({"aud":"starter"})"), jwt));
+  OATPP_ASSERT(!jwt.audIsArray && jwt.hasAudience("starter") && !jwt.hasExp);
+
+  // → Fallback auf jwt-cpp
+  OATPP_ASSERT(!JwtFastDecoder::decode(token(R"({"alg":"RS256"})", R"({"iss":"a\/b"})"), jwt));
+  OATPP_ASSERT(!JwtFastDecoder::decode(token(R"({"alg":"RS256"})", R"({"exp":1.5})"), jwt));
+  OATPP_ASSERT(!JwtFastDecoder::decode(token(R"({"alg":"RS256"})", R"({"sub":"a","sub":"b"})"), jwt));
+  OATPP_ASSERT(!JwtFastDecoder::decode("a.b", jwt));
+  OATPP_ASSERT(!JwtFastDecoder::decode("a.b.c.d", jwt));
+}
+
+/**
+ * Test 3: beide Decode-Pfade akzeptieren/verwerfen dieselben Tokens
+ */
+void JwtFastDecoderTest::testPathsAgree() {
+  TestKeys keys;
+  TestKeys otherKeys(keys.kid());
+  auto cfg = TestKeys::config();
+  cfg->tokenCacheSize = 0;
+
+  JwtVerifier verifier(cfg);
+  verifier.jwks().load(keys.jwks(), 15);
+
+  auto otherAudience = std::make_shared<AuthConfig>(*cfg);
+  otherAudience->audience = "someone-else";
+  auto otherIssuer = std::make_shared<AuthConfig>(*cfg);
+  otherIssuer->issuer = "https://evil.test";
+
+  std::string tampered = keys.sign(*cfg, "alice");
+  tampered[tampered.find('.') + 5] ^= 1;
+
+  const std::vector<std::pair<std::string, Outcome>> cases = {
+    {keys.sign(*cfg, "alice"), Outcome::Ok},
+    {keys.sign(*cfg, "bob", std::chrono::hours(-1)), Outcome::Rejected},
+    {keys.sign(*otherAudience, "alice"), Outcome::Rejected},
+    {keys.sign(*otherIssuer, "alice"), Outcome::Rejected},
+    {otherKeys.sign(*cfg, "alice"), Outcome::Rejected},
+    {tampered, Outcome::Rejected},
+  };
+
+  for (const auto& c : cases) {
+    OATPP_ASSERT(run(verifier, c.first, JwtVerifier::DecodePath::JwtCpp) == c.second);
+    OATPP_ASSERT(run(verifier, c.first, JwtVerifier::DecodePath::Fast) == c.second);
+  }
+
+  const auto fast = verifier.verifyUncached(cases[0].first, JwtVerifier::DecodePath::Fast);
+  const auto slow = verifier.verifyUncached(cases[0].first, JwtVerifier::DecodePath::JwtCpp);
+  OATPP_ASSERT(fast->subject == "alice" && fast->subject == slow->subject);
+  OATPP_ASSERT(fast->authorizedParty == "test-client" && fast->authorizedParty == slow->authorizedParty);
+  OATPP_ASSERT(fast->expiresAt == slow->expiresAt);
+}
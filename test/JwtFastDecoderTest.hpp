@@ -0,0 +1,18 @@
+#ifndef JwtFastDecoderTest_hpp
+#define JwtFastDecoderTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class JwtFastDecoderTest : public oatpp::test::UnitTest {
+public:
+  JwtFastDecoderTest() : UnitTest("TEST[JwtFastDecoderTest]") {}
+
+  void onRun() override;
+
+private:
+  void testBase64Url();
+  void testClaimReader();
+  void testPathsAgree();
+};
+
+#endif // JwtFastDecoderTest_hpp
@@ -0,0 +1,184 @@
+#include "LeaderboardTest.hpp"
+
+#include "model/Leaderboard.hpp"
+#include "model/Student.hpp"
+#include "app/AllocationCounter.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+struct Row {
+  double gpa;
+  std::string name;
+};
+
+/**
+ * Erwartete Rangliste per Brute Force (gleiche Rundung der GPA wie der Schlüssel).
+ */
+std::vector<std::int32_t> expected(const std::map<std::int32_t, Row>& rows) {
+  std::vector<std::tuple<std::uint32_t, std::string, std::int32_t>> all;
+  for (const auto& [id, r] : rows) all.emplace_back(model::Leaderboard::gpaKey(r.gpa), r.name, id);
+  std::sort(all.begin(), all.end());
+  std::vector<std::int32_t> ids;
+  for (const auto& t : all) ids.push_back(std::get<2>(t));
+  return ids;
+}
+
+}
+
+void LeaderboardTest::onRun() {
+  testOrdering();
+  testIncrementalTopK();
+  testRelabel();
+  testSortedInsert();
+  testParallelSort();
+  testStudentComparison();
+}
+
+/**
+ * Test 1: GPA absteigend, dann Name aufsteigend, dann id; Update verschiebt, remove entfernt
+ */
+void LeaderboardTest::testOrdering() {
+  OATPP_ASSERT(model::Leaderboard::gpaKey(3.9) < model::Leaderboard::gpaKey(3.7));
+  OATPP_ASSERT(model::Leaderboard::gpaKey(-1) == model::Leaderboard::gpaKey(0));
+
+  model::Leaderboard board;
+  board.upsert(1, 3.2, "Charlie Brown");
+  board.upsert(2, 3.9, "Alice Smith");
+  board.upsert(3, 3.5, "Bob Jones");
+  board.upsert(4, 3.5, "Anna Jones");
+  board.upsert(5, 3.5, "Anna Jones");
+
+  OATPP_ASSERT(board.top(10) == (std::vector<std::int32_t>{2, 4, 5, 3, 1}));
+  OATPP_ASSERT(board.top(2) == (std::vector<std::int32_t>{2, 4}));
+  OATPP_ASSERT(board.ranking() == board.top(10));
+
+  board.upsert(1, 4.0, "Charlie Brown");
+  OATPP_ASSERT(board.top(1) == (std::vector<std::int32_t>{1}));
+  OATPP_ASSERT(board.remove(2));
+  OATPP_ASSERT(!board.remove(2));
+  OATPP_ASSERT(board.top(10) == (std::vector<std::int32_t>{1, 4, 5, 3}));
+  OATPP_ASSERT(board.size() == 4);
+}
+
+/**
+ * Test 2: zufällige Upserts/Removes mit kleiner capacity - top(k) stimmt immer mit Brute Force überein
+ */
+void LeaderboardTest::testIncrementalTopK() {
+  model::Leaderboard board(16);
+  std::map<std::int32_t, Row> rows;
+  std::mt19937 rng(7);
+  const char* names[] = {"Anna A", "Anna B", "Ben A", "Clara", "Dora", "Emil", "Finn", "Greta"};
+
+  for (int op = 0; op < 20000; ++op) {
+    const auto id = (std::int32_t) (rng() % 200);
+    if (rng() % 4 == 0) {
+      OATPP_ASSERT(board.remove(id) == (rows.erase(id) == 1));
+    } else {
+      Row r{(double) (rng() % 41) / 10.0, names[rng() % 8]};
+      board.upsert(id, r.gpa, r.name);
+      rows[id] = r;
+    }
+    if (op % 7 == 0) {
+      const auto k = (std::size_t) (rng() % 20);
+      auto want = expected(rows);
+      want.resize(std::min({want.size(), k, (std::size_t) 16}));
+      OATPP_ASSERT(board.top(k) == want);
+    }
+  }
+  OATPP_ASSERT(board.ranking() == expected(rows));
+}
+
+/**
+ * Test 3: Namen immer am Ende eingefügt erschöpfen die Label-Lücken → Neuverteilung, Reihenfolge bleibt korrekt
+ */
+void LeaderboardTest::testRelabel() {
+  model::Leaderboard board(8);
+  std::map<std::int32_t, Row> rows;
+  std::string name;
+  for (std::int32_t id = 0; id < 100; ++id) {
+    name += 'a';
+    board.upsert(id, 3.0, name);          // halbiert jedes Mal die Lücke nach oben
+    board.upsert(1000 + id, 3.0, "b" + name); // und nach unten
+    rows[id] = {3.0, name};
+    rows[1000 + id] = {3.0, "b" + name};
+  }
+  OATPP_ASSERT(board.ranking() == expected(rows));
+  auto want = expected(rows);
+  want.resize(8);
+  OATPP_ASSERT(board.top(8) == want);
+}
+
+/**
+ * Test 4: sortierte Importe (aufsteigend, absteigend, immer an derselben Stelle) - lokale Neuverteilung hält
+ * die Reihenfolge; vorher kostete jede erschöpfte Lücke eine Neuverteilung aller Namen (quadratisch)
+ */
+void LeaderboardTest::testSortedInsert() {
+  model::Leaderboard board(16);
+  std::map<std::int32_t, Row> rows;
+  auto add = [&](std::int32_t id, std::string name) {
+    board.upsert(id, 3.0, name);
+    rows[id] = {3.0, std::move(name)};
+  };
+  char buffer[32];
+  add(300000, "j1");
+  for (std::int32_t i = 0; i < 30000; ++i) {
+    std::snprintf(buffer, sizeof(buffer), "m%08d", i);
+    add(i, buffer);                               // immer am Ende
+    std::snprintf(buffer, sizeof(buffer), "l%08d", 99999999 - i);
+    add(100000 + i, buffer);                      // immer am Anfang des l-Bereichs
+    std::snprintf(buffer, sizeof(buffer), "j0%08d", i);
+    add(200000 + i, buffer);                      // immer direkt vor "j1"
+  }
+  OATPP_ASSERT(board.ranking() == expected(rows));
+  auto want = expected(rows);
+  want.resize(16);
+  OATPP_ASSERT(board.top(16) == want);
+}
+
+/**
+ * Test 5: parallelSort (WorkerPool) liefert dasselbe wie std::sort, auch bei ungeraden Teilstücken
+ */
+void LeaderboardTest::testParallelSort() {
+  std::mt19937_64 rng(11);
+  for (std::size_t threads : {1, 2, 4}) {
+    WorkerPool pool(threads);
+    for (std::size_t n : {0u, 1000u, 100000u, 300001u}) {
+      std::vector<model::Leaderboard::Entry> entries(n);
+      for (auto& e : entries) e = {rng() % 5000, (std::int32_t) (rng() % 1000000)};
+      auto reference = entries;
+      std::sort(reference.begin(), reference.end());
+      model::Leaderboard::parallelSort(entries, &pool);
+      OATPP_ASSERT(std::equal(entries.begin(), entries.end(), reference.begin(), reference.end(),
+        [](const auto& a, const auto& b) { return a.key == b.key && a.id == b.id; }));
+    }
+  }
+}
+
+/**
+ * Test 6: Student::operator< vergleicht Namen ohne Allokation, Ergebnis wie getFullName()
+ */
+void LeaderboardTest::testStudentComparison() {
+  model::Student a(1, "Anna", "Zeller-Schmidt-Langname", 20, 3.5);
+  model::Student b(2, "Anna Z", "Zeller", 20, 3.5);
+  model::Student c(3, "Anna", "Zeller-Schmidt-Langname", 20, 3.9);
+
+  const auto before = AllocationCounter::threadAllocations();
+  const bool ab = a < b;
+  const bool ba = b < a;
+  const bool ca = c < a;
+  const bool aa = a < a;
+  OATPP_ASSERT(AllocationCounter::threadAllocations() == before);
+
+  OATPP_ASSERT(ab == (a.getFullName() < b.getFullName()));
+  OATPP_ASSERT(ba == (b.getFullName() < a.getFullName()));
+  OATPP_ASSERT(ca && !aa);
+  OATPP_ASSERT(a.compareFullName(a) == 0);
+}
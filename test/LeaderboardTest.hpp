@@ -0,0 +1,21 @@
+#ifndef LeaderboardTest_hpp
+#define LeaderboardTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class LeaderboardTest : public oatpp::test::UnitTest {
+public:
+  LeaderboardTest() : UnitTest("TEST[LeaderboardTest]") {}
+
+  void onRun() override;
+
+private:
+  void testOrdering();
+  void testIncrementalTopK();
+  void testRelabel();
+  void testSortedInsert();
+  void testParallelSort();
+  void testStudentComparison();
+};
+
+#endif // LeaderboardTest_hpp
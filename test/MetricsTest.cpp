@@ -0,0 +1,178 @@
+#include "MetricsTest.hpp"
+
+#include "controller/MyAuthController.hpp"
+#include "metrics/MetricsExporter.hpp"
+#include "app/TestKeys.hpp"
+#include "app/TestRequest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+#include "oatpp/json/ObjectMapper.hpp"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::shared_ptr<oatpp::web::mime::ContentMappers> jsonMappers() {
+  auto mappers = std::make_shared<oatpp::web::mime::ContentMappers>();
+  mappers->putMapper(std::make_shared<oatpp::json::ObjectMapper>());
+  return mappers;
+}
+
+bool contains(const std::string& text, const std::string& line) {
+  return text.find(line + "\n") != std::string::npos;
+}
+
+}
+
+void MetricsTest::onRun() {
+  testShardedCounters();
+  testEndpointResolution();
+  testInterceptorAndExport();
+  testServerTiming();
+}
+
+/**
+ * Test 1: Zähler/Histogramm über mehrere Threads summieren sich exakt
+ */
+void MetricsTest::testShardedCounters() {
+  metrics::ShardedCounter counter;
+  metrics::LatencyHistogram histogram;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 10000; ++i) {
+        counter.add();
+        histogram.observe(std::int64_t(200'000)); // 200 µs → Bucket le=0.00025
+      }
+    });
+  }
+  for (auto& t : threads) t.join();
+
+  OATPP_ASSERT(counter.value() == 80000);
+  const auto snap = histogram.snapshot();
+  OATPP_ASSERT(snap.count == 80000);
+  OATPP_ASSERT(snap.counts[2] == 80000);
+  OATPP_ASSERT(snap.sumNs == 80000LL * 200'000);
+}
+
+/**
+ * Test 2: Request → Endpoint (Route-Pattern, Methode), Query ignoriert, Unbekanntes gesammelt
+ */
+void MetricsTest::testEndpointResolution() {
+  HttpMetrics http;
+  http.addEndpoints(std::make_shared<MyAuthController>(jsonMappers()));
+
+  OATPP_ASSERT(http.resolve("GET", "/api/public/ping").path == "/api/public/ping");
+  OATPP_ASSERT(http.resolve("GET", "/api/public/ping?x=1").path == "/api/public/ping");
+  OATPP_ASSERT(http.resolve("POST", "/api/public/ping").path == "unmatched");
+  OATPP_ASSERT(http.resolve("GET", "/nope").path == "unmatched");
+
+  OATPP_ASSERT(HttpMetrics::matchesTemplate("/api/students/{id}", "/api/students/42"));
+  OATPP_ASSERT(!HttpMetrics::matchesTemplate("/api/students/{id}", "/api/students/"));
+  OATPP_ASSERT(!HttpMetrics::matchesTemplate("/api/students/{id}", "/api/students/42/x"));
+  OATPP_ASSERT(HttpMetrics::matchesTemplate("/static/*", "/static/a/b"));
+
+  OATPP_ASSERT(HttpMetrics::statusLabel(HttpMetrics::statusSlot(401)) == "401");
+  OATPP_ASSERT(HttpMetrics::statusLabel(HttpMetrics::statusSlot(418)) == "4xx");
+}
+
+/**
+ * Test 3: Interceptor-Kette zählt Status/Latenz, AuthInterceptor-Ergebnisse, Export im Prometheus-Format
+ */
+void MetricsTest::testInterceptorAndExport() {
+  using oatpp::web::protocol::http::Status;
+  using oatpp::web::protocol::http::outgoing::ResponseFactory;
+
+  TestKeys keys;
+  auto cfg = TestKeys::config();
+  auto verifier = std::make_shared<JwtVerifier>(cfg);
+  verifier->jwks().load(keys.jwks(), 15);
+  auto auth = std::make_shared<AuthInterceptor>(verifier);
+
+  auto http = std::make_shared<HttpMetrics>();
+  http->addEndpoints(std::make_shared<MyAuthController>(jsonMappers()));
+  MetricsInterceptor interceptor(http, /*crossThread=*/false);
+
+  // geschützter Pfad ohne Token → AuthInterceptor antwortet 401, Metrik sieht den endgültigen Status
+  auto secure = makeRequest("GET", "/api/secure/ping");
+  OATPP_ASSERT(interceptor.intercept(secure) == nullptr);
+  auto rejected = auth->intercept(secure);
+  OATPP_ASSERT(rejected && rejected->getStatus().code == 401);
+  interceptor.intercept(secure, rejected);
+
+  for (int i = 0; i < 3; ++i) {
+    auto pub = makeRequest("GET", "/api/public/ping");
+    interceptor.intercept(pub);
+    OATPP_ASSERT(auth->intercept(pub) == nullptr);
+    interceptor.intercept(pub, ResponseFactory::createResponse(Status::CODE_200, "ok"));
+  }
+
+  verifier->verify(keys.sign(*cfg, "alice"));
+
+  MetricsExporter exporter(http, verifier, auth, ConnectionMetricsHandler::createShared(nullptr));
+  const auto text = exporter.render();
+
+  OATPP_ASSERT(contains(text, "http_requests_total{method=\"GET\",endpoint=\"/api/secure/ping\",status=\"401\"} 1"));
+  OATPP_ASSERT(contains(text, "http_requests_total{method=\"GET\",endpoint=\"/api/public/ping\",status=\"200\"} 3"));
+  OATPP_ASSERT(contains(text, "http_request_duration_seconds_count{method=\"GET\",endpoint=\"/api/public/ping\"} 3"));
+  OATPP_ASSERT(contains(text, "http_request_duration_seconds_bucket{method=\"GET\",endpoint=\"/api/public/ping\",le=\"+Inf\"} 3"));
+  OATPP_ASSERT(contains(text, "auth_requests_total{outcome=\"missing_token\"} 1"));
+  OATPP_ASSERT(contains(text, "auth_requests_total{outcome=\"accepted\"} 0"));
+  OATPP_ASSERT(contains(text, "jwt_verify_duration_seconds_count 1"));
+  OATPP_ASSERT(contains(text, "jwks_keys 1"));
+  OATPP_ASSERT(contains(text, "server_connections_open 0"));
+}
+
+/**
+ * Test 4: Server-Timing nur auf Anfrage, Stages aus Auth-Kette und Serialisierung im Header
+ */
+void MetricsTest::testServerTiming() {
+  using oatpp::web::protocol::http::Status;
+  using oatpp::web::protocol::http::outgoing::ResponseFactory;
+
+  TestKeys keys;
+  auto cfg = TestKeys::config();
+  auto verifier = std::make_shared<JwtVerifier>(cfg);
+  verifier->jwks().load(keys.jwks(), 15);
+  AuthInterceptor auth(verifier);
+  metrics::ServerTimingInterceptor timing(/*always=*/false);
+  auto chainEnd = metrics::ServerTimingInterceptor::chainEnd();
+  metrics::TimingObjectMapper mapper(std::make_shared<oatpp::json::ObjectMapper>());
+
+  // ohne Header: keine Timeline, StageScopes zählen nichts
+  auto plain = makeRequest("GET", "/api/secure/ping");
+  timing.intercept(plain);
+  OATPP_ASSERT(!metrics::RequestTimeline::current().active);
+  auto res = timing.intercept(plain, auth.intercept(plain));
+  OATPP_ASSERT(!res->getHeader("Server-Timing"));
+
+  // mit Header, gültiges Token: bearer/jwks/sig, Handler mit Serialisierung
+  auto traced = makeRequest("GET", "/api/secure/ping", {
+    {metrics::ServerTimingInterceptor::REQUEST_HEADER, "1"},
+    {"Authorization", oatpp::String("Bearer " + keys.sign(*cfg, "alice"))}
+  });
+
+  timing.intercept(traced);
+  OATPP_ASSERT(auth.intercept(traced) == nullptr);
+  chainEnd->intercept(traced);
+  mapper.writeToString(oatpp::String("payload"));
+  res = timing.intercept(traced, ResponseFactory::createResponse(Status::CODE_200, "ok"));
+
+  const auto header = res->getHeader("Server-Timing");
+  OATPP_ASSERT(header);
+  std::cout << "Server-Timing: " << *header << std::endl;
+  for (const char* stage : {"intercept;dur=", "bearer;dur=", "jwks;dur=", "sig;dur=", "handler;dur=", "serialize;dur=", "total;dur="}) {
+    OATPP_ASSERT(header->find(stage) != std::string::npos);
+  }
+  OATPP_ASSERT(!metrics::RequestTimeline::current().active);
+
+  // Abbruch in der Kette (401): kein Handler-Anteil
+  auto rejected = makeRequest("GET", "/api/secure/ping", {{metrics::ServerTimingInterceptor::REQUEST_HEADER, "1"}});
+  timing.intercept(rejected);
+  res = timing.intercept(rejected, auth.intercept(rejected));
+  OATPP_ASSERT(res->getHeader("Server-Timing"));
+  OATPP_ASSERT(res->getHeader("Server-Timing")->find("handler") == std::string::npos);
+}
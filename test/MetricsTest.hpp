@@ -0,0 +1,19 @@
+#ifndef MetricsTest_hpp
+#define MetricsTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class MetricsTest : public oatpp::test::UnitTest {
+public:
+  MetricsTest() : UnitTest("TEST[MetricsTest]") {}
+
+  void onRun() override;
+
+private:
+  void testShardedCounters();
+  void testEndpointResolution();
+  void testInterceptorAndExport();
+  void testServerTiming();
+};
+
+#endif // MetricsTest_hpp
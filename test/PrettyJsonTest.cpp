@@ -0,0 +1,94 @@
+#include "PrettyJsonTest.hpp"
+
+#include "dto/DTOs.hpp"
+#include "server/PrettyJsonInterceptor.hpp"
+#include "server/HelloResponse.hpp"
+#include "app/TestRequest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+#include "oatpp/json/ObjectMapper.hpp"
+
+#include <string>
+
+namespace {
+
+std::string bodyOf(const std::shared_ptr<oatpp::web::protocol::http::outgoing::Response>& res) {
+  const auto& body = res->getBody();
+  return std::string(reinterpret_cast<const char*>(body->getKnownData()), (std::size_t) body->getKnownSize());
+}
+
+}
+
+void PrettyJsonTest::onRun() {
+  testParameters();
+  testStaticResponse();
+  testInterceptor();
+}
+
+/**
+ * Test 1: ?pretty und Accept-Parameter pretty werden erkannt, Ähnliches nicht
+ */
+void PrettyJsonTest::testParameters() {
+  OATPP_ASSERT(PrettyJsonInterceptor::prettyQuery("/api?pretty"));
+  OATPP_ASSERT(PrettyJsonInterceptor::prettyQuery("/api?a=1&pretty=true"));
+  OATPP_ASSERT(PrettyJsonInterceptor::prettyQuery("/api?pretty=1&a=1"));
+  OATPP_ASSERT(!PrettyJsonInterceptor::prettyQuery("/api/pretty"));
+  OATPP_ASSERT(!PrettyJsonInterceptor::prettyQuery("/api?pretty=false"));
+  OATPP_ASSERT(!PrettyJsonInterceptor::prettyQuery("/api?prettyx"));
+
+  OATPP_ASSERT(PrettyJsonInterceptor::prettyAccept("application/json; pretty=true"));
+  OATPP_ASSERT(PrettyJsonInterceptor::prettyAccept("text/html, application/json;pretty"));
+  OATPP_ASSERT(!PrettyJsonInterceptor::prettyAccept("application/json"));
+  OATPP_ASSERT(!PrettyJsonInterceptor::prettyAccept("application/json; q=0.9"));
+  OATPP_ASSERT(!PrettyJsonInterceptor::prettyAccept("application/json; pretty=false"));
+}
+
+/**
+ * Test 2: StaticResponse liefert dieselben Bytes wie eine Serialisierung pro Request, Puffer wird geteilt
+ */
+void PrettyJsonTest::testStaticResponse() {
+  auto mapper = std::make_shared<oatpp::json::ObjectMapper>();
+  auto cached = HelloResponse::create(mapper);
+
+  const auto expected = mapper->writeToString(HelloResponse::dto());
+  OATPP_ASSERT(cached.body() == expected);
+  OATPP_ASSERT(expected->find('\n') == std::string::npos); // kompakt
+
+  auto a = cached.respond();
+  auto b = cached.respond();
+  OATPP_ASSERT(a != b);
+  OATPP_ASSERT(a->getStatus().code == 200);
+  OATPP_ASSERT(bodyOf(a) == *expected);
+  OATPP_ASSERT(a->getBody()->getKnownData() == b->getBody()->getKnownData());
+}
+
+/**
+ * Test 3: Interceptor formatiert JSON nur auf Wunsch, Status/Header bleiben, Nicht-JSON unverändert
+ */
+void PrettyJsonTest::testInterceptor() {
+  using oatpp::web::protocol::http::Status;
+  using oatpp::web::protocol::http::outgoing::ResponseFactory;
+
+  auto mapper = std::make_shared<oatpp::json::ObjectMapper>();
+  auto cached = HelloResponse::create(mapper);
+  PrettyJsonInterceptor interceptor;
+
+  auto compact = cached.respond();
+  OATPP_ASSERT(interceptor.intercept(makeRequest("GET", "/"), compact) == compact);
+
+  auto res = cached.respond();
+  res->putHeader("X-Test", "kept");
+  auto pretty = interceptor.intercept(makeRequest("GET", "/?pretty"), res);
+  OATPP_ASSERT(pretty != res);
+  OATPP_ASSERT(pretty->getStatus().code == 200);
+  OATPP_ASSERT(pretty->getHeader("X-Test") == "kept");
+  const auto text = bodyOf(pretty);
+  OATPP_ASSERT(text.find('\n') != std::string::npos);
+  OATPP_ASSERT(text.find("  \"message\": \"Hello World!\"") != std::string::npos);
+
+  auto viaAccept = interceptor.intercept(makeRequest("GET", "/", {{"Accept", "application/json; pretty=true"}}), cached.respond());
+  OATPP_ASSERT(bodyOf(viaAccept) == text);
+
+  auto plain = ResponseFactory::createResponse(Status::CODE_200, "not json");
+  OATPP_ASSERT(interceptor.intercept(makeRequest("GET", "/?pretty"), plain) == plain);
+}
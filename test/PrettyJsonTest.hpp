@@ -0,0 +1,18 @@
+#ifndef PrettyJsonTest_hpp
+#define PrettyJsonTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class PrettyJsonTest : public oatpp::test::UnitTest {
+public:
+  PrettyJsonTest() : UnitTest("TEST[PrettyJsonTest]") {}
+
+  void onRun() override;
+
+private:
+  void testParameters();
+  void testStaticResponse();
+  void testInterceptor();
+};
+
+#endif // PrettyJsonTest_hpp
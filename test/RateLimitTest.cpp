@@ -0,0 +1,164 @@
+#include "RateLimitTest.hpp"
+
+#include "auth/AuthInterceptor.hpp"
+#include "app/TestKeys.hpp"
+#include "app/TestRequest.hpp"
+
+#include <string>
+
+namespace {
+
+oatpp::String bearer(const std::string& token) {
+  return oatpp::String("Bearer " + token);
+}
+
+}
+
+void RateLimitTest::onRun() {
+  testTokenBucket();
+  testEviction();
+  testAuthInterceptor();
+  testLruEviction();
+  testPeerAddress();
+}
+
+/**
+ * Test 1: Burst, Ablehnung mit Retry-After/Reset, zeitbasiertes Nachfüllen, getrennte Schlüssel
+ */
+void RateLimitTest::testTokenBucket() {
+  RateLimiter limiter({2, 3}, 1000);
+  auto t = RateLimiter::Clock::now();
+  const auto alice = RateLimiter::hashKey("alice");
+
+  for (int i = 0; i < 3; ++i) OATPP_ASSERT(limiter.acquire(alice, t).allowed);
+  const auto d = limiter.acquire(alice, t);
+  OATPP_ASSERT(!d.allowed);
+  OATPP_ASSERT(d.limit == 3 && d.remaining == 0);
+  OATPP_ASSERT(d.retryAfterSec == 1 && d.resetSec == 2);
+  OATPP_ASSERT(limiter.acquire(RateLimiter::hashKey("bob"), t).allowed);
+
+  t += std::chrono::milliseconds(500); // 2/s → ein Token
+  OATPP_ASSERT(limiter.acquire(alice, t).allowed);
+  OATPP_ASSERT(!limiter.acquire(alice, t).allowed);
+
+  t += std::chrono::seconds(10); // voll, nicht mehr als burst
+  for (int i = 0; i < 3; ++i) OATPP_ASSERT(limiter.acquire(alice, t).allowed);
+  OATPP_ASSERT(!limiter.acquire(alice, t).allowed);
+
+  RateLimiter off({0, 0}, 10);
+  OATPP_ASSERT(!off.enabled() && off.acquire(alice).allowed);
+}
+
+/**
+ * Test 2: Tabelle bleibt bei maxKeys gedeckelt, idle Buckets verschwinden beim Aufräumen
+ */
+void RateLimitTest::testEviction() {
+  auto t = RateLimiter::Clock::now();
+
+  RateLimiter bounded({1, 1}, 640); // 64 Shards × 10
+  for (std::uint64_t k = 0; k < 100000; ++k) bounded.acquire(k * 0x9E3779B97F4A7C15ull, t);
+  OATPP_ASSERT(bounded.size() <= 640);
+
+  RateLimiter idle({10, 10}, 1000000);
+  for (std::uint64_t k = 0; k < 64 * 100; ++k) idle.acquire(k, t);
+  OATPP_ASSERT(idle.size() == 64 * 100);
+  t += std::chrono::seconds(2); // Buckets wieder voll → idle
+  for (std::uint64_t k = 0; k < 64 * 4096; ++k) idle.acquire(1000000 + k, t); // jeder Shard räumt auf
+  OATPP_ASSERT(idle.size() == 64 * 4096); // die 6400 alten sind weg
+}
+
+/**
+ * Test 3: AuthInterceptor – IP-Vorfilter vor der Signaturprüfung, sub-Limit danach, 429 mit Headern
+ */
+void RateLimitTest::testAuthInterceptor() {
+  TestKeys keys;
+  auto cfg = TestKeys::config();
+  cfg->rateLimitIpRps = 0.001;
+  cfg->rateLimitIpBurst = 3;
+  cfg->rateLimitSubRps = 0.001;
+  cfg->rateLimitSubBurst = 2;
+  cfg->rateLimitIpHeader = "X-Forwarded-For";
+  auto verifier = std::make_shared<JwtVerifier>(cfg);
+  verifier->jwks().load(keys.jwks(), 15);
+  AuthInterceptor auth(verifier);
+
+  const auto alice = keys.sign(*cfg, "alice");
+  const auto bob = keys.sign(*cfg, "bob");
+
+  // sub: 2 pro alice, dann 429; bob unabhängig (andere IPs, damit der IP-Vorfilter nicht greift)
+  OATPP_ASSERT(auth.intercept(makeRequest("GET", "/api/secure/ping", {{"Authorization", bearer(alice)}, {"X-Forwarded-For", "10.0.0.1"}})) == nullptr);
+  OATPP_ASSERT(auth.intercept(makeRequest("GET", "/api/secure/ping", {{"Authorization", bearer(alice)}, {"X-Forwarded-For", "10.0.0.2"}})) == nullptr);
+  auto limited = auth.intercept(makeRequest("GET", "/api/secure/ping", {{"Authorization", bearer(alice)}, {"X-Forwarded-For", "10.0.0.3"}}));
+  OATPP_ASSERT(limited && limited->getStatus().code == 429);
+  OATPP_ASSERT(limited->getHeader("RateLimit-Limit") == "2");
+  OATPP_ASSERT(limited->getHeader("RateLimit-Remaining") == "0");
+  OATPP_ASSERT(limited->getHeader("Retry-After"));
+  OATPP_ASSERT(limited->getHeader("RateLimit-Reset"));
+  OATPP_ASSERT(auth.intercept(makeRequest("GET", "/api/secure/ping", {{"Authorization", bearer(bob)}, {"X-Forwarded-For", "10.0.0.4"}})) == nullptr);
+
+  // IP: letzter X-Forwarded-For-Eintrag zählt; ab dem 4. Request 429 – auch mit kaputtem Token (keine Prüfung)
+  for (int i = 0; i < 3; ++i) {
+    auto r = auth.intercept(makeRequest("GET", "/api/secure/ping", {{"Authorization", bearer("not-a-jwt")}, {"X-Forwarded-For", "1.2.3.4, 192.0.2.7"}}));
+    OATPP_ASSERT(r && r->getStatus().code == 401);
+  }
+  auto shed = auth.intercept(makeRequest("GET", "/api/secure/ping", {{"Authorization", bearer("not-a-jwt")}, {"X-Forwarded-For", "5.6.7.8, 192.0.2.7"}}));
+  OATPP_ASSERT(shed && shed->getStatus().code == 429);
+
+  OATPP_ASSERT(auth.outcomeCount(AuthInterceptor::Outcome::RateLimited) == 2);
+  OATPP_ASSERT(auth.outcomeCount(AuthInterceptor::Outcome::Accepted) == 3);
+  OATPP_ASSERT(auth.outcomeCount(AuthInterceptor::Outcome::InvalidToken) == 3);
+}
+
+/**
+ * Test 4: voller Shard übernimmt den am längsten unbenutzten Bucket - ein gedrosselter, aktiver Schlüssel bleibt
+ */
+void RateLimitTest::testLruEviction() {
+  auto t = RateLimiter::Clock::now();
+  RateLimiter limiter({0.001, 1}, 2 * 64); // 2 Buckets pro Shard; Vielfache von 64 landen alle in Shard 0
+  const std::uint64_t attacker = 0;
+  const std::uint64_t idle = 64;
+
+  OATPP_ASSERT(limiter.acquire(attacker, t).allowed);
+  OATPP_ASSERT(limiter.acquire(idle, t).allowed);
+  OATPP_ASSERT(!limiter.acquire(attacker, t).allowed); // gedrosselt und zuletzt benutzt
+  for (std::uint64_t k = 2; k < 100; ++k) {
+    OATPP_ASSERT(limiter.acquire(k * 64, t).allowed);   // neue Schlüssel verdrängen nur den ältesten anderen
+    OATPP_ASSERT(!limiter.acquire(attacker, t).allowed);
+  }
+  OATPP_ASSERT(limiter.size() == 2);
+  OATPP_ASSERT(limiter.acquire(idle, t).allowed); // verdrängt → frischer Bucket
+
+  // IPv4 pro Adresse, IPv6 pro /64
+  OATPP_ASSERT(RateLimiter::hashAddress("2001:db8:1:2::10") == RateLimiter::hashAddress("2001:db8:1:2:ffff::7"));
+  OATPP_ASSERT(RateLimiter::hashAddress("[2001:db8:1:2::1]") == RateLimiter::hashAddress("2001:db8:1:2::"));
+  OATPP_ASSERT(RateLimiter::hashAddress("fe80::1%eth0") == RateLimiter::hashAddress("fe80::2"));
+  OATPP_ASSERT(RateLimiter::hashAddress("2001:db8:1:2::10") != RateLimiter::hashAddress("2001:db8:1:3::10"));
+  OATPP_ASSERT(RateLimiter::hashAddress("::ffff:10.0.0.1") == RateLimiter::hashAddress("10.0.0.1"));
+  OATPP_ASSERT(RateLimiter::hashAddress("10.0.0.1") != RateLimiter::hashAddress("10.0.0.2"));
+  OATPP_ASSERT(RateLimiter::hashAddress("unix-socket") == RateLimiter::hashKey("unix-socket"));
+}
+
+/**
+ * Test 5: IP-Vorfilter über die Peer-Adresse der Verbindung, auch wenn der konfigurierte Header fehlt
+ */
+void RateLimitTest::testPeerAddress() {
+  TestKeys keys;
+  auto cfg = TestKeys::config();
+  cfg->rateLimitIpRps = 0.001;
+  cfg->rateLimitIpBurst = 2;
+  cfg->rateLimitIpHeader = "X-Forwarded-For"; // Requests am Proxy vorbei haben ihn nicht
+  AuthInterceptor auth(std::make_shared<JwtVerifier>(cfg));
+
+  for (const char* peer : {"2001:db8:1:2::10", "2001:db8:1:2::11"}) {
+    auto r = auth.intercept(makePeerRequest("GET", "/api/secure/ping", peer, {{"Authorization", bearer("not-a-jwt")}}));
+    OATPP_ASSERT(r && r->getStatus().code == 401);
+  }
+  auto shed = auth.intercept(makePeerRequest("GET", "/api/secure/ping", "2001:db8:1:2::99", {{"Authorization", bearer("not-a-jwt")}})); // gleiches /64
+  OATPP_ASSERT(shed && shed->getStatus().code == 429);
+  auto other = auth.intercept(makePeerRequest("GET", "/api/secure/ping", "2001:db8:1:3::10", {{"Authorization", bearer("not-a-jwt")}}));
+  OATPP_ASSERT(other && other->getStatus().code == 401);
+
+  // mit Header zählt weiter dessen letzter Eintrag, nicht die Peer-Adresse
+  auto forwarded = auth.intercept(makeRequest("GET", "/api/secure/ping", {{"Authorization", bearer("not-a-jwt")}, {"X-Forwarded-For", "2001:db8:1:2::1, 10.9.8.7"}}));
+  OATPP_ASSERT(forwarded && forwarded->getStatus().code == 401);
+}
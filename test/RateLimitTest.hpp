@@ -0,0 +1,20 @@
+#ifndef RateLimitTest_hpp
+#define RateLimitTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class RateLimitTest : public oatpp::test::UnitTest {
+public:
+  RateLimitTest() : UnitTest("TEST[RateLimitTest]") {}
+
+  void onRun() override;
+
+private:
+  void testTokenBucket();
+  void testEviction();
+  void testAuthInterceptor();
+  void testLruEviction();
+  void testPeerAddress();
+};
+
+#endif // RateLimitTest_hpp
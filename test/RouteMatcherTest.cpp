@@ -0,0 +1,53 @@
+#include "RouteMatcherTest.hpp"
+#include "auth/RouteMatcher.hpp"
+
+void RouteMatcherTest::onRun() {
+
+  RouteMatcher m;
+  OATPP_ASSERT(m.empty());
+
+  m.addPrefix("/api/secure/");
+  m.addPrefix("/admin");
+  m.addEndpointPath("/api/public/me");
+  m.addEndpointPath("/api/students/{id}/grades");
+  m.addEndpointPath("/api/courses/{id}");
+  m.addEndpointPath("/api/files/*");
+  m.addEndpointPath("/api/docs/{name}.json");
+  OATPP_ASSERT(!m.empty());
+
+  // Präfixe
+  OATPP_ASSERT(m.matches("/api/secure/ping"));
+  OATPP_ASSERT(m.matches("/api/secure/"));
+  OATPP_ASSERT(m.matches("/admin/users?x=1"));
+  OATPP_ASSERT(!m.matches("/api/secure"));
+  OATPP_ASSERT(!m.matches("/api/public/ping"));
+  OATPP_ASSERT(!m.matches("/"));
+
+  // exakte Endpoint-Pfade, Query wird ignoriert
+  OATPP_ASSERT(m.matches("/api/public/me"));
+  OATPP_ASSERT(m.matches("/api/public/me?verbose"));
+  OATPP_ASSERT(!m.matches("/api/public/me/x"));
+  OATPP_ASSERT(!m.matches("/api/public/m"));
+
+  // Templates Segment für Segment: Variable = ein nicht leeres Segment ohne '/'
+  OATPP_ASSERT(m.matches("/api/students/42/grades"));
+  OATPP_ASSERT(m.matches("/api/students/42/grades?all"));
+  OATPP_ASSERT(!m.matches("/api/students"));
+  OATPP_ASSERT(!m.matches("/api/students/42"));
+  OATPP_ASSERT(!m.matches("/api/students//grades"));
+  OATPP_ASSERT(!m.matches("/api/students/4/2/grades"));
+  OATPP_ASSERT(!m.matches("/api/students/42/gradesx"));
+  OATPP_ASSERT(m.matches("/api/courses/7"));
+  OATPP_ASSERT(!m.matches("/api/courses/"));
+  OATPP_ASSERT(!m.matches("/api/courses/7/x"));
+  OATPP_ASSERT(!m.matches("/api/coursesx"));
+  OATPP_ASSERT(m.matches("/api/docs/a.b.json")); // Variable vor Literal im selben Segment
+  OATPP_ASSERT(!m.matches("/api/docs/.json"));
+  OATPP_ASSERT(!m.matches("/api/docs/a/b.json"));
+
+  // "*" am Ende schützt den ganzen Rest
+  OATPP_ASSERT(m.matches("/api/files/"));
+  OATPP_ASSERT(m.matches("/api/files/a/b/c"));
+  OATPP_ASSERT(!m.matches("/api/files"));
+
+}
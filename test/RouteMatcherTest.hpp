@@ -0,0 +1,13 @@
+#ifndef RouteMatcherTest_hpp
+#define RouteMatcherTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class RouteMatcherTest : public oatpp::test::UnitTest {
+public:
+  RouteMatcherTest() : UnitTest("TEST[RouteMatcherTest]") {}
+
+  void onRun() override;
+};
+
+#endif // RouteMatcherTest_hpp
@@ -0,0 +1,374 @@
+#include "StudentRepositoryTest.hpp"
+
+#include "controller/StudentController.hpp"
+#include "app/TestKeys.hpp"
+#include "app/TestRequest.hpp"
+#include "model/StudentRepository.hpp"
+
+#include "oatpp/web/server/HttpRouter.hpp"
+#include "oatpp/json/ObjectMapper.hpp"
+
+#include <atomic>
+#include <climits>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+model::StudentRecord student(std::int32_t id, const std::string& firstName, double gpa = 3.0) {
+  model::StudentRecord r;
+  r.id = id;
+  r.firstName = firstName;
+  r.lastName = "Muster";
+  r.age = 21;
+  r.gpa = gpa;
+  r.university = model::SymbolTable::global().intern("TU Berlin");
+  r.courses.add(model::SymbolTable::global().intern("Analysis"));
+  r.courses.add(model::SymbolTable::global().intern("Informatik"));
+  return r;
+}
+
+std::int32_t statusOf(const std::function<void()>& call) {
+  try {
+    call();
+  } catch (const oatpp::web::protocol::http::HttpError& e) {
+    return e.getInfo().status.code;
+  }
+  return 0;
+}
+
+}
+
+void StudentRepositoryTest::onRun() {
+  testIdIndex();
+  testCrud();
+  testConcurrentAccess();
+  testController();
+  testControllerAuth();
+  testLimits();
+  testInterning();
+}
+
+/**
+ * Test 1: IdIndex - Wachstum, Überschreiben, Löschen per Backward Shift (auch bei vollen Sondierketten)
+ */
+void StudentRepositoryTest::testIdIndex() {
+  model::IdIndex index;
+  OATPP_ASSERT(index.find(1) == model::IdIndex::kNone);
+
+  for (std::int32_t id = 1; id <= 100000; ++id) index.put(id * 7, (std::uint32_t) id);
+  OATPP_ASSERT(index.size() == 100000);
+  for (std::int32_t id = 1; id <= 100000; ++id) OATPP_ASSERT(index.find(id * 7) == (std::uint32_t) id);
+  OATPP_ASSERT(index.find(8) == model::IdIndex::kNone);
+
+  index.put(7, 42);
+  OATPP_ASSERT(index.size() == 100000 && index.find(7) == 42);
+
+  // jede zweite löschen, der Rest muss weiter auffindbar sein
+  for (std::int32_t id = 2; id <= 100000; id += 2) OATPP_ASSERT(index.erase(id * 7));
+  OATPP_ASSERT(!index.erase(14));
+  OATPP_ASSERT(index.size() == 50000);
+  for (std::int32_t id = 3; id <= 100000; id += 2) OATPP_ASSERT(index.find(id * 7) == (std::uint32_t) id);
+  for (std::int32_t id = 2; id <= 100000; id += 2) OATPP_ASSERT(index.find(id * 7) == model::IdIndex::kNone);
+}
+
+/**
+ * Test 2: Repository - ID-Vergabe, Konflikte, Update, Löschen hält das Array dicht, Pagination
+ */
+void StudentRepositoryTest::testCrud() {
+  model::StudentRepository repo;
+
+  OATPP_ASSERT(*repo.create(student(0, "Anna")) == 1);
+  OATPP_ASSERT(*repo.create(student(10, "Ben")) == 10);
+  OATPP_ASSERT(!repo.create(student(10, "Doppelt")));
+  OATPP_ASSERT(*repo.create(student(0, "Clara")) == 2); // Client-IDs verschieben den Zähler nicht
+  OATPP_ASSERT(repo.size() == 3);
+
+  auto ben = repo.find(10);
+  OATPP_ASSERT(ben && ben->firstName == "Ben" && ben->courses.size() == 2);
+
+  auto changed = student(10, "Benedikt", 3.9);
+  OATPP_ASSERT(repo.update(changed));
+  OATPP_ASSERT(!repo.update(student(99, "Niemand")));
+  std::string name;
+  OATPP_ASSERT(repo.read(10, [&](const model::StudentRecord& r) { name = r.firstName; }));
+  OATPP_ASSERT(name == "Benedikt");
+
+  OATPP_ASSERT(repo.remove(1));
+  OATPP_ASSERT(!repo.remove(1));
+  OATPP_ASSERT(!repo.find(1));
+  OATPP_ASSERT(repo.find(2)->firstName == "Clara"); // an die freie Stelle verschoben, Index aktualisiert
+
+  for (int i = 0; i < 100; ++i) repo.create(student(0, "S" + std::to_string(i)));
+  std::vector<std::int32_t> ids;
+  OATPP_ASSERT(repo.page(10, 25, [&](const model::StudentRecord& r) { ids.push_back(r.id); }) == 102);
+  OATPP_ASSERT(ids.size() == 25);
+  ids.clear();
+  repo.page(95, 25, [&](const model::StudentRecord& r) { ids.push_back(r.id); });
+  OATPP_ASSERT(ids.size() == 7);
+  ids.clear();
+  repo.page(500, 25, [&](const model::StudentRecord& r) { ids.push_back(r.id); });
+  OATPP_ASSERT(ids.empty());
+}
+
+/**
+ * Test 3: parallele Leser und Schreiber - keine verlorenen Datensätze, Leser sehen nur vollständige
+ */
+void StudentRepositoryTest::testConcurrentAccess() {
+  model::StudentRepository repo;
+  repo.reserve(4 * 5000);
+
+  std::atomic<bool> done{false};
+  std::atomic<std::int64_t> torn{0};
+  std::thread reader([&] {
+    while (!done.load()) {
+      repo.page(0, 100, [&](const model::StudentRecord& r) {
+        if (r.firstName != "W" + std::to_string((r.id - 1) % 4)) torn.fetch_add(1);
+      });
+    }
+  });
+
+  std::vector<std::thread> writers;
+  for (int w = 0; w < 4; ++w) {
+    writers.emplace_back([&repo, w] {
+      for (int i = 0; i < 5000; ++i) {
+        const std::int32_t id = 1 + i * 4 + w;
+        repo.create(student(id, "W" + std::to_string(w)));
+        if (i % 5 == 0) repo.remove(id);
+      }
+    });
+  }
+  for (auto& t : writers) t.join();
+  done = true;
+  reader.join();
+
+  OATPP_ASSERT(torn == 0);
+  OATPP_ASSERT(repo.size() == 4 * 4000);
+  std::unordered_set<std::int32_t> seen;
+  repo.page(0, SIZE_MAX, [&](const model::StudentRecord& r) { seen.insert(r.id); });
+  OATPP_ASSERT(seen.size() == 4 * 4000);
+}
+
+/**
+ * Test 4: StudentController - Statuscodes (201/404/409/400), Pagination und Top-k über den Router inkl. Query
+ */
+void StudentRepositoryTest::testController() {
+  auto mappers = std::make_shared<oatpp::web::mime::ContentMappers>();
+  mappers->putMapper(std::make_shared<oatpp::json::ObjectMapper>());
+  auto repo = std::make_shared<model::StudentRepository>();
+  auto leaderboard = std::make_shared<model::Leaderboard>();
+  repo->setLeaderboard(leaderboard);
+  auto controller = std::make_shared<StudentController>(mappers, repo, leaderboard);
+
+  auto dto = StudentDto::createShared();
+  dto->firstName = "Anna";
+  dto->lastName = "Schmidt";
+  dto->gpa = 3.7;
+  dto->courses = oatpp::List<oatpp::String>::createShared();
+  dto->courses->push_back("Analysis");
+  dto->courses->push_back("Analysis");
+
+  const auto& mapper = mappers->getDefaultMapper();
+  auto post = [&] { return controller->createStudent(makeBodyRequest("POST", "/api/students", mapper->writeToString(dto))); };
+  auto put = [&](std::int32_t id) {
+    return controller->updateStudent(id, makeBodyRequest("PUT", "/api/students", mapper->writeToString(dto)));
+  };
+
+  auto created = post();
+  OATPP_ASSERT(created->getStatus().code == 201);
+  OATPP_ASSERT(created->getHeader("Location") == "/api/students/1");
+  OATPP_ASSERT(repo->find(1)->courses.size() == 1); // doppelte Kurse zusammengefasst
+  OATPP_ASSERT(repo->find(1)->courses.contains(model::SymbolTable::global().find("Analysis")));
+
+  dto->id = 1;
+  OATPP_ASSERT(statusOf([&] { post(); }) == 409);
+  dto->lastName = nullptr;
+  OATPP_ASSERT(statusOf([&] { post(); }) == 400);
+  dto->lastName = "Meyer";
+
+  OATPP_ASSERT(controller->getStudent(1)->getStatus().code == 200);
+  OATPP_ASSERT(statusOf([&] { controller->getStudent(2); }) == 404);
+  OATPP_ASSERT(put(1)->getStatus().code == 200);
+  OATPP_ASSERT(repo->find(1)->lastName == "Meyer");
+  OATPP_ASSERT(statusOf([&] { put(2); }) == 404);
+
+  for (int i = 0; i < 30; ++i) {
+    dto->id = nullptr;
+    post();
+  }
+
+  auto router = oatpp::web::server::HttpRouter::createShared();
+  router->addController(controller);
+  auto route = router->getRoute("GET", "/api/students?offset=5&limit=10");
+  OATPP_ASSERT(route);
+  auto request = makeRequest("GET", "/api/students?offset=5&limit=10");
+  request->setPathVariables(route.getMatchMap());
+  auto listed = controller->listStudents(request);
+  const auto& body = listed->getBody();
+  auto page = mapper->readFromString<oatpp::Object<StudentPageDto>>(
+    oatpp::String(reinterpret_cast<const char*>(body->getKnownData()), body->getKnownSize()));
+  OATPP_ASSERT(page->total == 31 && page->offset == 5 && page->limit == 10);
+  OATPP_ASSERT(page->items->size() == 10);
+
+  auto bad = makeRequest("GET", "/api/students?limit=-1");
+  bad->setPathVariables(router->getRoute("GET", "/api/students?limit=-1").getMatchMap());
+  OATPP_ASSERT(statusOf([&] { controller->listStudents(bad); }) == 400);
+
+  // Leaderboard: höhere GPA zuerst, "top" wird nicht als id geroutet
+  dto->gpa = 4.0;
+  put(5);
+  auto topRoute = router->getRoute("GET", "/api/students/top?k=2");
+  OATPP_ASSERT(topRoute);
+  auto topRequest = makeRequest("GET", "/api/students/top?k=2");
+  topRequest->setPathVariables(topRoute.getMatchMap());
+  auto topResponse = topRoute.getEndpoint()->handle(topRequest); // über die Route: falsches Ziel → 400
+  const auto& topBody = topResponse->getBody();
+  auto top = mapper->readFromString<oatpp::List<oatpp::Object<StudentDto>>>(
+    oatpp::String(reinterpret_cast<const char*>(topBody->getKnownData()), topBody->getKnownSize()));
+  OATPP_ASSERT(top->size() == 2 && top[0]->id == 5 && top[1]->id == 1);
+
+  OATPP_ASSERT(controller->deleteStudent(1)->getStatus().code == 204);
+  OATPP_ASSERT(leaderboard->size() == 30);
+  OATPP_ASSERT(statusOf([&] { controller->deleteStudent(1); }) == 404);
+  OATPP_ASSERT(repo->size() == 30);
+}
+
+/**
+ * Test 5: alle Student-Endpoints sind per protectEndpoints geschützt - ohne Token 401, andere Pfade unberührt
+ */
+void StudentRepositoryTest::testControllerAuth() {
+  auto mappers = std::make_shared<oatpp::web::mime::ContentMappers>();
+  mappers->putMapper(std::make_shared<oatpp::json::ObjectMapper>());
+  auto repo = std::make_shared<model::StudentRepository>();
+  auto leaderboard = std::make_shared<model::Leaderboard>();
+  auto controller = std::make_shared<StudentController>(mappers, repo, leaderboard);
+
+  AuthInterceptor auth(std::make_shared<JwtVerifier>(TestKeys::config()));
+  auth.protectEndpoints(controller);
+
+  const char* calls[][2] = {
+    {"POST", "/api/students"}, {"GET", "/api/students?offset=0"}, {"GET", "/api/students/top?k=3"},
+    {"GET", "/api/students/7"}, {"PUT", "/api/students/7"}, {"DELETE", "/api/students/7"},
+  };
+  for (const auto& call : calls) {
+    auto response = auth.intercept(makeRequest(call[0], call[1]));
+    OATPP_ASSERT(response && response->getStatus().code == 401);
+  }
+  OATPP_ASSERT(auth.intercept(makeRequest("GET", "/api/public/ping")) == nullptr);
+  OATPP_ASSERT(auth.intercept(makeRequest("GET", "/api/studentsx")) == nullptr);
+}
+
+/**
+ * Test 6: Grenzen - Client-ID INT32_MAX verbraucht keine IDs, Speicherdeckel → 507, Body-Größe 411/413, Überlauf → 400
+ */
+void StudentRepositoryTest::testLimits() {
+  {
+    model::StudentRepository repo(4);
+    OATPP_ASSERT(*repo.create(student(INT32_MAX, "Max")) == INT32_MAX);
+    OATPP_ASSERT(*repo.create(student(0, "Auto")) == 1);
+    OATPP_ASSERT(*repo.create(student(2, "Client")) == 2);
+    OATPP_ASSERT(*repo.create(student(0, "Auto")) == 3); // belegte 2 übersprungen
+    OATPP_ASSERT(repo.create(student(0, "Voll")).status == model::CreateResult::Status::Full);
+    OATPP_ASSERT(repo.create(student(1, "Doppelt")).status == model::CreateResult::Status::Full);
+    OATPP_ASSERT(repo.remove(2));
+    OATPP_ASSERT(repo.create(student(1, "Doppelt")).status == model::CreateResult::Status::IdTaken);
+    OATPP_ASSERT(*repo.create(student(0, "Auto")) == 4); // der Zähler läuft nur vorwärts
+  }
+
+  auto mappers = std::make_shared<oatpp::web::mime::ContentMappers>();
+  mappers->putMapper(std::make_shared<oatpp::json::ObjectMapper>());
+  auto repo = std::make_shared<model::StudentRepository>(2);
+  auto leaderboard = std::make_shared<model::Leaderboard>();
+  repo->setLeaderboard(leaderboard);
+  auto controller = std::make_shared<StudentController>(mappers, repo, leaderboard);
+  auto post = [&](const char* body) { return controller->createStudent(makeBodyRequest("POST", "/api/students", body)); };
+
+  OATPP_ASSERT(post(R"({"id":2147483647,"firstName":"Max","lastName":"Muster"})")->getStatus().code == 201);
+  OATPP_ASSERT(post(R"({"firstName":"Auto","lastName":"Muster"})")->getHeader("Location") == "/api/students/1");
+  OATPP_ASSERT(statusOf([&] { post(R"({"firstName":"Voll","lastName":"Muster"})"); }) == 507);
+  OATPP_ASSERT(statusOf([&] { post(R"({"id":1,"firstName":"Voll","lastName":"Muster"})"); }) == 507);
+  OATPP_ASSERT(repo->remove(1));
+  OATPP_ASSERT(statusOf([&] { post(R"({"id":2147483647,"firstName":"Max","lastName":"Muster"})"); }) == 409);
+
+  const std::string large = R"({"firstName":")" + std::string(StudentController::kMaxBodyBytes, 'x') + R"(","lastName":"M"})";
+  OATPP_ASSERT(statusOf([&] { post(large.c_str()); }) == 413);
+  auto chunked = makeBodyRequest("POST", "/api/students", R"({"firstName":"A","lastName":"B"})",
+                                 {{"Transfer-Encoding", "chunked"}});
+  OATPP_ASSERT(statusOf([&] { controller->createStudent(chunked); }) == 411);
+  auto bogus = makeBodyRequest("POST", "/api/students", R"({"firstName":"A","lastName":"B"})");
+  bogus->putOrReplaceHeader("Content-Length", "99999999999999999999999");
+  OATPP_ASSERT(statusOf([&] { controller->createStudent(bogus); }) == 400);
+
+  auto router = oatpp::web::server::HttpRouter::createShared();
+  router->addController(controller);
+  const char* path = "/api/students?limit=99999999999999999999999";
+  auto request = makeRequest("GET", path);
+  request->setPathVariables(router->getRoute("GET", path).getMatchMap());
+  OATPP_ASSERT(statusOf([&] { controller->listStudents(request); }) == 400);
+}
+
+/**
+ * Test 7: Namen werden erst nach Prüfung und nur bei gelungenem Schreiben interniert; SymbolTable-Bytegrenze,
+ * internAll ganz oder gar nicht; Kurse in Body-Reihenfolge
+ */
+void StudentRepositoryTest::testInterning() {
+  {
+    model::SymbolTable table(100, 8);
+    const auto abcd = table.intern("abcd");
+    OATPP_ASSERT(abcd != model::kNoSymbol && table.intern("efgh") != model::kNoSymbol);
+    OATPP_ASSERT(table.intern("i") == model::kNoSymbol); // 8 Bytes belegt
+    OATPP_ASSERT(table.intern("abcd") == abcd && table.size() == 2);
+  }
+  {
+    // internAll: ganz oder gar nicht (die Universität bleibt nicht hängen, wenn ein Kurs nicht mehr passt)
+    model::SymbolTable table(3, 100);
+    std::vector<model::SymbolId> ids;
+    OATPP_ASSERT(table.internAll({"Uni", "K1", "Uni"}, ids));
+    OATPP_ASSERT(ids.size() == 3 && ids[0] == ids[2] && ids[0] != ids[1] && table.size() == 2);
+    OATPP_ASSERT(!table.internAll({"Uni", "K2", "K3"}, ids));
+    OATPP_ASSERT(table.size() == 2 && table.find("K2") == model::kNoSymbol);
+    OATPP_ASSERT(table.internAll({"K2", "K1", "K2"}, ids) && table.size() == 3);
+    OATPP_ASSERT(!table.internAll({"K4"}, ids));
+  }
+
+  auto mappers = std::make_shared<oatpp::web::mime::ContentMappers>();
+  mappers->putMapper(std::make_shared<oatpp::json::ObjectMapper>());
+  auto repo = std::make_shared<model::StudentRepository>(2);
+  auto leaderboard = std::make_shared<model::Leaderboard>();
+  auto controller = std::make_shared<StudentController>(mappers, repo, leaderboard);
+  auto post = [&](const std::string& body) {
+    return controller->createStudent(makeBodyRequest("POST", "/api/students", body.c_str()));
+  };
+  auto put = [&](std::int32_t id, const std::string& body) {
+    return controller->updateStudent(id, makeBodyRequest("PUT", "/api/students", body.c_str()));
+  };
+  const auto& symbols = model::SymbolTable::global();
+
+  OATPP_ASSERT(post(R"({"id":1,"firstName":"A","lastName":"B","courses":["Intern-1"]})")->getStatus().code == 201);
+  OATPP_ASSERT(symbols.find("Intern-1") != model::kNoSymbol);
+
+  OATPP_ASSERT(statusOf([&] { post(R"({"id":1,"firstName":"A","lastName":"B","courses":["Intern-409"]})"); }) == 409);
+  OATPP_ASSERT(statusOf([&] { put(2, R"({"firstName":"A","lastName":"B","university":"Intern-404"})"); }) == 404);
+  OATPP_ASSERT(statusOf([&] {
+    post(R"({"firstName":")" + std::string(StudentController::kMaxNameLength + 1, 'x')
+         + R"(","lastName":"B","courses":["Intern-400"]})");
+  }) == 400);
+  std::string courses = R"("Intern-Viele")";
+  for (std::size_t i = 0; i < StudentController::kMaxCourses; ++i) courses += R"(,"Kurs")";
+  OATPP_ASSERT(statusOf([&] { post(R"({"firstName":"A","lastName":"B","courses":[)" + courses + "]}"); }) == 400);
+  OATPP_ASSERT(post(R"({"firstName":"C","lastName":"D"})")->getStatus().code == 201);
+  OATPP_ASSERT(statusOf([&] { post(R"({"firstName":"A","lastName":"B","courses":["Intern-507"]})"); }) == 507);
+  for (const char* name : {"Intern-409", "Intern-404", "Intern-400", "Intern-Viele", "Intern-507"}) {
+    OATPP_ASSERT(symbols.find(name) == model::kNoSymbol);
+  }
+
+  auto updated = put(1, R"({"firstName":"A","lastName":"B","university":"Intern-U","courses":["Intern-2","Intern-1","Intern-2"]})");
+  OATPP_ASSERT(updated->getStatus().code == 200);
+  OATPP_ASSERT(repo->find(1)->university == symbols.find("Intern-U"));
+  const auto stored = repo->find(1)->courses;
+  OATPP_ASSERT(std::vector<model::SymbolId>(stored.begin(), stored.end())
+               == (std::vector<model::SymbolId>{symbols.find("Intern-2"), symbols.find("Intern-1")})); // Body-Reihenfolge
+}
@@ -0,0 +1,22 @@
+#ifndef StudentRepositoryTest_hpp
+#define StudentRepositoryTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class StudentRepositoryTest : public oatpp::test::UnitTest {
+public:
+  StudentRepositoryTest() : UnitTest("TEST[StudentRepositoryTest]") {}
+
+  void onRun() override;
+
+private:
+  void testIdIndex();
+  void testCrud();
+  void testConcurrentAccess();
+  void testController();
+  void testControllerAuth();
+  void testLimits();
+  void testInterning();
+};
+
+#endif // StudentRepositoryTest_hpp
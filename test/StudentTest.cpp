@@ -7,9 +7,9 @@
 void StudentTest::onRun() {
     testBasicConstructors();
     testCopyAndMoveSemantics();
-    testSmartPointerManagement();
+    testCourseMembership();
     testCourseManagement();
-    testUniversitySharedPointer();
+    testUniversityInterning();
     testOperatorOverloading();
     testContainerOperations();
 }
@@ -91,15 +91,14 @@ void StudentTest::testCopyAndMoveSemantics() {
 }
 
 /**
- * Test 3: Smart Pointer Management
+ * Test 3: Kurse als internierte IDs (Mitgliedschaft ohne String-Vergleich)
  */
-void StudentTest::testSmartPointerManagement() {
-    std::cout << "\n=== Test 3: Smart Pointer Management ===" << std::endl;
+void StudentTest::testCourseMembership() {
+    std::cout << "\n=== Test 3: Course Membership ===" << std::endl;
     
-    // Unique Pointer wird intern für courses verwendet
     model::Student student(1, "Alice", "Wonder", 21, 3.6);
     
-    // Courses hinzufügen (demonstriert unique_ptr usage)
+    // Courses hinzufügen (Namen werden interniert)
     student.addCourse("Data Structures");
     student.addCourse("Algorithms");
     student.addCourse("Computer Networks");
@@ -109,6 +108,18 @@ void StudentTest::testSmartPointerManagement() {
     auto courses = student.getCourses();
     OATPP_ASSERT(courses.size() == 3);
     OATPP_ASSERT(std::find(courses.begin(), courses.end(), "Algorithms") != courses.end());
+    OATPP_ASSERT(student.hasCourse("Algorithms"));
+    OATPP_ASSERT(student.hasCourse(model::SymbolTable::global().find("Algorithms")));
+    OATPP_ASSERT(!student.hasCourse("Never Added Anywhere"));
+    OATPP_ASSERT(model::SymbolTable::global().find("Never Added Anywhere") == model::kNoSymbol); // nicht angelegt
+    
+    // Einfügereihenfolge bleibt erhalten (nicht die Reihenfolge der IDs)
+    OATPP_ASSERT(courses == (std::vector<std::string>{"Data Structures", "Algorithms", "Computer Networks"}));
+    model::Student reordered(2, "Alice", "Wonder", 21, 3.6);
+    reordered.addCourse("Computer Networks");
+    reordered.addCourse("Data Structures");
+    reordered.addCourse("Algorithms");
+    OATPP_ASSERT(reordered.getCourseIds() == student.getCourseIds()); // Vergleich als Menge
     
     // Course entfernen
     student.removeCourse("Data Structures");
@@ -117,6 +128,9 @@ void StudentTest::testSmartPointerManagement() {
     // Nicht existierenden Course entfernen
     student.removeCourse("NonExistent");
     OATPP_ASSERT(student.getCourseCount() == 2); // Unverändert
+    OATPP_ASSERT(model::SymbolTable::global().find("NonExistent") == model::kNoSymbol);
+    OATPP_ASSERT(!student.hasCourse("Data Structures"));
+    OATPP_ASSERT(student.getCourses() == (std::vector<std::string>{"Algorithms", "Computer Networks"}));
 }
 
 /**
@@ -155,37 +169,44 @@ void StudentTest::testCourseManagement() {
 }
 
 /**
- * Test 5: Shared Pointer für University
+ * Test 5: Internierte Universität (eine ID pro Name, von Kopien geteilt)
  */
-void StudentTest::testUniversitySharedPointer() {
-    std::cout << "\n=== Test 5: Shared Pointer University ===" << std::endl;
-    
-    // Shared pointer für Universität erstellen
-    auto university = std::make_shared<std::string>("Technische Universität München");
+void StudentTest::testUniversityInterning() {
+    std::cout << "\n=== Test 5: Interned University ===" << std::endl;
     
     model::Student student1(1, "Klaus", "Müller", 23, 3.4);
     model::Student student2(2, "Lisa", "Weber", 22, 3.8);
+    OATPP_ASSERT(student1.getUniversity() == "Keine Universität");
+    OATPP_ASSERT(student1.getUniversityId() == model::kNoSymbol);
     
-    // Beide Studenten teilen sich die gleiche Universität
-    student1.setUniversity(university);
-    student2.setUniversity(university);
-    
-    OATPP_ASSERT(student1.getUniversity() == "Technische Universität München");
-    OATPP_ASSERT(student2.getUniversity() == "Technische Universität München");
+    // Beide Studenten teilen sich die gleiche Universität → gleiche ID, ein String
+    const std::string tum = "Technische Universität München";
+    student1.setUniversity(tum);
+    student2.setUniversity(tum);
     
-    // Reference count sollte 3 sein (university + 2 studenten)
-    OATPP_ASSERT(university.use_count() == 3);
+    OATPP_ASSERT(student1.getUniversity() == tum);
+    OATPP_ASSERT(student2.getUniversity() == tum);
+    OATPP_ASSERT(student1.getUniversityId() == student2.getUniversityId());
+    OATPP_ASSERT(&model::SymbolTable::global().name(student1.getUniversityId())
+                 == &model::SymbolTable::global().name(student2.getUniversityId()));
     
-    // Student kopieren - shared_ptr wird geteilt
+    // Student kopieren - ID wird übernommen
     model::Student student3 = student1;
-    OATPP_ASSERT(student3.getUniversity() == "Technische Universität München");
-    OATPP_ASSERT(university.use_count() == 4);
+    OATPP_ASSERT(student3.getUniversityId() == student1.getUniversityId());
     
-    // Universität ändern
-    *university = "Ludwig-Maximilians-Universität München";
-    OATPP_ASSERT(student1.getUniversity() == "Ludwig-Maximilians-Universität München");
+    // Universität wechseln betrifft nur diesen Studenten
+    student2.setUniversity("Ludwig-Maximilians-Universität München");
+    OATPP_ASSERT(student1.getUniversity() == tum);
     OATPP_ASSERT(student2.getUniversity() == "Ludwig-Maximilians-Universität München");
-    OATPP_ASSERT(student3.getUniversity() == "Ludwig-Maximilians-Universität München");
+    OATPP_ASSERT(student2.getUniversityId() != student1.getUniversityId());
+    
+    // Symboltabelle: gleiche Namen → gleiche ID, Deckel greift
+    model::SymbolTable table(2);
+    const auto a = table.intern("A");
+    OATPP_ASSERT(table.intern("A") == a);
+    OATPP_ASSERT(table.intern("B") != a);
+    OATPP_ASSERT(table.intern("C") == model::kNoSymbol);
+    OATPP_ASSERT(table.size() == 2 && table.name(a) == "A");
 }
 
 /**
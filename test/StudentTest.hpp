@@ -22,9 +22,9 @@ private:
     // Private Test-Methoden für bessere Organisation
     void testBasicConstructors();
     void testCopyAndMoveSemantics();
-    void testSmartPointerManagement();
+    void testCourseMembership();
     void testCourseManagement();
-    void testUniversitySharedPointer();
+    void testUniversityInterning();
     void testOperatorOverloading();
     void testContainerOperations();
 };
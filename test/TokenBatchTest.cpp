@@ -0,0 +1,119 @@
+#include "TokenBatchTest.hpp"
+
+#include "auth/JwtVerifier.hpp"
+#include "controller/TokenController.hpp"
+#include "util/WorkerPool.hpp"
+#include "app/TestKeys.hpp"
+#include "app/TestRequest.hpp"
+
+#include "oatpp/json/ObjectMapper.hpp"
+
+#include <atomic>
+#include <string>
+
+void TokenBatchTest::onRun() {
+  testWorkerPool();
+  testVerifyBatch();
+  testController();
+}
+
+/**
+ * Test 1: parallelFor besucht jeden Index genau einmal, auch bei mehr Indizes als Threads
+ */
+void TokenBatchTest::testWorkerPool() {
+  WorkerPool pool(3);
+  for (std::size_t n : {0, 1, 2, 3, 17, 1000}) {
+    std::vector<std::atomic<int>> visits(n);
+    pool.parallelFor(n, [&](std::size_t i) { visits[i].fetch_add(1); });
+    for (auto& v : visits) OATPP_ASSERT(v.load() == 1);
+  }
+}
+
+/**
+ * Test 2: gemischter Batch → Ergebnis pro Token in Eingabereihenfolge
+ */
+void TokenBatchTest::testVerifyBatch() {
+  TestKeys keys("kid-a");
+  TestKeys otherKeys("kid-b"); // nicht im JWKS, Reload gegen Port 9 schlägt fehl
+  auto cfg = TestKeys::config();
+
+  JwtVerifier verifier(cfg);
+  verifier.jwks().load(keys.jwks(), 15);
+  WorkerPool pool(4);
+
+  const auto alice = keys.sign(*cfg, "alice");
+  const auto bob = keys.sign(*cfg, "bob");
+  const auto expired = keys.sign(*cfg, "carol", std::chrono::hours(-1));
+  const auto unknownKid = otherKeys.sign(*cfg, "dave");
+
+  std::vector<std::string_view> tokens = {alice, bob, "not-a-jwt", expired, alice, unknownKid, ""};
+  for (int i = 0; i < 20; ++i) tokens.push_back(bob);
+
+  const auto results = verifier.verifyBatch(tokens, &pool);
+  OATPP_ASSERT(results.size() == tokens.size());
+
+  OATPP_ASSERT(results[0].claims && results[0].claims->subject == "alice");
+  OATPP_ASSERT(results[1].claims && results[1].claims->subject == "bob");
+  OATPP_ASSERT(!results[2].claims && !results[2].error.empty());
+  OATPP_ASSERT(!results[3].claims && !results[3].error.empty());
+  OATPP_ASSERT(results[4].claims == results[0].claims); // Duplikat teilt das Ergebnis
+  OATPP_ASSERT(!results[5].claims && !results[5].error.empty());
+  OATPP_ASSERT(!results[6].claims);
+  for (std::size_t i = 7; i < results.size(); ++i) OATPP_ASSERT(results[i].claims == results[1].claims);
+
+  // Batch füllt den TokenCache: zweiter Durchlauf nur Treffer, auch ohne Pool
+  const auto before = verifier.tokenCacheStats();
+  const auto again = verifier.verifyBatch({alice, bob});
+  const auto after = verifier.tokenCacheStats();
+  OATPP_ASSERT(again[0].claims == results[0].claims && again[1].claims == results[1].claims);
+  OATPP_ASSERT(after.hits - before.hits == 2 && after.misses == before.misses);
+}
+
+/**
+ * Test 3: TokenController - nur mit Bearer Token, Batch-Grenze, Fehler nur als feste Gründe
+ */
+void TokenBatchTest::testController() {
+  TestKeys keys("kid-a");
+  TestKeys otherKeys("kid-b");
+  auto cfg = TestKeys::config();
+  auto verifier = std::make_shared<JwtVerifier>(cfg);
+  verifier->jwks().load(keys.jwks(), 15);
+  auto mappers = std::make_shared<oatpp::web::mime::ContentMappers>();
+  mappers->putMapper(std::make_shared<oatpp::json::ObjectMapper>());
+  auto controller = std::make_shared<TokenController>(mappers, verifier, std::make_shared<WorkerPool>(2));
+
+  AuthInterceptor auth(verifier);
+  auth.protectEndpoints(controller);
+  const auto alice = keys.sign(*cfg, "alice");
+  auto denied = auth.intercept(makeRequest("POST", "/api/tokens/verify"));
+  OATPP_ASSERT(denied && denied->getStatus().code == 401);
+  OATPP_ASSERT(auth.intercept(makeRequest("POST", "/api/tokens/verify", {{"Authorization", oatpp::String("Bearer " + alice)}})) == nullptr);
+
+  auto body = TokenVerifyRequestDto::createShared();
+  body->tokens = oatpp::List<oatpp::String>::createShared();
+  for (const auto& t : {alice, std::string("not-a-jwt"), keys.sign(*cfg, "carol", std::chrono::hours(-1)),
+                        otherKeys.sign(*cfg, "dave")}) {
+    body->tokens->push_back(t);
+  }
+  auto response = controller->verifyTokens(body);
+  const auto& raw = response->getBody();
+  auto results = mappers->getDefaultMapper()->readFromString<oatpp::Object<TokenVerifyResponseDto>>(
+    oatpp::String(reinterpret_cast<const char*>(raw->getKnownData()), raw->getKnownSize()))->results;
+  OATPP_ASSERT(results->size() == 4);
+  OATPP_ASSERT(results[0]->valid && results[0]->sub == "alice" && !results[0]->error);
+  OATPP_ASSERT(!results[1]->valid && results[1]->error == "invalid");
+  OATPP_ASSERT(results[2]->error == "expired");
+  OATPP_ASSERT(results[3]->error == "invalid" || results[3]->error == "unavailable"); // kein "kid not found in JWKS"
+
+  OATPP_ASSERT(std::string(TokenController::publicReason("token issued in the future")) == "not yet valid");
+  OATPP_ASSERT(std::string(TokenController::publicReason("kid not found in JWKS")) == "invalid");
+
+  while (body->tokens->size() <= cfg->batchMaxTokens) body->tokens->push_back(alice);
+  bool rejected = false;
+  try {
+    controller->verifyTokens(body);
+  } catch (const oatpp::web::protocol::http::HttpError& e) {
+    rejected = e.getInfo().status.code == 400;
+  }
+  OATPP_ASSERT(rejected);
+}
@@ -0,0 +1,18 @@
+#ifndef TokenBatchTest_hpp
+#define TokenBatchTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class TokenBatchTest : public oatpp::test::UnitTest {
+public:
+  TokenBatchTest() : UnitTest("TEST[TokenBatchTest]") {}
+
+  void onRun() override;
+
+private:
+  void testWorkerPool();
+  void testVerifyBatch();
+  void testController();
+};
+
+#endif // TokenBatchTest_hpp
@@ -0,0 +1,77 @@
+#include "TokenCacheTest.hpp"
+#include "auth/TokenCache.hpp"
+
+#include <chrono>
+#include <string>
+
+namespace {
+
+std::int64_t inSeconds(std::int64_t s) {
+  return std::chrono::duration_cast<std::chrono::seconds>(
+    std::chrono::system_clock::now().time_since_epoch()).count() + s;
+}
+
+std::shared_ptr<const VerifiedClaims> claimsFor(const std::string& sub, std::int64_t exp) {
+  auto c = std::make_shared<VerifiedClaims>();
+  c->subject = sub;
+  c->expiresAt = exp;
+  return c;
+}
+
+}
+
+void TokenCacheTest::onRun() {
+  testHitAndMiss();
+  testExpiry();
+  testLruEviction();
+}
+
+/**
+ * Test 1: Treffer liefert dieselben Claims, Zähler stimmen
+ */
+void TokenCacheTest::testHitAndMiss() {
+  TokenCache cache(100, 60);
+
+  OATPP_ASSERT(cache.find("token-a") == nullptr);
+  cache.insert("token-a", claimsFor("alice", inSeconds(3600)));
+
+  auto hit = cache.find("token-a");
+  OATPP_ASSERT(hit);
+  OATPP_ASSERT(hit->subject == "alice");
+  OATPP_ASSERT(cache.find("token-b") == nullptr);
+
+  const auto st = cache.stats();
+  OATPP_ASSERT(st.hits == 1);
+  OATPP_ASSERT(st.misses == 2);
+  OATPP_ASSERT(st.size == 1);
+
+  TokenCache disabled(0, 60);
+  disabled.insert("token-a", claimsFor("alice", inSeconds(3600)));
+  OATPP_ASSERT(disabled.find("token-a") == nullptr);
+}
+
+/**
+ * Test 2: Tokens werden nur bis exp - leeway gehalten
+ */
+void TokenCacheTest::testExpiry() {
+  TokenCache cache(100, 60);
+
+  cache.insert("almost-expired", claimsFor("bob", inSeconds(30)));  // exp - leeway liegt in der Vergangenheit
+  cache.insert("no-exp", claimsFor("bob", 0));
+  OATPP_ASSERT(cache.find("almost-expired") == nullptr);
+  OATPP_ASSERT(cache.find("no-exp") == nullptr);
+  OATPP_ASSERT(cache.stats().size == 0);
+}
+
+/**
+ * Test 3: Kapazität wird eingehalten, zuletzt benutzte Einträge überleben
+ */
+void TokenCacheTest::testLruEviction() {
+  TokenCache cache(16, 0); // 1 Eintrag pro Shard
+
+  for (int i = 0; i < 1000; ++i) {
+    cache.insert("token-" + std::to_string(i), claimsFor("user", inSeconds(3600)));
+  }
+  OATPP_ASSERT(cache.stats().size <= 16);
+  OATPP_ASSERT(cache.find("token-999"));
+}
@@ -0,0 +1,18 @@
+#ifndef TokenCacheTest_hpp
+#define TokenCacheTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class TokenCacheTest : public oatpp::test::UnitTest {
+public:
+  TokenCacheTest() : UnitTest("TEST[TokenCacheTest]") {}
+
+  void onRun() override;
+
+private:
+  void testHitAndMiss();
+  void testExpiry();
+  void testLruEviction();
+};
+
+#endif // TokenCacheTest_hpp
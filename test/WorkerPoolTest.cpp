@@ -0,0 +1,161 @@
+#include "WorkerPoolTest.hpp"
+
+#include "server/ReusePortConnectionProvider.hpp"
+#include "server/WorkerPoolConnectionHandler.hpp"
+#include "app/RawHttpClient.hpp"
+
+#include "oatpp/web/server/api/ApiController.hpp"
+#include "oatpp/network/Server.hpp"
+#include "oatpp/macro/codegen.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include OATPP_CODEGEN_BEGIN(ApiController)
+
+/**
+ * /block hält den Worker, bis release() gerufen wird; /ping antwortet sofort.
+ */
+class PoolTestController : public oatpp::web::server::api::ApiController {
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_released = false;
+public:
+  std::atomic<int> blocked{0};
+public:
+
+  PoolTestController()
+    : oatpp::web::server::api::ApiController(std::make_shared<oatpp::web::mime::ContentMappers>())
+  {}
+
+  void release() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_released = true;
+    }
+    m_cv.notify_all();
+  }
+
+  ENDPOINT("GET", "/block", block) {
+    ++blocked;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this] { return m_released; });
+    return createResponse(Status::CODE_200, "done");
+  }
+
+  ENDPOINT("GET", "/ping", ping) {
+    return createResponse(Status::CODE_200, "pong");
+  }
+
+};
+
+#include OATPP_CODEGEN_END(ApiController)
+
+namespace {
+
+/**
+ * WorkerPoolConnectionHandler auf 127.0.0.1, Port vom Kernel vergeben.
+ */
+class PoolServer {
+private:
+  std::shared_ptr<PoolTestController> m_controller;
+  std::shared_ptr<ReusePortConnectionProvider> m_provider;
+  std::shared_ptr<WorkerPoolConnectionHandler> m_handler;
+  std::shared_ptr<oatpp::network::Server> m_server;
+  std::thread m_thread;
+public:
+
+  explicit PoolServer(const WorkerPoolConnectionHandler::Config& pool)
+    : m_controller(std::make_shared<PoolTestController>())
+  {
+    ServerConfig cfg;
+    cfg.host = "127.0.0.1";
+    m_provider = std::make_shared<ReusePortConnectionProvider>(cfg, 0, false);
+    auto router = oatpp::web::server::HttpRouter::createShared();
+    router->addController(m_controller);
+    m_handler = WorkerPoolConnectionHandler::createShared(router, pool);
+    m_server = std::make_shared<oatpp::network::Server>(m_provider, m_handler);
+    m_thread = std::thread([server = m_server] { server->run(); });
+  }
+
+  ~PoolServer() {
+    m_controller->release();
+    m_server->stop();
+    m_provider->stop();
+    m_handler->stop();
+    m_thread.join();
+  }
+
+  std::uint16_t port() const { return m_provider->port(); }
+  PoolTestController& controller() { return *m_controller; }
+  WorkerPoolConnectionHandler& handler() { return *m_handler; }
+
+};
+
+}
+
+void WorkerPoolTest::onRun() {
+  testSaturation();
+  testIdleTimeout();
+}
+
+/**
+ * Test 1: ein Worker belegt, Queue (1) voll → 503 mit Connection: close; danach wird die Wartende bedient
+ */
+void WorkerPoolTest::testSaturation() {
+  WorkerPoolConnectionHandler::Config pool;
+  pool.workers = 1;
+  pool.queueDepth = 1;
+  PoolServer server(pool);
+
+  auto busy = std::make_unique<RawHttpClient>(server.port());
+  OATPP_ASSERT(busy->sendGet("/block"));
+  for (int i = 0; i < 500 && server.controller().blocked == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  OATPP_ASSERT(server.controller().blocked == 1);
+
+  RawHttpClient queued(server.port());   // landet in der Queue
+  RawHttpClient rejected(server.port()); // Queue voll
+  const auto shed = rejected.readResponse();
+  OATPP_ASSERT(RawHttpClient::hasStatus(shed, "503"));
+  OATPP_ASSERT(shed.find("Connection: close") != std::string::npos);
+  OATPP_ASSERT(rejected.closedByPeer());
+  OATPP_ASSERT(server.handler().rejectedConnections() == 1);
+
+  server.controller().release();
+  OATPP_ASSERT(RawHttpClient::hasStatus(busy->readResponse(), "200"));
+  busy.reset(); // Client schließt → Worker nimmt die wartende Verbindung
+
+  OATPP_ASSERT(queued.sendGet("/ping"));
+  const auto served = queued.readResponse();
+  OATPP_ASSERT(RawHttpClient::hasStatus(served, "200") && served.find("pong") != std::string::npos);
+}
+
+/**
+ * Test 2: schweigender Keep-Alive-Client wird nach idleTimeoutMs geschlossen, der einzige Worker ist wieder frei
+ */
+void WorkerPoolTest::testIdleTimeout() {
+  WorkerPoolConnectionHandler::Config pool;
+  pool.workers = 1;
+  pool.idleTimeoutMs = 200;
+  PoolServer server(pool);
+
+  RawHttpClient idle(server.port());
+  OATPP_ASSERT(idle.sendGet("/ping"));
+  OATPP_ASSERT(RawHttpClient::hasStatus(idle.readResponse(), "200"));
+
+  const auto start = std::chrono::steady_clock::now();
+  OATPP_ASSERT(idle.closedByPeer()); // Server schließt statt weiter zu warten
+  OATPP_ASSERT(std::chrono::steady_clock::now() - start < std::chrono::seconds(3));
+
+  RawHttpClient next(server.port());
+  OATPP_ASSERT(next.sendGet("/ping"));
+  OATPP_ASSERT(RawHttpClient::hasStatus(next.readResponse(), "200"));
+}
@@ -0,0 +1,17 @@
+#ifndef WorkerPoolTest_hpp
+#define WorkerPoolTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+class WorkerPoolTest : public oatpp::test::UnitTest {
+public:
+  WorkerPoolTest() : UnitTest("TEST[WorkerPoolTest]") {}
+
+  void onRun() override;
+
+private:
+  void testSaturation();
+  void testIdleTimeout();
+};
+
+#endif // WorkerPoolTest_hpp
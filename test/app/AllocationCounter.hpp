@@ -0,0 +1,20 @@
+#ifndef AllocationCounter_hpp
+#define AllocationCounter_hpp
+
+#include <cstdint>
+
+/**
+ * Zählt Heap-Allokationen (globales operator new, siehe AllocationCounter.cpp) pro Thread.
+ * Nur in Test-/Benchmark-Binaries linken.
+ */
+class AllocationCounter {
+public:
+
+  /**
+   * Anzahl der Allokationen des aufrufenden Threads seit Threadstart.
+   */
+  static std::uint64_t threadAllocations();
+
+};
+
+#endif // AllocationCounter_hpp
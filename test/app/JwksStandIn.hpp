@@ -0,0 +1,101 @@
+#ifndef JwksStandIn_hpp
+#define JwksStandIn_hpp
+
+#include "server/ReusePortConnectionProvider.hpp"
+
+#include "oatpp/web/server/api/ApiController.hpp"
+#include "oatpp/web/server/HttpConnectionHandler.hpp"
+#include "oatpp/network/Server.hpp"
+#include "oatpp/macro/codegen.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include OATPP_CODEGEN_BEGIN(ApiController)
+
+/**
+ * Liefert ein festes JWKS-Dokument mit ETag/Last-Modified/Cache-Control wie ein IdP.
+ */
+class JwksStandInController : public oatpp::web::server::api::ApiController {
+private:
+  oatpp::String m_jwks;
+  oatpp::String m_etag;
+public:
+  std::atomic<int> requests{0};
+  std::atomic<int> notModified{0};
+  long maxAgeSeconds = 120; // < 0 → kein Cache-Control
+public:
+
+  JwksStandInController(const std::string& jwks, const std::string& etag)
+    : oatpp::web::server::api::ApiController(std::make_shared<oatpp::web::mime::ContentMappers>())
+    , m_jwks(jwks)
+    , m_etag(etag)
+  {}
+
+  ENDPOINT("GET", "/jwks", jwks,
+           REQUEST(std::shared_ptr<IncomingRequest>, request)) {
+    ++requests;
+    const auto ifNoneMatch = request->getHeader("If-None-Match");
+    std::shared_ptr<OutgoingResponse> response;
+    if (ifNoneMatch && ifNoneMatch == m_etag) {
+      ++notModified;
+      response = createResponse(Status::CODE_304);
+    } else {
+      response = createResponse(Status::CODE_200, m_jwks);
+      response->putHeader("Content-Type", "application/json");
+      response->putHeader("Last-Modified", "Wed, 21 Oct 2015 07:28:00 GMT");
+    }
+    response->putHeader("ETag", m_etag);
+    if (maxAgeSeconds >= 0) response->putHeader("Cache-Control", "public, max-age=" + std::to_string(maxAgeSeconds));
+    return response;
+  }
+
+};
+
+#include OATPP_CODEGEN_END(ApiController)
+
+/**
+ * Lokaler JWKS-Server auf 127.0.0.1 (echtes TCP, damit libcurl ihn erreicht).
+ * Läuft in einem eigenen Thread bis zur Zerstörung. Port 0 = vom Kernel vergeben (parallele Läufe kollidieren nicht).
+ */
+class JwksStandIn {
+private:
+  std::shared_ptr<JwksStandInController> m_controller;
+  std::shared_ptr<ReusePortConnectionProvider> m_provider;
+  std::shared_ptr<oatpp::web::server::HttpConnectionHandler> m_handler;
+  std::shared_ptr<oatpp::network::Server> m_server;
+  std::thread m_thread;
+  v_uint16 m_port;
+public:
+
+  JwksStandIn(const std::string& jwks, v_uint16 port = 0, const std::string& etag = "\"jwks-v1\"")
+    : m_controller(std::make_shared<JwksStandInController>(jwks, etag))
+  {
+    auto router = oatpp::web::server::HttpRouter::createShared();
+    router->addController(m_controller);
+    ServerConfig cfg;
+    cfg.host = "127.0.0.1";
+    m_provider = std::make_shared<ReusePortConnectionProvider>(cfg, port, false);
+    m_port = m_provider->port();
+    m_handler = oatpp::web::server::HttpConnectionHandler::createShared(router);
+    m_server = std::make_shared<oatpp::network::Server>(m_provider, m_handler);
+    m_thread = std::thread([server = m_server] { server->run(); });
+  }
+
+  ~JwksStandIn() {
+    m_server->stop();
+    m_provider->stop();
+    m_handler->stop();
+    m_thread.join();
+  }
+
+  std::string url() const {
+    return "http://127.0.0.1:" + std::to_string(m_port) + "/jwks";
+  }
+
+  JwksStandInController& controller() { return *m_controller; }
+
+};
+
+#endif // JwksStandIn_hpp
@@ -18,6 +18,12 @@ class MyApiTestClient : public oatpp::web::client::ApiClient {
 
   API_CALL("GET", "/", getRoot)
 
+  API_CALL("GET", "/api/public/ping", getPublicPing)
+
+  API_CALL("GET", "/api/secure/ping", getSecurePing, HEADER(String, authorization, "Authorization"))
+
+  API_CALL("GET", "/api/secure/ping", getSecurePingAnonymous)
+
   // TODO - add more client API calls here
 
 };
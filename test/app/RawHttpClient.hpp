@@ -0,0 +1,87 @@
+#ifndef RawHttpClient_hpp
+#define RawHttpClient_hpp
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+/**
+ * Minimaler HTTP/1.1-Client über einen eigenen TCP-Socket für Tests gegen 127.0.0.1.
+ * - volle Kontrolle über die Verbindung (offen halten, schweigen, Schließen durch den Server erkennen)
+ * - 5 s Lese-Timeout, damit ein hängender Server den Test scheitern statt hängen lässt
+ */
+class RawHttpClient {
+private:
+  int m_fd;
+public:
+
+  explicit RawHttpClient(std::uint16_t port)
+    : m_fd(::socket(AF_INET, SOCK_STREAM, 0))
+  {
+    if (m_fd < 0) throw std::runtime_error("[RawHttpClient]: socket() failed");
+    timeval tv{5, 0};
+    ::setsockopt(m_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    ::inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+    if (::connect(m_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+      ::close(m_fd);
+      throw std::runtime_error("[RawHttpClient]: connect() failed");
+    }
+  }
+
+  RawHttpClient(const RawHttpClient&) = delete;
+  RawHttpClient& operator=(const RawHttpClient&) = delete;
+
+  ~RawHttpClient() {
+    ::close(m_fd);
+  }
+
+  bool sendGet(const std::string& path) {
+    const std::string request = "GET " + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    return ::send(m_fd, request.data(), request.size(), MSG_NOSIGNAL) == (ssize_t) request.size();
+  }
+
+  /**
+   * Eine Antwort (Header + Content-Length Bytes). Leer bei EOF oder Timeout vor dem ersten Byte.
+   */
+  std::string readResponse() {
+    std::string data;
+    char buffer[1024];
+    std::size_t expected = std::string::npos;
+    while (expected == std::string::npos || data.size() < expected) {
+      const auto n = ::recv(m_fd, buffer, sizeof(buffer), 0);
+      if (n <= 0) break;
+      data.append(buffer, (std::size_t) n);
+      const auto end = data.find("\r\n\r\n");
+      if (expected == std::string::npos && end != std::string::npos) {
+        const auto cl = data.find("Content-Length: ");
+        const auto length = cl != std::string::npos && cl < end ? std::stoul(data.substr(cl + 16)) : 0;
+        expected = end + 4 + length;
+      }
+    }
+    return data;
+  }
+
+  /**
+   * true, wenn der Server die Verbindung geschlossen hat (EOF innerhalb des Lese-Timeouts).
+   */
+  bool closedByPeer() {
+    char c;
+    return ::recv(m_fd, &c, 1, 0) == 0;
+  }
+
+  static bool hasStatus(const std::string& response, const char* status) {
+    return response.rfind(std::string("HTTP/1.1 ") + status, 0) == 0;
+  }
+
+};
+
+#endif // RawHttpClient_hpp
@@ -61,7 +61,7 @@ public:
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::web::mime::ContentMappers>, apiContentMappers)([] {
 
     auto json = std::make_shared<oatpp::json::ObjectMapper>();
-    json->serializerConfig().json.useBeautifier = true;
+    json->serializerConfig().json.useBeautifier = false;
 
     auto mappers = std::make_shared<oatpp::web::mime::ContentMappers>();
     mappers->putMapper(json);
@@ -0,0 +1,156 @@
+#ifndef TestKeys_hpp
+#define TestKeys_hpp
+
+#include "auth/AuthConfig.hpp"
+
+#include <jwt-cpp/jwt.h>
+
+#include <openssl/bn.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/rsa.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#endif
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Lokaler Identity-Provider-Ersatz für Tests und Benchmarks.
+ * - erzeugt ein RSA-Schlüsselpaar (OpenSSL)
+ * - liefert das passende JWKS-Dokument (kid, n, e)
+ * - signiert RS256-Tokens mit den Claims, die JwtVerifier erwartet
+ */
+class TestKeys {
+private:
+  std::string m_kid;
+  std::string m_publicPem;
+  std::string m_privatePem;
+  std::string m_n;
+  std::string m_e;
+
+  static std::string base64Url(const std::vector<unsigned char>& in) {
+    static const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    std::string out;
+    size_t i = 0;
+    for (; i + 2 < in.size(); i += 3) {
+      const unsigned v = (in[i] << 16) | (in[i + 1] << 8) | in[i + 2];
+      out += alphabet[(v >> 18) & 63];
+      out += alphabet[(v >> 12) & 63];
+      out += alphabet[(v >> 6) & 63];
+      out += alphabet[v & 63];
+    }
+    if (i + 1 == in.size()) {
+      const unsigned v = in[i] << 16;
+      out += alphabet[(v >> 18) & 63];
+      out += alphabet[(v >> 12) & 63];
+    } else if (i + 2 == in.size()) {
+      const unsigned v = (in[i] << 16) | (in[i + 1] << 8);
+      out += alphabet[(v >> 18) & 63];
+      out += alphabet[(v >> 12) & 63];
+      out += alphabet[(v >> 6) & 63];
+    }
+    return out;
+  }
+
+  static std::string bnToBase64Url(const BIGNUM* bn) {
+    std::vector<unsigned char> bytes(BN_num_bytes(bn));
+    BN_bn2bin(bn, bytes.data());
+    return base64Url(bytes);
+  }
+
+  static std::string bioToString(BIO* bio) {
+    char* data = nullptr;
+    const long len = BIO_get_mem_data(bio, &data);
+    return std::string(data, (size_t) len);
+  }
+
+public:
+
+  explicit TestKeys(std::string kid = "test-key", int bits = 2048)
+    : m_kid(std::move(kid))
+  {
+    std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> ctx(EVP_PKEY_CTX_new_id(EVP_PKEY_RSA, nullptr), EVP_PKEY_CTX_free);
+    EVP_PKEY* raw = nullptr;
+    if (!ctx || EVP_PKEY_keygen_init(ctx.get()) <= 0 ||
+        EVP_PKEY_CTX_set_rsa_keygen_bits(ctx.get(), bits) <= 0 ||
+        EVP_PKEY_keygen(ctx.get(), &raw) <= 0) {
+      throw std::runtime_error("RSA keygen failed");
+    }
+    std::unique_ptr<EVP_PKEY, decltype(&EVP_PKEY_free)> pkey(raw, EVP_PKEY_free);
+
+    std::unique_ptr<BIO, decltype(&BIO_free)> pub(BIO_new(BIO_s_mem()), BIO_free);
+    std::unique_ptr<BIO, decltype(&BIO_free)> priv(BIO_new(BIO_s_mem()), BIO_free);
+    PEM_write_bio_PUBKEY(pub.get(), pkey.get());
+    PEM_write_bio_PrivateKey(priv.get(), pkey.get(), nullptr, nullptr, 0, nullptr, nullptr);
+    m_publicPem = bioToString(pub.get());
+    m_privatePem = bioToString(priv.get());
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    BIGNUM* n = nullptr;
+    BIGNUM* e = nullptr;
+    EVP_PKEY_get_bn_param(pkey.get(), OSSL_PKEY_PARAM_RSA_N, &n);
+    EVP_PKEY_get_bn_param(pkey.get(), OSSL_PKEY_PARAM_RSA_E, &e);
+    m_n = bnToBase64Url(n);
+    m_e = bnToBase64Url(e);
+    BN_free(n);
+    BN_free(e);
+#else
+    const BIGNUM* n = nullptr;
+    const BIGNUM* e = nullptr;
+    RSA_get0_key(EVP_PKEY_get0_RSA(pkey.get()), &n, &e, nullptr);
+    m_n = bnToBase64Url(n);
+    m_e = bnToBase64Url(e);
+#endif
+  }
+
+  const std::string& kid() const { return m_kid; }
+  const std::string& publicPem() const { return m_publicPem; }
+
+  /**
+   * JWKS-Dokument mit genau diesem Schlüssel.
+   */
+  std::string jwks() const {
+    return "{\"keys\":[{\"kty\":\"RSA\",\"use\":\"sig\",\"alg\":\"RS256\",\"kid\":\"" + m_kid +
+           "\",\"n\":\"" + m_n + "\",\"e\":\"" + m_e + "\"}]}";
+  }
+
+  /**
+   * RS256-Token für die Konfiguration (iss/aud) signieren.
+   */
+  std::string sign(const AuthConfig& cfg, const std::string& subject,
+                   std::chrono::seconds ttl = std::chrono::hours(1)) const {
+    const auto now = std::chrono::system_clock::now();
+    auto builder = jwt::create()
+      .set_type("JWT")
+      .set_key_id(m_kid)
+      .set_issuer(cfg.issuer)
+      .set_subject(subject)
+      .set_payload_claim("azp", jwt::claim(std::string("test-client")))
+      .set_issued_at(now)
+      .set_expires_at(now + ttl);
+    if (!cfg.audience.empty()) {
+      builder.set_audience(cfg.audience);
+    }
+    return builder.sign(jwt::algorithm::rs256(m_publicPem, m_privatePem));
+  }
+
+  /**
+   * AuthConfig für Tests/Benchmarks (ohne ENV).
+   */
+  static std::shared_ptr<AuthConfig> config(const std::string& jwksUrl = "http://127.0.0.1:9/jwks") {
+    auto c = std::make_shared<AuthConfig>();
+    c->issuer = "https://issuer.test/realms/demo";
+    c->jwksUrl = jwksUrl;
+    c->audience = "starter";
+    c->securePathPrefixes = {"/api/secure/"};
+    return c;
+  }
+
+};
+
+#endif // TestKeys_hpp
@@ -0,0 +1,75 @@
+#ifndef TestRequest_hpp
+#define TestRequest_hpp
+
+#include "oatpp/web/protocol/http/incoming/Request.hpp"
+#include "oatpp/web/protocol/http/incoming/SimpleBodyDecoder.hpp"
+#include "oatpp/data/stream/BufferStream.hpp"
+#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+
+/**
+ * Header eines Test-Requests; Einträge mit leerem Wert (nullptr) werden übersprungen,
+ * so lässt sich ein optionaler Header direkt durchreichen.
+ */
+using TestHeaders = std::vector<std::pair<oatpp::String, oatpp::String>>;
+
+/**
+ * Request wie vom Connection Handler geparst, aber ohne Server (für Interceptor- und Controller-Tests).
+ * - Host: localhost ist immer gesetzt
+ * - mit body: Content-Length passend zum Body, lesbar über readBodyToString()/readBodyToDto()
+ */
+inline std::shared_ptr<oatpp::web::protocol::http::incoming::Request>
+makeRequest(const char* method, const char* path, const TestHeaders& extraHeaders = {},
+            const std::shared_ptr<oatpp::data::stream::IOStream>& connection = nullptr,
+            const oatpp::String& body = nullptr) {
+  oatpp::web::protocol::http::RequestStartingLine line;
+  line.method = method;
+  line.path = path;
+  line.protocol = "HTTP/1.1";
+  oatpp::web::protocol::http::Headers headers;
+  headers.put("Host", "localhost");
+  if (body) headers.put("Content-Length", oatpp::String(std::to_string(body->size())));
+  for (const auto& [name, value] : extraHeaders) {
+    if (value) headers.put(name, value);
+  }
+  if (!body) {
+    return oatpp::web::protocol::http::incoming::Request::createShared(connection, line, headers, nullptr, nullptr);
+  }
+  return oatpp::web::protocol::http::incoming::Request::createShared(
+    connection, line, headers,
+    std::make_shared<oatpp::data::stream::BufferInputStream>(body),
+    std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>());
+}
+
+/**
+ * JSON-Body-Request (Content-Type application/json), z.B. für POST/PUT an Controller.
+ */
+inline std::shared_ptr<oatpp::web::protocol::http::incoming::Request>
+makeBodyRequest(const char* method, const char* path, const oatpp::String& body, const TestHeaders& extraHeaders = {}) {
+  TestHeaders headers = {{"Content-Type", "application/json"}};
+  headers.insert(headers.end(), extraHeaders.begin(), extraHeaders.end());
+  return makeRequest(method, path, headers, nullptr, body);
+}
+
+/**
+ * Wie makeRequest, aber über eine Verbindung mit Peer-Adresse (Properties wie vom ReusePortConnectionProvider).
+ * Die Verbindung hält einen eigenen, unverbundenen Socket; er wird mit dem Request geschlossen.
+ */
+inline std::shared_ptr<oatpp::web::protocol::http::incoming::Request>
+makePeerRequest(const char* method, const char* path, const char* peer, const TestHeaders& extraHeaders = {}) {
+  using ExtendedConnection = oatpp::network::tcp::server::ConnectionProvider::ExtendedConnection;
+  oatpp::data::stream::Context::Properties properties;
+  properties.put_LockFree(ExtendedConnection::PROPERTY_PEER_ADDRESS, oatpp::String(peer));
+  properties.put_LockFree(ExtendedConnection::PROPERTY_PEER_ADDRESS_FORMAT, std::strchr(peer, ':') ? "ipv6" : "ipv4");
+  auto connection = std::make_shared<ExtendedConnection>(::socket(AF_INET, SOCK_STREAM, 0), std::move(properties));
+  return makeRequest(method, path, extraHeaders, connection);
+}
+
+#endif // TestRequest_hpp
@@ -1,7 +1,24 @@
 
 #include "MyControllerTest.hpp"
 #include "StudentTest.hpp"
+#include "StudentRepositoryTest.hpp"
+#include "LeaderboardTest.hpp"
+#include "CompactStudentTest.hpp"
 #include "TestCodeTest.hpp"
+#include "TokenCacheTest.hpp"
+#include "JwksCacheTest.hpp"
+#include "RouteMatcherTest.hpp"
+#include "AuthHotPathTest.hpp"
+#include "JwtFastDecoderTest.hpp"
+#include "TokenBatchTest.hpp"
+#include "MetricsTest.hpp"
+#include "PrettyJsonTest.hpp"
+#include "CompressionTest.hpp"
+#include "AdmissionTest.hpp"
+#include "RateLimitTest.hpp"
+#include "WorkerPoolTest.hpp"
+#include "AcceptorTest.hpp"
+#include "AsyncModeTest.hpp"
 
 #include <iostream>
 
@@ -9,6 +26,23 @@ void runTests() {
   // OATPP_RUN_TEST(MyControllerTest);
   // OATPP_RUN_TEST(StudentTest);
   OATPP_RUN_TEST(TestCodeTest);
+  OATPP_RUN_TEST(StudentRepositoryTest);
+  OATPP_RUN_TEST(LeaderboardTest);
+  OATPP_RUN_TEST(CompactStudentTest);
+  OATPP_RUN_TEST(TokenCacheTest);
+  OATPP_RUN_TEST(JwksCacheTest);
+  OATPP_RUN_TEST(RouteMatcherTest);
+  OATPP_RUN_TEST(AuthHotPathTest);
+  OATPP_RUN_TEST(JwtFastDecoderTest);
+  OATPP_RUN_TEST(TokenBatchTest);
+  OATPP_RUN_TEST(MetricsTest);
+  OATPP_RUN_TEST(PrettyJsonTest);
+  OATPP_RUN_TEST(CompressionTest);
+  OATPP_RUN_TEST(AdmissionTest);
+  OATPP_RUN_TEST(RateLimitTest);
+  OATPP_RUN_TEST(WorkerPoolTest);
+  OATPP_RUN_TEST(AcceptorTest);
+  OATPP_RUN_TEST(AsyncModeTest);
 }
 
 int main() {